@@ -25,6 +25,7 @@
 #include "ndarray.h"
 #include "ndscalar.h"
 #include "ndarray_operators.h"
+#include "numpy/carray/carray.h"
 
 mp_uint_t ndarray_print_threshold = NDARRAY_PRINT_THRESHOLD;
 mp_uint_t ndarray_print_edgeitems = NDARRAY_PRINT_EDGEITEMS;
@@ -334,10 +335,24 @@ void ndarray_rewind_array(uint8_t ndim, uint8_t *array, size_t *shape, int32_t *
 }
 #endif
 
+uint8_t ndarray_dtype_itemsize(uint8_t dtype) {
+    // returns the size of a single element in bytes
+    // mp_binary_get_size knows nothing about Booleans, and complexes
+    if(dtype == NDARRAY_BOOL) {
+        return 1;
+    }
+    #if ULAB_SUPPORTS_COMPLEX
+    if(dtype == NDARRAY_COMPLEX) {
+        return 2 * sizeof(mp_float_t);
+    }
+    #endif
+    return mp_binary_get_size('@', dtype, NULL);
+}
+
 static int32_t *strides_from_shape(size_t *shape, uint8_t dtype) {
     // returns a strides array that corresponds to a dense array with the prescribed shape
     int32_t *strides = m_new(int32_t, ULAB_MAX_DIMS);
-    strides[ULAB_MAX_DIMS-1] = (int32_t)mp_binary_get_size('@', dtype, NULL);
+    strides[ULAB_MAX_DIMS-1] = (int32_t)ndarray_dtype_itemsize(dtype);
     for(uint8_t i=ULAB_MAX_DIMS; i > 1; i--) {
         strides[i-2] = strides[i-1] * shape[i-1];
     }
@@ -465,7 +480,11 @@ mp_obj_t ndarray_dtype(mp_obj_t self_in) {
         if((len != 1) || ((*_dtype != NDARRAY_BOOL) && (*_dtype != NDARRAY_UINT8)
 			&& (*_dtype != NDARRAY_INT32) && (*_dtype != NDARRAY_UINT32) && (*_dtype != NDARRAY_INT64)
             && (*_dtype != NDARRAY_INT8) && (*_dtype != NDARRAY_UINT16)
-            && (*_dtype != NDARRAY_INT16) && (*_dtype != NDARRAY_FLOAT))) {
+            && (*_dtype != NDARRAY_INT16) && (*_dtype != NDARRAY_FLOAT)
+            #if ULAB_SUPPORTS_COMPLEX
+            && (*_dtype != NDARRAY_COMPLEX)
+            #endif
+            )) {
             mp_raise_TypeError(translate("data type not understood"));
         }
         dtype = *_dtype;
@@ -507,6 +526,12 @@ MP_DEFINE_CONST_FUN_OBJ_0(ndarray_get_printoptions_obj, ndarray_get_printoptions
 
 mp_obj_t ndarray_get_item(ndarray_obj_t *ndarray, void *array) {
     // returns a proper micropython object from an array
+    #if ULAB_SUPPORTS_COMPLEX
+    if(ndarray->dtype == NDARRAY_COMPLEX) {
+        mp_float_t *carray = (mp_float_t *)array;
+        return mp_obj_new_complex(carray[0], carray[1]);
+    }
+    #endif
     if(!ndarray->boolean) {
         return mp_binary_get_val_array(ndarray->dtype, array, 0);
     } else {
@@ -632,6 +657,17 @@ void ndarray_assign_elements(ndarray_obj_t *ndarray, mp_obj_t iterable, uint8_t
             array++;
             (*idx)++;
         }
+    #if ULAB_SUPPORTS_COMPLEX
+    } else if(dtype == NDARRAY_COMPLEX) {
+        mp_float_t *array = (mp_float_t *)ndarray->array;
+        array += 2 * (*idx);
+        while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+            // mp_obj_get_complex accepts integers and floats, too
+            mp_obj_get_complex(item, array, array + 1);
+            array += 2;
+            (*idx)++;
+        }
+    #endif
     } else {
         while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
             mp_binary_set_val_array(dtype, ndarray->array, (*idx)++, item);
@@ -649,6 +685,20 @@ bool ndarray_is_dense(ndarray_obj_t *ndarray) {
     return stride == ndarray->strides[ULAB_MAX_DIMS-ndarray->ndim] ? true : false;
 }
 
+bool ndarray_is_contiguous(ndarray_obj_t *ndarray) {
+    // returns true, if the elements follow each other in memory in row-major order,
+    // i.e., the array can be traversed as a single lane with stride itemsize
+    int32_t stride = ndarray->itemsize;
+    for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndarray->ndim; i--) {
+        // the stride of an axis of length 1 is never used
+        if((ndarray->shape[i - 1] > 1) && (ndarray->strides[i - 1] != stride)) {
+            return false;
+        }
+        stride *= ndarray->shape[i - 1];
+    }
+    return true;
+}
+
 
 ndarray_obj_t *ndarray_new_ndarray(uint8_t ndim, size_t *shape, int32_t *strides, uint8_t dtype) {
     // Creates the base ndarray with shape, and initialises the values to straight 0s
@@ -658,7 +708,7 @@ ndarray_obj_t *ndarray_new_ndarray(uint8_t ndim, size_t *shape, int32_t *strides
     ndarray->boolean = dtype == NDARRAY_BOOL ? NDARRAY_BOOLEAN : NDARRAY_NUMERIC;
     ndarray->ndim = ndim;
     ndarray->len = ndim == 0 ? 0 : 1;
-    ndarray->itemsize = mp_binary_get_size('@', ndarray->dtype, NULL);
+    ndarray->itemsize = ndarray_dtype_itemsize(ndarray->dtype);
     int32_t *_strides;
     if(strides == NULL) {
         _strides = strides_from_shape(shape, ndarray->dtype);
@@ -686,7 +736,7 @@ ndarray_obj_t *ndarray_new_dense_ndarray(uint8_t ndim, size_t *shape, uint8_t dt
     // creates a dense array, i.e., one, where the strides are derived directly from the shapes
     // the function should work in the general n-dimensional case
 	int32_t strides[ULAB_MAX_DIMS] = { 0, 0 };
-    strides[ULAB_MAX_DIMS-1] = dtype == NDARRAY_BOOL ? 1 : mp_binary_get_size('@', dtype, NULL);
+    strides[ULAB_MAX_DIMS-1] = ndarray_dtype_itemsize(dtype);
     for(size_t i=ULAB_MAX_DIMS; i > 1; i--) {
         strides[i-2] = strides[i-1] * MAX(1, shape[i-1]);
     }
@@ -817,6 +867,13 @@ mp_obj_t ndarray_byteswap(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
         return MP_OBJ_FROM_PTR(ndarray);
     } else {
         uint8_t *array = (uint8_t *)ndarray->array;
+        // the number of floats in an element; integers are swapped as two-byte values
+        uint8_t nfloats = self->dtype == NDARRAY_FLOAT ? 1 : 0;
+        #if ULAB_SUPPORTS_COMPLEX
+        if(self->dtype == NDARRAY_COMPLEX) {
+            nfloats = 2;
+        }
+        #endif
         #if ULAB_MAX_DIMS > 3
         size_t i = 0;
         do {
@@ -831,16 +888,19 @@ mp_obj_t ndarray_byteswap(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
                 #endif
                     size_t l = 0;
                     do {
-                        if(self->dtype == NDARRAY_FLOAT) {
-                            #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
-                            SWAP(uint8_t, array[0], array[3]);
-                            SWAP(uint8_t, array[1], array[2]);
-                            #else
-                            SWAP(uint8_t, array[0], array[7]);
-                            SWAP(uint8_t, array[1], array[6]);
-                            SWAP(uint8_t, array[2], array[5]);
-                            SWAP(uint8_t, array[3], array[4]);
-                            #endif
+                        if(nfloats) {
+                            // the real and imaginary parts of complexes are swapped separately
+                            for(uint8_t *value = array; value < array + nfloats * sizeof(mp_float_t); value += sizeof(mp_float_t)) {
+                                #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+                                SWAP(uint8_t, value[0], value[3]);
+                                SWAP(uint8_t, value[1], value[2]);
+                                #else
+                                SWAP(uint8_t, value[0], value[7]);
+                                SWAP(uint8_t, value[1], value[6]);
+                                SWAP(uint8_t, value[2], value[5]);
+                                SWAP(uint8_t, value[3], value[4]);
+                                #endif
+                            }
                         } else {
                             SWAP(uint8_t, array[0], array[1]);
                         }
@@ -916,6 +976,10 @@ STATIC uint8_t ndarray_init_helper(size_t n_args, const mp_obj_t *pos_args, mp_m
             return MP_OBJ_SMALL_INT_VALUE(obj);
         }
     }
+    // the default value, and the dtype of another array are plain integers
+    if(mp_obj_is_small_int(args[1].u_obj)) {
+        return MP_OBJ_SMALL_INT_VALUE(args[1].u_obj);
+    }
     mp_raise_ValueError(MP_ERROR_TEXT("can't get dtype"));
     #else
     _dtype = mp_obj_get_int(args[1].u_obj);
@@ -928,15 +992,29 @@ STATIC mp_obj_t ndarray_make_new_core(const mp_obj_type_t *type, size_t n_args,
 	uint8_t dtype = NDARRAY_FLOAT;
 	if(kw_args)
 		dtype = ndarray_init_helper(n_args, args, kw_args);
+    #if ULAB_SUPPORTS_COMPLEX
+    // without an explicit dtype, an iterable of complexes results in a complex array
+    bool infer_complex = (kw_args == NULL) || (kw_args->used == 0);
+    #endif
 
     if(mp_obj_is_type(args[0], &ulab_ndarray_type)) {
         ndarray_obj_t *source = MP_OBJ_TO_PTR(args[0]);
+        #if ULAB_SUPPORTS_COMPLEX
+        if(infer_complex && (source->dtype == NDARRAY_COMPLEX)) {
+            dtype = NDARRAY_COMPLEX;
+        }
+        #endif
         if(dtype == source->dtype) {
             return ndarray_copy_view(source);
         }
         ndarray_obj_t *target = ndarray_new_dense_ndarray(source->ndim, source->shape, dtype);
         uint8_t *sarray = (uint8_t *)source->array;
         uint8_t *tarray = (uint8_t *)target->array;
+        #if ULAB_SUPPORTS_COMPLEX
+        bool from_complex = source->dtype == NDARRAY_COMPLEX;
+        #else
+        bool from_complex = false;
+        #endif
         #if ULAB_MAX_DIMS > 3
         size_t i = 0;
         do {
@@ -951,16 +1029,30 @@ STATIC mp_obj_t ndarray_make_new_core(const mp_obj_type_t *type, size_t n_args,
                 #endif
                     size_t l = 0;
                     do {
+                        #if ULAB_SUPPORTS_COMPLEX
+                        if(dtype == NDARRAY_COMPLEX) {
+                            // real values are converted to complexes with a vanishing imaginary part
+                            mp_float_t *carray = (mp_float_t *)tarray;
+                            carray[0] = ndarray_get_float_value(sarray, source->dtype);
+                            carray[1] = MICROPY_FLOAT_CONST(0.0);
+                        } else {
+                        #endif
                         mp_obj_t item;
                         // floats must be treated separately, because they can't directly be converted to integer types
-                        if((source->dtype == NDARRAY_FLOAT) && (dtype != NDARRAY_FLOAT)) {
+                        // the imaginary part of complexes is discarded, the real part is the first mp_float_t
+                        if(((source->dtype == NDARRAY_FLOAT) || from_complex) && (dtype != NDARRAY_FLOAT)) {
                             // floats must be treated separately, because they can't directly be converted to integer types
-                            mp_float_t f = ndarray_get_float_value(sarray, source->dtype);
+                            mp_float_t f = from_complex ? *((mp_float_t *)sarray) : ndarray_get_float_value(sarray, source->dtype);
                             item = mp_obj_new_int((int32_t)MICROPY_FLOAT_C_FUN(floor)(f));
+                        } else if(from_complex) {
+                            item = mp_obj_new_float(*((mp_float_t *)sarray));
                         } else {
                             item = mp_binary_get_val_array(source->dtype, sarray, 0);
                         }
                         mp_binary_set_val_array(dtype, tarray, 0, item);
+                        #if ULAB_SUPPORTS_COMPLEX
+                        }
+                        #endif
                         tarray += target->itemsize;
                         sarray += source->strides[ULAB_MAX_DIMS - 1];
                         l++;
@@ -1011,6 +1103,11 @@ STATIC mp_obj_t ndarray_make_new_core(const mp_obj_type_t *type, size_t n_args,
         item = mp_iternext(iterable[ndim]);
         ndim++;
     }
+    #if ULAB_SUPPORTS_COMPLEX
+    if(infer_complex && mp_obj_is_type(item, &mp_type_complex)) {
+        dtype = NDARRAY_COMPLEX;
+    }
+    #endif
     for(uint8_t i=0; i < ndim; i++) {
         // align all values to the right
         shape[ULAB_MAX_DIMS - i - 1] = shape[ndim - 1 - i];
@@ -1232,6 +1329,13 @@ void ndarray_assign_view(ndarray_obj_t *view, ndarray_obj_t *values) {
 
     }
 
+    #if ULAB_SUPPORTS_COMPLEX
+    if((view->dtype == NDARRAY_COMPLEX) || (values->dtype == NDARRAY_COMPLEX)) {
+        carray_assign_view(view, values, shape, lstrides, rstrides);
+        return;
+    }
+    #endif
+
 	int shift_value = 0;
 	if (view->itemsize == 2) shift_value = 1;
 	else if (view->itemsize == 4) shift_value = 2;
@@ -1455,6 +1559,11 @@ static mp_obj_t ndarray_get_slice(ndarray_obj_t *ndarray, mp_obj_t index, ndarra
         if(values == NULL) { // return value(s)
             // if the view has been reduced to nothing, return a single value
             if(view->ndim == 0) {
+                #if ULAB_SUPPORTS_COMPLEX
+                if(view->dtype == NDARRAY_COMPLEX) {
+                    return ndarray_get_item(view, view->array);
+                }
+                #endif
                 #if NUMPY_HAS_DTYPE_SCALAR
                 return ndscalare_from_array(view->dtype, view->array, view->itemsize);
                 #else
@@ -1729,6 +1838,13 @@ ndarray_obj_t *match_type_to_array(mp_obj_t obj, int is_lower_case) // bit5 == l
 		mp_float_t *array = (mp_float_t *)ndarray->array;
 		array[0] = (mp_float_t)fvalue;
 	}
+    #if ULAB_SUPPORTS_COMPLEX
+    else if (mp_obj_is_type(obj, &mp_type_complex)) {
+        ndarray = ndarray_new_linear_array(1, NDARRAY_COMPLEX);
+        mp_float_t *array = (mp_float_t *)ndarray->array;
+        mp_obj_get_complex(obj, &array[0], &array[1]);
+    }
+    #endif
 	else if (mp_obj_is_int(obj)) {
 		int32_t value = mp_obj_get_int(obj);
         type = var_value_to_type(value, is_lower_case);
@@ -1778,6 +1894,12 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t obj) {
         ndarray = ndarray_new_linear_array(1, NDARRAY_FLOAT);
         mp_float_t *array = (mp_float_t *)ndarray->array;
         array[0] = (mp_float_t)fvalue;
+    #if ULAB_SUPPORTS_COMPLEX
+    } else if(mp_obj_is_type(obj, &mp_type_complex)) {
+        ndarray = ndarray_new_linear_array(1, NDARRAY_COMPLEX);
+        mp_float_t *array = (mp_float_t *)ndarray->array;
+        mp_obj_get_complex(obj, &array[0], &array[1]);
+    #endif
     } else if(mp_obj_is_type(obj, &ulab_ndarray_type)){
         return obj;
 	} else {
@@ -1832,6 +1954,13 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t op, mp_obj_t lobj, mp_obj_t robj) {
     if(!broadcastable) {
         mp_raise_ValueError(translate("operands could not be broadcast together"));
     }
+
+    #if ULAB_SUPPORTS_COMPLEX
+    // complexes are not handled by the temporary buffers of the real operators
+    if((lhs->dtype == NDARRAY_COMPLEX) || (rhs->dtype == NDARRAY_COMPLEX)) {
+        return carray_binary_op(op, lhs, rhs, ndim, shape, lstrides, rstrides);
+    }
+    #endif
     // the empty arrays have to be treated separately
 
 #if NUMPY_OPERATORS_USE_TEMPORARY_BUFFER
@@ -1986,6 +2115,11 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t op, mp_obj_t lobj, mp_obj_t robj) {
 mp_obj_t ndarray_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     ndarray_obj_t *self = MP_OBJ_TO_PTR(self_in);
     ndarray_obj_t *ndarray = NULL;
+    #if ULAB_SUPPORTS_COMPLEX
+    if((self->dtype == NDARRAY_COMPLEX) && (op != MP_UNARY_OP_LEN)) {
+        return carray_unary_op(op, self);
+    }
+    #endif
 #if NUMPY_OPERATORS_USE_TEMPORARY_BUFFER
     int* p1, *p_temp,i;
     int n = allocate_temp_buff_for_operator(self->ndim, self->shape, &p1, 0);
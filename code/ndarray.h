@@ -53,6 +53,10 @@ typedef struct _mp_obj_slice_t {
 #define translate(x) MP_ERROR_TEXT(x)
 #endif
 
+#if ULAB_SUPPORTS_COMPLEX && !MICROPY_PY_BUILTINS_COMPLEX
+#error "ULAB_SUPPORTS_COMPLEX requires MICROPY_PY_BUILTINS_COMPLEX"
+#endif
+
 #define NDARRAY_NUMERIC   0
 #define NDARRAY_BOOLEAN   1
 
@@ -71,6 +75,9 @@ enum NDARRAY_TYPE {
     NDARRAY_INT32 = 'i',
     NDARRAY_INT64 = 'q',
     NDARRAY_FLOAT = FLOAT_TYPECODE,
+    #if ULAB_SUPPORTS_COMPLEX
+    NDARRAY_COMPLEX = 'c', // the real and imaginary parts are stored as two consecutive mp_float_t values
+    #endif
 };
 
 typedef struct _ndarray_obj_t {
@@ -105,6 +112,8 @@ mp_obj_t ndarray_dtype_make_new(const mp_obj_type_t *, size_t , size_t , const m
 
 mp_obj_t ndarray_new_ndarray_iterator(mp_obj_t , mp_obj_iter_buf_t *);
 
+uint8_t ndarray_dtype_itemsize(uint8_t );
+mp_obj_t ndarray_get_item(ndarray_obj_t *, void *);
 mp_float_t ndarray_get_float_value(void *, uint8_t );
 mp_float_t ndarray_get_float_index(void *, uint8_t , size_t );
 bool ndarray_object_is_array_like(mp_obj_t );
@@ -131,6 +140,7 @@ ndarray_obj_t *ndarray_new_ndarray(uint8_t , size_t *, int32_t *, uint8_t );
 ndarray_obj_t *ndarray_new_linear_array(size_t , uint8_t );
 ndarray_obj_t *ndarray_new_view(ndarray_obj_t *, uint8_t , size_t *, int32_t *, int32_t );
 bool ndarray_is_dense(ndarray_obj_t *);
+bool ndarray_is_contiguous(ndarray_obj_t *);
 ndarray_obj_t *ndarray_copy_view(ndarray_obj_t *);
 void ndarray_copy_array(ndarray_obj_t *, ndarray_obj_t *);
 
@@ -0,0 +1,338 @@
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+*/
+
+#include <math.h>
+#include <string.h>
+#include "py/obj.h"
+#include "py/runtime.h"
+#include "py/misc.h"
+
+#include "../../ulab.h"
+#include "../../ulab_tools.h"
+#include "carray.h"
+
+#if ULAB_SUPPORTS_COMPLEX
+
+// Complex arrays hold the real and imaginary parts of each element as two consecutive
+// mp_float_t values. Operators convert their operands into dense buffers of such pairs,
+// and then work on the buffers, so that the dtype of the other operand has to be taken
+// into account only once.
+
+static void carray_copy(mp_float_t *buffer, ndarray_obj_t *ndarray, size_t *shape, int32_t *strides, bool load) {
+    // if load is true, copies the elements of ndarray, as selected by shape and strides, into
+    // a dense buffer of complexes; otherwise, copies the buffer into the complex array
+    uint8_t *array = (uint8_t *)ndarray->array;
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t k = 0;
+            do {
+            #endif
+                size_t l = 0;
+                do {
+                    if(load) {
+                        if(ndarray->dtype == NDARRAY_COMPLEX) {
+                            memcpy(buffer, array, 2 * sizeof(mp_float_t));
+                        } else {
+                            buffer[0] = ndarray_get_float_value(array, ndarray->dtype);
+                            buffer[1] = MICROPY_FLOAT_CONST(0.0);
+                        }
+                    } else {
+                        memcpy(array, buffer, 2 * sizeof(mp_float_t));
+                    }
+                    buffer += 2;
+                    array += strides[ULAB_MAX_DIMS - 1];
+                    l++;
+                } while(l < shape[ULAB_MAX_DIMS - 1]);
+            #if ULAB_MAX_DIMS > 1
+                array -= strides[ULAB_MAX_DIMS - 1] * shape[ULAB_MAX_DIMS-1];
+                array += strides[ULAB_MAX_DIMS - 2];
+                k++;
+            } while(k < shape[ULAB_MAX_DIMS - 2]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            array -= strides[ULAB_MAX_DIMS - 2] * shape[ULAB_MAX_DIMS-2];
+            array += strides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < shape[ULAB_MAX_DIMS - 3]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        array -= strides[ULAB_MAX_DIMS - 3] * shape[ULAB_MAX_DIMS-3];
+        array += strides[ULAB_MAX_DIMS - 4];
+        i++;
+    } while(i < shape[ULAB_MAX_DIMS - 4]);
+    #endif
+}
+
+void carray_load(mp_float_t *buffer, ndarray_obj_t *ndarray, size_t *shape, int32_t *strides) {
+    carray_copy(buffer, ndarray, shape, strides, true);
+}
+
+static size_t carray_length(uint8_t ndim, size_t *shape) {
+    size_t len = ndim == 0 ? 0 : 1;
+    for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndim; i--) {
+        len *= shape[i - 1];
+    }
+    return len;
+}
+
+void carray_assign_view(ndarray_obj_t *view, ndarray_obj_t *values, size_t *shape, int32_t *lstrides, int32_t *rstrides) {
+    // assigns the broadcast values to a view, at least one of which is complex
+    if(view->dtype != NDARRAY_COMPLEX) {
+        mp_raise_TypeError(translate("complex values cannot be cast to a real dtype"));
+    }
+    if((view->len == 0) || (values->len == 0)) {
+        return;
+    }
+    // the values must not be larger than the view
+    size_t len = 1;
+    for(uint8_t i = 0; i < ULAB_MAX_DIMS; i++) {
+        len *= MAX(1, shape[i]);
+    }
+    if(len != view->len) {
+        mp_raise_ValueError(translate("operands could not be broadcast together"));
+    }
+    mp_float_t *buffer = m_new(mp_float_t, 2 * len);
+    carray_copy(buffer, values, shape, rstrides, true);
+    carray_copy(buffer, view, shape, lstrides, false);
+    m_del(mp_float_t, buffer, 2 * len);
+}
+
+mp_obj_t carray_binary_op(mp_binary_op_t op, ndarray_obj_t *lhs, ndarray_obj_t *rhs, uint8_t ndim, size_t *shape, int32_t *lstrides, int32_t *rstrides) {
+    // at least one of the operands is complex; the operands have already been broadcast
+    if((op >= MP_BINARY_OP_REVERSE_OR) && (op <= MP_BINARY_OP_REVERSE_POWER)) {
+        SWAP(ndarray_obj_t *, lhs, rhs);
+        SWAP(int32_t *, lstrides, rstrides);
+        op = op - MP_BINARY_OP_REVERSE_OR + MP_BINARY_OP_OR;
+    }
+    bool inplace = false;
+    if((op >= MP_BINARY_OP_INPLACE_OR) && (op <= MP_BINARY_OP_INPLACE_POWER)) {
+        if(lhs->dtype != NDARRAY_COMPLEX) {
+            mp_raise_TypeError(translate("complex values cannot be cast to a real dtype"));
+        }
+        op = op - MP_BINARY_OP_INPLACE_OR + MP_BINARY_OP_OR;
+        inplace = true;
+    }
+    bool equality = (op == MP_BINARY_OP_EQUAL) || (op == MP_BINARY_OP_NOT_EQUAL);
+    if(!equality && (op != MP_BINARY_OP_ADD) && (op != MP_BINARY_OP_SUBTRACT) &&
+        (op != MP_BINARY_OP_MULTIPLY) && (op != MP_BINARY_OP_TRUE_DIVIDE)) {
+        return MP_OBJ_NULL; // op not supported
+    }
+
+    size_t len = carray_length(ndim, shape);
+    ndarray_obj_t *results;
+    if(inplace) {
+        results = lhs;
+    } else {
+        results = ndarray_new_dense_ndarray(ndim, shape, equality ? NDARRAY_BOOL : NDARRAY_COMPLEX);
+    }
+    if(len == 0) {
+        return MP_OBJ_FROM_PTR(results);
+    }
+
+    // the left hand side is loaded directly into the results, if these are complex and dense
+    mp_float_t *larray;
+    if(inplace || equality) {
+        larray = m_new(mp_float_t, 2 * len);
+    } else {
+        larray = (mp_float_t *)results->array;
+    }
+    mp_float_t *rarray = m_new(mp_float_t, 2 * len);
+    carray_load(larray, lhs, shape, lstrides);
+    carray_load(rarray, rhs, shape, rstrides);
+
+    mp_float_t *l = larray, *r = rarray;
+    if(equality) {
+        uint8_t *array = (uint8_t *)results->array;
+        uint8_t differ = op == MP_BINARY_OP_NOT_EQUAL ? 1 : 0;
+        for(size_t i = 0; i < len; i++, l += 2, r += 2) {
+            *array++ = ((l[0] == r[0]) && (l[1] == r[1])) ^ differ;
+        }
+    } else if(op == MP_BINARY_OP_ADD) {
+        for(size_t i = 0; i < len; i++, l += 2, r += 2) {
+            l[0] += r[0];
+            l[1] += r[1];
+        }
+    } else if(op == MP_BINARY_OP_SUBTRACT) {
+        for(size_t i = 0; i < len; i++, l += 2, r += 2) {
+            l[0] -= r[0];
+            l[1] -= r[1];
+        }
+    } else if(op == MP_BINARY_OP_MULTIPLY) {
+        for(size_t i = 0; i < len; i++, l += 2, r += 2) {
+            mp_float_t re = l[0] * r[0] - l[1] * r[1];
+            l[1] = l[0] * r[1] + l[1] * r[0];
+            l[0] = re;
+        }
+    } else { // MP_BINARY_OP_TRUE_DIVIDE
+        for(size_t i = 0; i < len; i++, l += 2, r += 2) {
+            // division by zero results in infinities, or nans, as for floats
+            mp_float_t norm = r[0] * r[0] + r[1] * r[1];
+            mp_float_t re = (l[0] * r[0] + l[1] * r[1]) / norm;
+            l[1] = (l[1] * r[0] - l[0] * r[1]) / norm;
+            l[0] = re;
+        }
+    }
+
+    if(inplace) {
+        carray_copy(larray, lhs, lhs->shape, lhs->strides, false);
+    }
+    if(inplace || equality) {
+        m_del(mp_float_t, larray, 2 * len);
+    }
+    m_del(mp_float_t, rarray, 2 * len);
+    return MP_OBJ_FROM_PTR(results);
+}
+
+mp_obj_t carray_unary_op(mp_unary_op_t op, ndarray_obj_t *self) {
+    ndarray_obj_t *ndarray;
+    switch(op) {
+        #if NDARRAY_HAS_UNARY_OP_ABS
+        case MP_UNARY_OP_ABS:
+            // the absolute value of complexes is real
+            ndarray = ndarray_new_dense_ndarray(self->ndim, self->shape, NDARRAY_FLOAT);
+            if(self->len != 0) {
+                mp_float_t *buffer = m_new(mp_float_t, 2 * self->len);
+                carray_load(buffer, self, self->shape, self->strides);
+                mp_float_t *array = (mp_float_t *)ndarray->array;
+                for(size_t i = 0; i < self->len; i++) {
+                    array[i] = MICROPY_FLOAT_C_FUN(sqrt)(buffer[2 * i] * buffer[2 * i] + buffer[2 * i + 1] * buffer[2 * i + 1]);
+                }
+                m_del(mp_float_t, buffer, 2 * self->len);
+            }
+            return MP_OBJ_FROM_PTR(ndarray);
+            break;
+        #endif
+        #if NDARRAY_HAS_UNARY_OP_NEGATIVE
+        case MP_UNARY_OP_NEGATIVE:
+            ndarray = ndarray_copy_view(self); // from this point, this is a dense copy
+            mp_float_t *array = (mp_float_t *)ndarray->array;
+            for(size_t i = 0; i < 2 * ndarray->len; i++) {
+                array[i] = -array[i];
+            }
+            return MP_OBJ_FROM_PTR(ndarray);
+            break;
+        #endif
+        #if NDARRAY_HAS_UNARY_OP_POSITIVE
+        case MP_UNARY_OP_POSITIVE:
+            return MP_OBJ_FROM_PTR(ndarray_copy_view(self));
+        #endif
+        default:
+            return MP_OBJ_NULL; // operator not supported
+            break;
+    }
+}
+
+//| def complex(x: Optional[_float] = None, y: Optional[_float] = None) -> Union[_DType, complex]:
+//|     """
+//|     The complex dtype: without arguments, the dtype code is returned, otherwise,
+//|     complex(x, y) of python, i.e., a complex scalar."""
+//|     ...
+//|
+
+mp_obj_t carray_complex(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    (void)kw_args;
+    if(n_args == 0) {
+        return MP_OBJ_NEW_SMALL_INT(NDARRAY_COMPLEX);
+    }
+    return mp_call_function_n_kw(MP_OBJ_FROM_PTR(&mp_type_complex), n_args, 0, pos_args);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(carray_complex_obj, 0, carray_complex);
+
+static ndarray_obj_t *carray_input_array(mp_obj_t arg) {
+    if(!mp_obj_is_type(arg, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("input must be an ndarray"));
+    }
+    return MP_OBJ_TO_PTR(arg);
+}
+
+#if ULAB_NUMPY_HAS_CONJUGATE
+//| def conjugate(a: ulab.ndarray) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray a: an ndarray
+//|
+//|     Return the complex conjugate of a complex array, and a copy of a real array."""
+//|     ...
+//|
+
+mp_obj_t carray_conjugate(mp_obj_t arg) {
+    ndarray_obj_t *ndarray = ndarray_copy_view(carray_input_array(arg));
+    if(ndarray->dtype == NDARRAY_COMPLEX) {
+        mp_float_t *array = (mp_float_t *)ndarray->array;
+        for(size_t i = 0; i < ndarray->len; i++) {
+            array[2 * i + 1] = -array[2 * i + 1];
+        }
+    }
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(carray_conjugate_obj, carray_conjugate);
+#endif
+
+#if ULAB_NUMPY_HAS_IMAG || ULAB_NUMPY_HAS_REAL
+static mp_obj_t carray_real_imag(mp_obj_t arg, int32_t offset) {
+    // returns a float view of the real, or imaginary parts of a complex array
+    ndarray_obj_t *source = carray_input_array(arg);
+    ndarray_obj_t *ndarray = ndarray_new_view(source, source->ndim, source->shape, source->strides, offset);
+    ndarray->dtype = NDARRAY_FLOAT;
+    ndarray->itemsize = sizeof(mp_float_t);
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+#endif
+
+#if ULAB_NUMPY_HAS_IMAG
+//| def imag(a: ulab.ndarray) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray a: an ndarray
+//|
+//|     Return the imaginary parts of a complex array as a float view, or zeros, if the array is real."""
+//|     ...
+//|
+
+mp_obj_t carray_imag(mp_obj_t arg) {
+    ndarray_obj_t *source = carray_input_array(arg);
+    if(source->dtype != NDARRAY_COMPLEX) {
+        return MP_OBJ_FROM_PTR(ndarray_new_dense_ndarray(source->ndim, source->shape, source->boolean ? NDARRAY_BOOL : source->dtype));
+    }
+    return carray_real_imag(arg, sizeof(mp_float_t));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(carray_imag_obj, carray_imag);
+#endif
+
+#if ULAB_NUMPY_HAS_REAL
+//| def real(a: ulab.ndarray) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray a: an ndarray
+//|
+//|     Return the real parts of a complex array as a float view, or the array itself, if it is real."""
+//|     ...
+//|
+
+mp_obj_t carray_real(mp_obj_t arg) {
+    ndarray_obj_t *source = carray_input_array(arg);
+    if(source->dtype != NDARRAY_COMPLEX) {
+        return arg;
+    }
+    return carray_real_imag(arg, 0);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(carray_real_obj, carray_real);
+#endif
+
+#endif /* ULAB_SUPPORTS_COMPLEX */
@@ -0,0 +1,39 @@
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+*/
+
+#ifndef _CARRAY_
+#define _CARRAY_
+
+#include "../../ulab.h"
+#include "../../ndarray.h"
+
+#if ULAB_SUPPORTS_COMPLEX
+MP_DECLARE_CONST_FUN_OBJ_KW(carray_complex_obj);
+
+#if ULAB_NUMPY_HAS_CONJUGATE
+MP_DECLARE_CONST_FUN_OBJ_1(carray_conjugate_obj);
+#endif
+
+#if ULAB_NUMPY_HAS_IMAG
+MP_DECLARE_CONST_FUN_OBJ_1(carray_imag_obj);
+#endif
+
+#if ULAB_NUMPY_HAS_REAL
+MP_DECLARE_CONST_FUN_OBJ_1(carray_real_obj);
+#endif
+
+void carray_load(mp_float_t *, ndarray_obj_t *, size_t *, int32_t *);
+void carray_assign_view(ndarray_obj_t *, ndarray_obj_t *, size_t *, int32_t *, int32_t *);
+mp_obj_t carray_binary_op(mp_binary_op_t , ndarray_obj_t *, ndarray_obj_t *, uint8_t , size_t *, int32_t *, int32_t *);
+mp_obj_t carray_unary_op(mp_unary_op_t , ndarray_obj_t *);
+#endif /* ULAB_SUPPORTS_COMPLEX */
+
+#endif
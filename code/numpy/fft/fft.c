@@ -26,52 +26,169 @@
 //|
 
 
-//| def fft(r: ulab.ndarray, c: Optional[ulab.ndarray] = None) -> Tuple[ulab.ndarray, ulab.ndarray]:
+//| def fft(r: ulab.ndarray, c: Optional[ulab.ndarray] = None, *, plan: Optional[plan] = None, overwrite_x: bool = False, axis: int = -1) -> Union[Tuple[ulab.ndarray, ulab.ndarray], ulab.ndarray]:
 //|     """
-//|     :param ulab.ndarray r: A 1-dimension array of values whose size is a power of 2
-//|     :param ulab.ndarray c: An optional 1-dimension array of values whose size is a power of 2, giving the complex part of the value
-//|     :return tuple (r, c): The real and complex parts of the FFT
+//|     :param ulab.ndarray r: A 1- or 2-dimension array of real, or complex values
+//|     :param ulab.ndarray c: An optional array of values of the same shape as r, giving the complex part of the value, if r is real
+//|     :param plan: An optional plan of the length of the transform, as returned by ``plan``
+//|     :param bool overwrite_x: If True, r, and c are overwritten by the result, provided that they are dense float, or complex arrays
+//|     :param int axis: The axis, along which 2-dimension arrays are transformed
+//|     :return tuple (r, c): The real and complex parts of the FFT, or a single complex array, if r is complex
 //|
-//|     Perform a Fast Fourier Transform from the time domain into the frequency domain
+//|     Perform a Fast Fourier Transform from the time domain into the frequency domain.
+//|     Lengths with the prime factors 2, 3, and 5 only are transformed by a mixed-radix
+//|     algorithm, all other lengths by Bluestein's algorithm, which is slower by a factor
+//|     of a few, but still takes O(n log n) operations. If the firmware was compiled
+//|     without ``ULAB_FFT_HAS_MIXED_RADIX``, the length must be a power of 2.
 //|
 //|     See also ~ulab.extras.spectrum, which computes the magnitude of the fft,
 //|     rather than separately returning its real and imaginary parts."""
 //|     ...
 //|
-static mp_obj_t fft_fft(size_t n_args, const mp_obj_t *args) {
-    if(n_args == 2) {
-        return fft_fft_ifft_spectrogram(n_args, args[0], args[1], FFT_FFT);
-    } else {
-        return fft_fft_ifft_spectrogram(n_args, args[0], mp_const_none, FFT_FFT);
-    }
+static mp_obj_t fft_fft(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_, MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_plan, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_overwrite_x, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false } },
+        { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1 } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    n_args = args[1].u_obj == mp_const_none ? 1 : 2;
+    return fft_fft_ifft_spectrogram(n_args, args[0].u_obj, args[1].u_obj, args[2].u_obj, args[3].u_bool, args[4].u_int, FFT_FFT);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fft_fft_obj, 1, 2, fft_fft);
+MP_DEFINE_CONST_FUN_OBJ_KW(fft_fft_obj, 1, fft_fft);
 
-//| def ifft(r: ulab.ndarray, c: Optional[ulab.ndarray] = None) -> Tuple[ulab.ndarray, ulab.ndarray]:
+//| def ifft(r: ulab.ndarray, c: Optional[ulab.ndarray] = None, *, plan: Optional[plan] = None, overwrite_x: bool = False, axis: int = -1) -> Union[Tuple[ulab.ndarray, ulab.ndarray], ulab.ndarray]:
 //|     """
-//|     :param ulab.ndarray r: A 1-dimension array of values whose size is a power of 2
-//|     :param ulab.ndarray c: An optional 1-dimension array of values whose size is a power of 2, giving the complex part of the value
-//|     :return tuple (r, c): The real and complex parts of the inverse FFT
+//|     :param ulab.ndarray r: A 1- or 2-dimension array of real, or complex values
+//|     :param ulab.ndarray c: An optional array of values of the same shape as r, giving the complex part of the value, if r is real
+//|     :param plan: An optional plan of the length of the transform, as returned by ``plan``
+//|     :param bool overwrite_x: If True, r, and c are overwritten by the result, provided that they are dense float, or complex arrays
+//|     :param int axis: The axis, along which 2-dimension arrays are transformed
+//|     :return tuple (r, c): The real and complex parts of the inverse FFT, or a single complex array, if r is complex
 //|
 //|     Perform an Inverse Fast Fourier Transform from the frequeny domain into the time domain"""
 //|     ...
 //|
 
-static mp_obj_t fft_ifft(size_t n_args, const mp_obj_t *args) {
-    if(n_args == 2) {
-        return fft_fft_ifft_spectrogram(n_args, args[0], args[1], FFT_IFFT);
-    } else {
-        return fft_fft_ifft_spectrogram(n_args, args[0], mp_const_none, FFT_IFFT);
+static mp_obj_t fft_ifft(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_, MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_plan, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_overwrite_x, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false } },
+        { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1 } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    n_args = args[1].u_obj == mp_const_none ? 1 : 2;
+    return fft_fft_ifft_spectrogram(n_args, args[0].u_obj, args[1].u_obj, args[2].u_obj, args[3].u_bool, args[4].u_int, FFT_IFFT);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(fft_ifft_obj, 1, fft_ifft);
+
+#if ULAB_FFT_HAS_RFFT
+//| def rfft(r: ulab.ndarray, *, plan: Optional[plan] = None) -> Tuple[ulab.ndarray, ulab.ndarray]:
+//|     """
+//|     :param ulab.ndarray r: A 1-dimension array of real values
+//|     :param plan: An optional plan of the same length as r, as returned by ``plan``
+//|     :return tuple (r, c): The real and complex parts of the non-negative frequency terms of the FFT
+//|
+//|     Perform a Fast Fourier Transform of a real signal. Since the transform of a real
+//|     signal is Hermitian-symmetric, only the len(r)//2 + 1 non-redundant terms are returned.
+//|     If the length is even, the input is packed into a complex array of half the length,
+//|     hence, the transform is about twice as fast, and needs half the memory of ``fft``."""
+//|     ...
+//|
+
+static mp_obj_t fft_rfft(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_plan, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return fft_rfft_irfft(args[0].u_obj, mp_const_none, args[1].u_obj, FFT_RFFT);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(fft_rfft_obj, 1, fft_rfft);
+#endif
+
+#if ULAB_FFT_HAS_IRFFT
+//| def irfft(r: ulab.ndarray, c: Optional[ulab.ndarray] = None, *, plan: Optional[plan] = None) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray r: The real parts, or the complex values of the non-negative frequency terms
+//|     :param ulab.ndarray c: The optional imaginary parts of the non-negative frequency terms, if r is real
+//|     :param plan: An optional plan of the length of the output, as returned by ``plan``
+//|     :return ulab.ndarray: The real signal of length 2 * (len(r) - 1)
+//|
+//|     Perform the inverse of ``rfft``."""
+//|     ...
+//|
+
+static mp_obj_t fft_irfft(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_, MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_plan, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return fft_rfft_irfft(args[0].u_obj, args[1].u_obj, args[2].u_obj, FFT_IRFFT);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(fft_irfft_obj, 1, fft_irfft);
+#endif
+
+#if ULAB_FFT_HAS_PLAN
+//| def plan(n: int) -> plan:
+//|     """
+//|     :param int n: The length of the transform
+//|
+//|     Return a plan holding the twiddle factors, and the bit-reversal permutation, or
+//|     the scratch buffer of a transform of length n. The plan can be passed to ``fft``, ``ifft``, and
+//|     ``scipy.signal.spectrogram``, so that the tables are not re-calculated in each call."""
+//|     ...
+//|
+
+static mp_obj_t fft_plan(mp_obj_t n) {
+    mp_int_t len = mp_obj_get_int(n);
+    if(len < 1) {
+        mp_raise_ValueError(translate("invalid number of FFT data points"));
     }
+    fft_check_length((size_t)len);
+    fft_plan_obj_t *plan = m_new_obj(fft_plan_obj_t);
+    fft_plan_init(plan, (size_t)len, true);
+    return MP_OBJ_FROM_PTR(plan);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fft_ifft_obj, 1, 2, fft_ifft);
+MP_DEFINE_CONST_FUN_OBJ_1(fft_plan_obj, fft_plan);
+#endif
 
 STATIC const mp_rom_map_elem_t ulab_fft_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_fft) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_fft), (mp_obj_t)&fft_fft_obj },
     { MP_OBJ_NEW_QSTR(MP_QSTR_ifft), (mp_obj_t)&fft_ifft_obj },
+    #if ULAB_FFT_HAS_IRFFT
+    { MP_OBJ_NEW_QSTR(MP_QSTR_irfft), (mp_obj_t)&fft_irfft_obj },
+    #endif
+    #if ULAB_FFT_HAS_PLAN
+    { MP_OBJ_NEW_QSTR(MP_QSTR_plan), (mp_obj_t)&fft_plan_obj },
+    #endif
+    #if ULAB_FFT_HAS_RFFT
+    { MP_OBJ_NEW_QSTR(MP_QSTR_rfft), (mp_obj_t)&fft_rfft_obj },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_ulab_fft_globals, ulab_fft_globals_table);
@@ -19,6 +19,9 @@
 
 extern mp_obj_module_t ulab_fft_module;
 
-MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(fft_fft_obj);
-MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(fft_ifft_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(fft_fft_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(fft_ifft_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(fft_irfft_obj);
+MP_DECLARE_CONST_FUN_OBJ_1(fft_plan_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(fft_rfft_obj);
 #endif
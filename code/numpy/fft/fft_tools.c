@@ -22,144 +22,1007 @@
 #define MP_E MICROPY_FLOAT_CONST(2.71828182845904523536)
 #endif
 
+#if ULAB_FFT_HAS_TWIDDLE_TABLE
+#include "fft_twiddle.h"
+#endif
+
+static void fft_plan_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    (void)kind;
+    fft_plan_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "plan(%d)", self->n);
+}
+
+const mp_obj_type_t fft_plan_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_plan,
+    .print = fft_plan_print,
+};
+
+void fft_check_length(size_t n) {
+    if(n == 0) {
+        mp_raise_ValueError(translate("invalid number of FFT data points"));
+    }
+    #if !ULAB_FFT_HAS_MIXED_RADIX
+    if((n & (n - 1)) != 0) {
+        mp_raise_ValueError(translate("input array length must be power of 2"));
+    }
+    #endif
+}
+
+#if ULAB_FFT_HAS_MIXED_RADIX
+static bool fft_plan_factorise(fft_plan_obj_t *plan, size_t n) {
+    // splits n into the radices 4, 2, 3, and 5; returns false, if there is another prime factor
+    plan->nfactors = 0;
+    const uint8_t radices[] = { 4, 2, 3, 5 };
+    for(uint8_t i = 0; i < 4; i++) {
+        while((n > 1) && (n % radices[i] == 0)) {
+            plan->factors[plan->nfactors++] = radices[i];
+            n /= radices[i];
+        }
+    }
+    return n <= 1;
+}
+#endif
+
+static mp_float_t *fft_twiddle_factors(size_t n, size_t len) {
+    // returns the pairs cos(2 pi k / n), sin(2 pi k / n) for k < len; the factors are
+    // calculated directly, i.e., without a recurrence, so that the errors do not accumulate
+    mp_float_t *twiddle = m_new(mp_float_t, 2 * len);
+    for(size_t k = 0; k < len; k++) {
+        mp_float_t theta = MICROPY_FLOAT_CONST(2.0) * MP_PI * (mp_float_t)k / (mp_float_t)n;
+        twiddle[2 * k] = MICROPY_FLOAT_C_FUN(cos)(theta);
+        twiddle[2 * k + 1] = MICROPY_FLOAT_C_FUN(sin)(theta);
+    }
+    return twiddle;
+}
+
+/*
+ * The following function fills in the tables of a plan of length n.
+ *
+ * If n is a power of 2, the in-place radix-2 kernel is used. Its twiddle factors
+ * are taken from the pre-computed table, if the transform is not longer than the
+ * table. If persistent is true, the bit-reversal permutation is also tabulated.
+ *
+ * If n is a product of the powers of 2, 3, and 5, the transform is calculated by
+ * the mixed-radix Stockham algorithm, which needs a scratch buffer of length n.
+ *
+ * Otherwise, the transform is re-written as a convolution (Bluestein's algorithm),
+ * which is then calculated by means of a power-of-two transform.
+ */
+
+void fft_plan_init(fft_plan_obj_t *plan, size_t n, bool persistent) {
+    plan->base.type = &fft_plan_type;
+    plan->n = n;
+    plan->stride = 1;
+    plan->twiddle = NULL;
+    plan->bitrev = NULL;
+    plan->bitrev_shift = 0;
+    plan->nfactors = 0;
+    plan->scratch = NULL;
+    plan->bluestein = NULL;
+    plan->chirp = NULL;
+    plan->kernel = NULL;
+
+    if((n & (n - 1)) == 0) {
+        plan->type = FFT_PLAN_RADIX2;
+        #if ULAB_FFT_HAS_TWIDDLE_TABLE
+        if(n <= FFT_TWIDDLE_TABLE_LEN) {
+            plan->twiddle = fft_twiddle_table;
+            plan->stride = n == 0 ? 1 : FFT_TWIDDLE_TABLE_LEN / n;
+        } else {
+        #endif
+            plan->twiddle = fft_twiddle_factors(n, n / 2);
+        #if ULAB_FFT_HAS_TWIDDLE_TABLE
+        }
+        #endif
+
+        if(persistent && (n <= 65536)) {
+            plan->bitrev = m_new(uint16_t, n);
+            size_t j = 0, m;
+            for(size_t i = 0; i < n; i++) {
+                plan->bitrev[i] = (uint16_t)j;
+                m = n >> 1;
+                while (j >= m && m > 0) {
+                    j -= m;
+                    m >>= 1;
+                }
+                j += m;
+            }
+        }
+    }
+    #if ULAB_FFT_HAS_MIXED_RADIX
+    else if(fft_plan_factorise(plan, n)) {
+        plan->type = FFT_PLAN_MIXED_RADIX;
+        plan->twiddle = fft_twiddle_factors(n, n);
+        plan->scratch = m_new(mp_float_t, 2 * n);
+    } else {
+        plan->type = FFT_PLAN_BLUESTEIN;
+        size_t M = 1;
+        while(M < 2 * n - 1) {
+            M <<= 1;
+        }
+        plan->bluestein = m_new_obj(fft_plan_obj_t);
+        fft_plan_init(plan->bluestein, M, persistent);
+
+        // the chirp exp(i pi k^2 / n); k^2 is reduced modulo 2n, so that the argument remains small
+        plan->chirp = m_new(mp_float_t, 2 * n);
+        for(size_t k = 0; k < n; k++) {
+            size_t k2 = (size_t)(((uint64_t)k * k) % (2 * n));
+            mp_float_t theta = MP_PI * (mp_float_t)k2 / (mp_float_t)n;
+            plan->chirp[2 * k] = MICROPY_FLOAT_C_FUN(cos)(theta);
+            plan->chirp[2 * k + 1] = MICROPY_FLOAT_C_FUN(sin)(theta);
+        }
+
+        // the transform of the convolution kernel, i.e., of the chirp, wrapped around
+        mp_float_t *kr = m_new0(mp_float_t, 2 * M);
+        mp_float_t *ki = kr + M;
+        kr[0] = plan->chirp[0];
+        ki[0] = plan->chirp[1];
+        for(size_t k = 1; k < n; k++) {
+            kr[k] = kr[M - k] = plan->chirp[2 * k];
+            ki[k] = ki[M - k] = plan->chirp[2 * k + 1];
+        }
+        fft_plan_kernel(plan->bluestein, kr, ki, 1);
+        plan->kernel = kr;
+        plan->scratch = m_new(mp_float_t, 2 * M);
+    }
+    #endif
+}
+
+void fft_plan_free(fft_plan_obj_t *plan) {
+    // releases the tables that are not in read-only memory
+    if(plan->type == FFT_PLAN_RADIX2) {
+        #if ULAB_FFT_HAS_TWIDDLE_TABLE
+        if(plan->twiddle != fft_twiddle_table) {
+            m_del(mp_float_t, (mp_float_t *)plan->twiddle, plan->n);
+        }
+        #else
+        m_del(mp_float_t, (mp_float_t *)plan->twiddle, plan->n);
+        #endif
+        if(plan->bitrev != NULL) {
+            m_del(uint16_t, plan->bitrev, plan->n);
+        }
+    }
+    #if ULAB_FFT_HAS_MIXED_RADIX
+    else if(plan->type == FFT_PLAN_MIXED_RADIX) {
+        m_del(mp_float_t, (mp_float_t *)plan->twiddle, 2 * plan->n);
+        m_del(mp_float_t, plan->scratch, 2 * plan->n);
+    } else {
+        size_t M = plan->bluestein->n;
+        fft_plan_free(plan->bluestein);
+        m_del_obj(fft_plan_obj_t, plan->bluestein);
+        m_del(mp_float_t, plan->chirp, 2 * plan->n);
+        m_del(mp_float_t, plan->kernel, 2 * M);
+        m_del(mp_float_t, plan->scratch, 2 * M);
+    }
+    #endif
+}
+
 /*
  * The following function takes two arrays, namely, the real and imaginary
  * parts of a complex array, and calculates the Fourier transform in place.
  *
- * The function is basically a modification of four1 from Numerical Recipes,
- * has no dependencies beyond micropython itself (for the definition of mp_float_t),
- * and can be used independent of ulab.
+ * The input is permuted as in four1 from Numerical Recipes, but the butterflies
+ * are radix-4, and the twiddle factors are looked up in the tables of the plan,
+ * instead of being calculated by means of a trigonometric recurrence.
  */
 
-void fft_kernel(mp_float_t *real, mp_float_t *imag, size_t n, int isign) {
+static void fft_radix4_kernel(fft_plan_obj_t *plan, mp_float_t *real, mp_float_t *imag, int isign) {
+    size_t n = plan->n;
     size_t j, m, mmax, istep;
-    mp_float_t tempr, tempi;
-    mp_float_t wtemp, wr, wpr, wpi, wi, theta;
+    mp_float_t tempr, tempi, wr, wi;
 
-    j = 0;
-    for(size_t i = 0; i < n; i++) {
-        if (j > i) {
-            SWAP(mp_float_t, real[i], real[j]);
-            SWAP(mp_float_t, imag[i], imag[j]);
+    if(plan->bitrev != NULL) {
+        for(size_t i = 0; i < n; i++) {
+            j = plan->bitrev[i] >> plan->bitrev_shift;
+            if (j > i) {
+                SWAP(mp_float_t, real[i], real[j]);
+                SWAP(mp_float_t, imag[i], imag[j]);
+            }
         }
-        m = n >> 1;
-        while (j >= m && m > 0) {
-            j -= m;
-            m >>= 1;
+    } else {
+        j = 0;
+        for(size_t i = 0; i < n; i++) {
+            if (j > i) {
+                SWAP(mp_float_t, real[i], real[j]);
+                SWAP(mp_float_t, imag[i], imag[j]);
+            }
+            m = n >> 1;
+            while (j >= m && m > 0) {
+                j -= m;
+                m >>= 1;
+            }
+            j += m;
         }
-        j += m;
     }
 
+    mp_float_t sign = isign > 0 ? MICROPY_FLOAT_CONST(-1.0) : MICROPY_FLOAT_CONST(1.0);
     mmax = 1;
+    // if n is not a power of 4, a single radix-2 stage, which needs no multiplications, comes first
+    for(m = 1; m < n; m <<= 2);
+    if(m != n) {
+        for(size_t i = 0; i < n; i += 2) {
+            tempr = real[i + 1];
+            tempi = imag[i + 1];
+            real[i + 1] = real[i] - tempr;
+            imag[i + 1] = imag[i] - tempi;
+            real[i] += tempr;
+            imag[i] += tempi;
+        }
+        mmax = 2;
+    }
+
+    // Each of the following stages fuses two radix-2 stages, and combines four transforms
+    // of length mmax. With w = exp(-isign * 2 pi i m / istep), the inputs are multiplied by
+    // w^2, w, and w^3, and the twiddle factor w^2 exp(-isign * i pi / 2) of the second radix-2
+    // stage is a multiplication by -isign * i only, hence, three complex multiplications
+    // are required in place of the four of the radix-2 kernel.
+    mp_float_t w2r, w2i, w3r, w3i;
+    mp_float_t t1r, t1i, t2r, t2i, t3r, t3i;
     while (n > mmax) {
-        istep = mmax << 1;
-        theta = MICROPY_FLOAT_CONST(-2.0)*isign*MP_PI/istep;
-        wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
-        wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
-        wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
-        wr = MICROPY_FLOAT_CONST(1.0);
-        wi = MICROPY_FLOAT_CONST(0.0);
+        istep = mmax << 2;
+        // w is every (n / istep)-th factor of the plan
+        size_t tstep = plan->stride * (n / istep);
         for(m = 0; m < mmax; m++) {
+            const mp_float_t *twiddle = plan->twiddle + 2 * m * tstep;
+            wr = twiddle[0];
+            wi = sign * twiddle[1];
+            twiddle += 2 * m * tstep;
+            w2r = twiddle[0];
+            w2i = sign * twiddle[1];
+            w3r = wr * w2r - wi * w2i;
+            w3i = wr * w2i + wi * w2r;
             for(size_t i = m; i < n; i += istep) {
-                j = i + mmax;
-                tempr = wr * real[j] - wi * imag[j];
-                tempi = wr * imag[j] + wi * real[j];
-                real[j] = real[i] - tempr;
-                imag[j] = imag[i] - tempi;
-                real[i] += tempr;
-                imag[i] += tempi;
-            }
-            wtemp = wr;
-            wr = wr*wpr - wi*wpi + wr;
-            wi = wi*wpr + wtemp*wpi + wi;
+                size_t i1 = i + mmax;
+                size_t i2 = i1 + mmax;
+                size_t i3 = i2 + mmax;
+                t1r = w2r * real[i1] - w2i * imag[i1];
+                t1i = w2r * imag[i1] + w2i * real[i1];
+                t2r = wr * real[i2] - wi * imag[i2];
+                t2i = wr * imag[i2] + wi * real[i2];
+                t3r = w3r * real[i3] - w3i * imag[i3];
+                t3i = w3r * imag[i3] + w3i * real[i3];
+
+                mp_float_t s0r = real[i] + t1r, s0i = imag[i] + t1i;
+                mp_float_t d0r = real[i] - t1r, d0i = imag[i] - t1i;
+                mp_float_t s1r = t2r + t3r, s1i = t2i + t3i;
+                // (t2 - t3) multiplied by -isign * i
+                tempr = -sign * (t2i - t3i);
+                tempi = sign * (t2r - t3r);
+
+                real[i] = s0r + s1r;
+                imag[i] = s0i + s1i;
+                real[i2] = s0r - s1r;
+                imag[i2] = s0i - s1i;
+                real[i1] = d0r + tempr;
+                imag[i1] = d0i + tempi;
+                real[i3] = d0r - tempr;
+                imag[i3] = d0i - tempi;
+            }
         }
         mmax = istep;
     }
 }
 
+#if ULAB_FFT_HAS_MIXED_RADIX
+// the sines of 60, 72, and 144 degrees, and the cosines of 72, and 144 degrees
+#define FFT_S3  MICROPY_FLOAT_CONST(0.86602540378443864676)
+#define FFT_C51 MICROPY_FLOAT_CONST(0.30901699437494742410)
+#define FFT_C52 MICROPY_FLOAT_CONST(-0.80901699437494742410)
+#define FFT_S51 MICROPY_FLOAT_CONST(0.95105651629515357212)
+#define FFT_S52 MICROPY_FLOAT_CONST(0.58778525229247312917)
+
+static void fft_butterfly(uint8_t radix, mp_float_t *ar, mp_float_t *ai, mp_float_t sign) {
+    // the in-place DFT of length 2, 3, 4, or 5; with sign = -1, the forward transform is calculated
+    mp_float_t tr, ti;
+    if(radix == 2) {
+        tr = ar[1];
+        ti = ai[1];
+        ar[1] = ar[0] - tr;
+        ai[1] = ai[0] - ti;
+        ar[0] += tr;
+        ai[0] += ti;
+    } else if(radix == 4) {
+        mp_float_t s0r = ar[0] + ar[2], s0i = ai[0] + ai[2];
+        mp_float_t d0r = ar[0] - ar[2], d0i = ai[0] - ai[2];
+        mp_float_t s1r = ar[1] + ar[3], s1i = ai[1] + ai[3];
+        // (a1 - a3) multiplied by sign * i
+        mp_float_t d1r = -sign * (ai[1] - ai[3]), d1i = sign * (ar[1] - ar[3]);
+        ar[0] = s0r + s1r;
+        ai[0] = s0i + s1i;
+        ar[2] = s0r - s1r;
+        ai[2] = s0i - s1i;
+        ar[1] = d0r + d1r;
+        ai[1] = d0i + d1i;
+        ar[3] = d0r - d1r;
+        ai[3] = d0i - d1i;
+    } else if(radix == 3) {
+        mp_float_t sr = ar[1] + ar[2], si = ai[1] + ai[2];
+        mp_float_t dr = sign * FFT_S3 * (ar[1] - ar[2]), di = sign * FFT_S3 * (ai[1] - ai[2]);
+        tr = ar[0] - MICROPY_FLOAT_CONST(0.5) * sr;
+        ti = ai[0] - MICROPY_FLOAT_CONST(0.5) * si;
+        ar[0] += sr;
+        ai[0] += si;
+        ar[1] = tr - di;
+        ai[1] = ti + dr;
+        ar[2] = tr + di;
+        ai[2] = ti - dr;
+    } else { // radix 5
+        mp_float_t s1r = ar[1] + ar[4], s1i = ai[1] + ai[4];
+        mp_float_t s2r = ar[2] + ar[3], s2i = ai[2] + ai[3];
+        mp_float_t d1r = ar[1] - ar[4], d1i = ai[1] - ai[4];
+        mp_float_t d2r = ar[2] - ar[3], d2i = ai[2] - ai[3];
+        mp_float_t c1r = ar[0] + FFT_C51 * s1r + FFT_C52 * s2r;
+        mp_float_t c1i = ai[0] + FFT_C51 * s1i + FFT_C52 * s2i;
+        mp_float_t c2r = ar[0] + FFT_C52 * s1r + FFT_C51 * s2r;
+        mp_float_t c2i = ai[0] + FFT_C52 * s1i + FFT_C51 * s2i;
+        // the odd parts, multiplied by sign * i
+        mp_float_t e1r = -sign * (FFT_S51 * d1i + FFT_S52 * d2i);
+        mp_float_t e1i = sign * (FFT_S51 * d1r + FFT_S52 * d2r);
+        mp_float_t e2r = -sign * (FFT_S52 * d1i - FFT_S51 * d2i);
+        mp_float_t e2i = sign * (FFT_S52 * d1r - FFT_S51 * d2r);
+        ar[0] += s1r + s2r;
+        ai[0] += s1i + s2i;
+        ar[1] = c1r + e1r;
+        ai[1] = c1i + e1i;
+        ar[4] = c1r - e1r;
+        ai[4] = c1i - e1i;
+        ar[2] = c2r + e2r;
+        ai[2] = c2i + e2i;
+        ar[3] = c2r - e2r;
+        ai[3] = c2i - e2i;
+    }
+}
+
 /*
- * The following function is a helper interface to the python side.
- * It has been factored out from fft.c, so that the same argument parsing
- * routine can be called from scipy.signal.spectrogram.
+ * The mixed-radix kernel is the self-sorting Stockham algorithm: in each stage,
+ * transforms of length r are calculated on elements that are n/r apart, and the
+ * results are multiplied by the twiddle factors, and written to the other buffer
+ * in the order required by the next stage, so that no permutation is necessary.
  */
 
-mp_obj_t fft_fft_ifft_spectrogram(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_im, uint8_t type) {
-    if(!mp_obj_is_type(arg_re, &ulab_ndarray_type)) {
-        mp_raise_NotImplementedError(translate("FFT is defined for ndarrays only"));
+static void fft_mixed_radix_kernel(fft_plan_obj_t *plan, mp_float_t *real, mp_float_t *imag, int isign) {
+    size_t N = plan->n;
+    mp_float_t *xr = real, *xi = imag;
+    mp_float_t *yr = plan->scratch, *yi = plan->scratch + N;
+    mp_float_t sign = isign > 0 ? MICROPY_FLOAT_CONST(-1.0) : MICROPY_FLOAT_CONST(1.0);
+    mp_float_t ar[5], ai[5], wr[5], wi[5];
+    size_t n = N, s = 1;
+
+    for(uint8_t f = 0; f < plan->nfactors; f++) {
+        uint8_t r = plan->factors[f];
+        size_t m = n / r;
+        for(size_t p = 0; p < m; p++) {
+            // the twiddle factors exp(-isign * 2 pi i p u / n) do not depend on q
+            for(uint8_t u = 0; u < r; u++) {
+                const mp_float_t *twiddle = plan->twiddle + 2 * p * u * s * plan->stride;
+                wr[u] = twiddle[0];
+                wi[u] = sign * twiddle[1];
+            }
+            for(size_t q = 0; q < s; q++) {
+                for(uint8_t t = 0; t < r; t++) {
+                    ar[t] = xr[q + s * (p + t * m)];
+                    ai[t] = xi[q + s * (p + t * m)];
+                }
+                fft_butterfly(r, ar, ai, sign);
+                mp_float_t *_yr = yr + q + s * r * p;
+                mp_float_t *_yi = yi + q + s * r * p;
+                _yr[0] = ar[0];
+                _yi[0] = ai[0];
+                for(uint8_t u = 1; u < r; u++) {
+                    _yr[s * u] = ar[u] * wr[u] - ai[u] * wi[u];
+                    _yi[s * u] = ar[u] * wi[u] + ai[u] * wr[u];
+                }
+            }
+        }
+        SWAP(mp_float_t *, xr, yr);
+        SWAP(mp_float_t *, xi, yi);
+        n = m;
+        s *= r;
     }
-    if(n_args == 2) {
-        if(!mp_obj_is_type(arg_im, &ulab_ndarray_type)) {
-            mp_raise_NotImplementedError(translate("FFT is defined for ndarrays only"));
+    if(xr != real) {
+        memcpy(real, xr, N * sizeof(mp_float_t));
+        memcpy(imag, xi, N * sizeof(mp_float_t));
+    }
+}
+
+/*
+ * Bluestein's algorithm: with nk = (k^2 + n^2 - (k - n)^2) / 2, the transform becomes
+ * X[k] = conj(w[k]) sum_n (x[n] conj(w[n])) w[k - n], where w[k] = exp(i pi k^2 / N),
+ * i.e., a convolution, which can be calculated by a power-of-two transform of length
+ * M >= 2N - 1. The transform of the convolution kernel is stored in the plan.
+ */
+
+static void fft_bluestein_kernel(fft_plan_obj_t *plan, mp_float_t *real, mp_float_t *imag, int isign) {
+    size_t N = plan->n;
+    size_t M = plan->bluestein->n;
+    mp_float_t *ar = plan->scratch, *ai = plan->scratch + M;
+    mp_float_t sign = isign > 0 ? MICROPY_FLOAT_CONST(-1.0) : MICROPY_FLOAT_CONST(1.0);
+    const mp_float_t *chirp = plan->chirp;
+
+    // a[k] = x[k] exp(-isign i pi k^2 / N), zero-padded to length M
+    for(size_t k = 0; k < N; k++) {
+        mp_float_t cr = chirp[2 * k], ci = sign * chirp[2 * k + 1];
+        ar[k] = real[k] * cr - imag[k] * ci;
+        ai[k] = real[k] * ci + imag[k] * cr;
+    }
+    memset(ar + N, 0, (M - N) * sizeof(mp_float_t));
+    memset(ai + N, 0, (M - N) * sizeof(mp_float_t));
+
+    fft_plan_kernel(plan->bluestein, ar, ai, 1);
+    // the kernel of the inverse transform is the complex conjugate of the forward kernel,
+    // whose transform is conj(K[M-k])
+    const mp_float_t *kr = plan->kernel, *ki = plan->kernel + M;
+    for(size_t k = 0; k < M; k++) {
+        mp_float_t br, bi;
+        if(isign > 0) {
+            br = kr[k];
+            bi = ki[k];
+        } else {
+            size_t j = k == 0 ? 0 : M - k;
+            br = kr[j];
+            bi = -ki[j];
         }
+        mp_float_t tr = ar[k] * br - ai[k] * bi;
+        ai[k] = ar[k] * bi + ai[k] * br;
+        ar[k] = tr;
     }
-    ndarray_obj_t *re = MP_OBJ_TO_PTR(arg_re);
+    fft_plan_kernel(plan->bluestein, ar, ai, -1);
+
+    for(size_t k = 0; k < N; k++) {
+        mp_float_t cr = chirp[2 * k] / M, ci = sign * chirp[2 * k + 1] / M;
+        real[k] = ar[k] * cr - ai[k] * ci;
+        imag[k] = ar[k] * ci + ai[k] * cr;
+    }
+}
+
+#endif /* ULAB_FFT_HAS_MIXED_RADIX */
+
+void fft_plan_kernel(fft_plan_obj_t *plan, mp_float_t *real, mp_float_t *imag, int isign) {
+    #if ULAB_FFT_HAS_MIXED_RADIX
+    if(plan->type == FFT_PLAN_MIXED_RADIX) {
+        fft_mixed_radix_kernel(plan, real, imag, isign);
+        return;
+    } else if(plan->type == FFT_PLAN_BLUESTEIN) {
+        fft_bluestein_kernel(plan, real, imag, isign);
+        return;
+    }
+    #endif
+    fft_radix4_kernel(plan, real, imag, isign);
+}
+
+static void fft_plan_half(fft_plan_obj_t *plan, fft_plan_obj_t *half) {
+    // the transform of half the length uses every second twiddle factor of
+    // the plan, and the same bit-reversal table, or scratch buffer
+    *half = *plan;
+    half->n = plan->n / 2;
+    half->stride = plan->stride * 2;
+    half->bitrev_shift = plan->bitrev_shift + 1;
+    #if ULAB_FFT_HAS_MIXED_RADIX
+    if(plan->type == FFT_PLAN_MIXED_RADIX) {
+        fft_plan_factorise(half, half->n);
+    }
+    #endif
+}
+
+/*
+ * The transform of a real sequence x of length n is calculated by packing the even
+ * and odd samples into the real and imaginary parts of a complex sequence z of
+ * length N = n/2, so that the transform of x can be assembled from the transform
+ * of z as X[k] = E[k] + W^k O[k], where W = exp(-2 pi i / n), and E, and O are the
+ * transforms of the even, and odd samples:
+ *
+ * E[k] = (Z[k] + conj(Z[N-k])) / 2, O[k] = (Z[k] - conj(Z[N-k])) / 2i
+ *
+ * On entry, real[k] = x[2k], and imag[k] = x[2k+1] for k < N; on exit, the arrays
+ * hold the non-redundant bins 0...N, hence, they must be of length N + 1.
+ *
+ * n must be even, and the plan must not be a Bluestein plan, see fft_real_full below.
+ */
+
+void fft_rfft_kernel(fft_plan_obj_t *plan, mp_float_t *real, mp_float_t *imag) {
+    size_t N = plan->n / 2;
+    if(N == 0) {
+        imag[0] = MICROPY_FLOAT_CONST(0.0);
+        return;
+    }
+    fft_plan_obj_t half;
+    fft_plan_half(plan, &half);
+    fft_plan_kernel(&half, real, imag, 1);
+
+    mp_float_t zr = real[0];
+    mp_float_t zi = imag[0];
+    real[0] = zr + zi;
+    imag[0] = MICROPY_FLOAT_CONST(0.0);
+    real[N] = zr - zi;
+    imag[N] = MICROPY_FLOAT_CONST(0.0);
+
+    // the bins k, and N - k are calculated in the same step
+    const mp_float_t *twiddle = plan->twiddle;
+    for(size_t k = 1; k <= N / 2; k++) {
+        twiddle += 2 * plan->stride;
+        mp_float_t c = twiddle[0];
+        mp_float_t s = twiddle[1];
+        mp_float_t ar = real[k], ai = imag[k];
+        mp_float_t br = real[N - k], bi = imag[N - k];
+        mp_float_t er = MICROPY_FLOAT_CONST(0.5) * (ar + br);
+        mp_float_t ei = MICROPY_FLOAT_CONST(0.5) * (ai - bi);
+        mp_float_t odd_r = MICROPY_FLOAT_CONST(0.5) * (ai + bi);
+        mp_float_t odd_i = MICROPY_FLOAT_CONST(-0.5) * (ar - br);
+        // t = W^k O[k]
+        mp_float_t tr = c * odd_r + s * odd_i;
+        mp_float_t ti = c * odd_i - s * odd_r;
+        real[k] = er + tr;
+        imag[k] = ei + ti;
+        // X[N-k] = conj(E[k] - t)
+        real[N - k] = er - tr;
+        imag[N - k] = ti - ei;
+    }
+}
+
+/*
+ * The inverse of fft_rfft_kernel: on entry, the arrays hold the bins 0...N of the
+ * transform, and on exit, real[k] = x[2k], and imag[k] = x[2k+1] for k < N. As in
+ * numpy, the imaginary parts of the first, and last bins are ignored.
+ */
+
+void fft_irfft_kernel(fft_plan_obj_t *plan, mp_float_t *real, mp_float_t *imag) {
+    size_t N = plan->n / 2;
+    if(N == 0) {
+        return;
+    }
+    mp_float_t x0 = real[0];
+    mp_float_t xN = real[N];
+    real[0] = MICROPY_FLOAT_CONST(0.5) * (x0 + xN);
+    imag[0] = MICROPY_FLOAT_CONST(0.5) * (x0 - xN);
+
+    const mp_float_t *twiddle = plan->twiddle;
+    for(size_t k = 1; k <= N / 2; k++) {
+        twiddle += 2 * plan->stride;
+        mp_float_t c = twiddle[0];
+        mp_float_t s = twiddle[1];
+        mp_float_t ar = real[k], ai = imag[k];
+        mp_float_t br = real[N - k], bi = imag[N - k];
+        // E[k] = (X[k] + conj(X[N-k])) / 2, and W^k O[k] = (X[k] - conj(X[N-k])) / 2
+        mp_float_t er = MICROPY_FLOAT_CONST(0.5) * (ar + br);
+        mp_float_t ei = MICROPY_FLOAT_CONST(0.5) * (ai - bi);
+        mp_float_t dr = MICROPY_FLOAT_CONST(0.5) * (ar - br);
+        mp_float_t di = MICROPY_FLOAT_CONST(0.5) * (ai + bi);
+        mp_float_t odd_r = dr * c - di * s;
+        mp_float_t odd_i = dr * s + di * c;
+        // Z[k] = E[k] + i O[k], and Z[N-k] = conj(E[k]) + i conj(O[k])
+        real[k] = er - odd_i;
+        imag[k] = ei + odd_r;
+        real[N - k] = er + odd_i;
+        imag[N - k] = odd_r - ei;
+    }
+
+    fft_plan_obj_t half;
+    fft_plan_half(plan, &half);
+    fft_plan_kernel(&half, real, imag, -1);
+    for(size_t k = 0; k < N; k++) {
+        real[k] /= N;
+        imag[k] /= N;
+    }
+}
+
+/*
+ * The real transforms of lengths that cannot be halved, i.e., of odd lengths, or
+ * of lengths, whose half is not a product of the radices of the mixed-radix kernel,
+ * are calculated as full complex transforms. The layout of the arrays is the same
+ * as in fft_rfft_kernel, and fft_irfft_kernel, except that with FFT_SPECTROGRAM,
+ * the absolute values of all n bins are returned in real.
+ */
+
+static void fft_real_full(fft_plan_obj_t *plan, mp_float_t *real, mp_float_t *imag, uint8_t type) {
+    size_t n = plan->n;
+    size_t N = n / 2;
+    mp_float_t *zr = m_new0(mp_float_t, 2 * n);
+    mp_float_t *zi = zr + n;
+
+    if(type == FFT_IRFFT) {
+        // the spectrum of a real sequence is Hermitian
+        zr[0] = real[0];
+        for(size_t k = 1; k <= N; k++) {
+            zr[k] = zr[n - k] = real[k];
+            zi[k] = imag[k];
+            zi[n - k] = -imag[k];
+        }
+        if((n & 1) == 0) {
+            zi[N] = MICROPY_FLOAT_CONST(0.0);
+        }
+        fft_plan_kernel(plan, zr, zi, -1);
+        for(size_t k = 0; k < n; k++) {
+            real[k] = zr[k] / n;
+        }
+    } else {
+        for(size_t k = 0; k < n; k++) {
+            zr[k] = (k & 1) ? imag[k / 2] : real[k / 2];
+        }
+        fft_plan_kernel(plan, zr, zi, 1);
+        if(type == FFT_SPECTROGRAM) {
+            for(size_t k = 0; k < n; k++) {
+                real[k] = MICROPY_FLOAT_C_FUN(sqrt)(zr[k] * zr[k] + zi[k] * zi[k]);
+            }
+        } else {
+            memcpy(real, zr, (N + 1) * sizeof(mp_float_t));
+            memcpy(imag, zi, (N + 1) * sizeof(mp_float_t));
+        }
+    }
+    m_del(mp_float_t, zr, 2 * n);
+}
+
+/*
+ * The forward transform of a real sequence of any length, with the same layout of
+ * the arrays as in fft_rfft_kernel; both arrays must be of length n/2 + 1.
+ */
+
+void fft_real_kernel(fft_plan_obj_t *plan, mp_float_t *real, mp_float_t *imag) {
+    if((plan->n & 1) || (plan->type == FFT_PLAN_BLUESTEIN)) {
+        fft_real_full(plan, real, imag, FFT_RFFT);
+    } else {
+        fft_rfft_kernel(plan, real, imag);
+    }
+}
+
+/*
+ * Transforms the arrays without an explicit plan; this can be called from C,
+ * independent of the python interface.
+ */
+
+void fft_kernel(mp_float_t *real, mp_float_t *imag, size_t n, int isign) {
+    fft_plan_obj_t plan;
+    fft_plan_init(&plan, n, false);
+    fft_plan_kernel(&plan, real, imag, isign);
+    fft_plan_free(&plan);
+}
+
+static ndarray_obj_t *fft_input_array(mp_obj_t arg, bool batched) {
+    // with batched, two-dimensional arrays are also accepted
+    if(!mp_obj_is_type(arg, &ulab_ndarray_type)) {
+        mp_raise_NotImplementedError(translate("FFT is defined for ndarrays only"));
+    }
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(arg);
     #if ULAB_MAX_DIMS > 1
-    if(re->ndim != 1) {
+    if(batched && (ndarray->ndim > 2)) {
+        mp_raise_TypeError(translate("FFT is implemented for linear, and two-dimensional arrays only"));
+    }
+    if(!batched && (ndarray->ndim != 1)) {
         mp_raise_TypeError(translate("FFT is implemented for linear arrays only"));
     }
     #endif
-    size_t len = re->len;
-    // Check if input is of length of power of 2
-    if((len & (len-1)) != 0) {
-        mp_raise_ValueError(translate("input array length must be power of 2"));
+    return ndarray;
+}
+
+static void fft_load_input(ndarray_obj_t *ndarray, size_t offset, size_t step, mp_float_t *data, size_t len) {
+    // copies the elements offset, offset + step, ... of a linear array into data
+    uint8_t *array = (uint8_t *)ndarray->array;
+    array += (int32_t)offset * ndarray->strides[ULAB_MAX_DIMS - 1];
+    int32_t stride = (int32_t)step * ndarray->strides[ULAB_MAX_DIMS - 1];
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+    for(size_t i=0; i < len; i++) {
+        *data++ = func(array);
+        array += stride;
     }
+}
 
-    ndarray_obj_t *out_re = ndarray_new_linear_array(len, NDARRAY_FLOAT);
-    mp_float_t *data_re = (mp_float_t *)out_re->array;
+void fft_check_plan(mp_obj_t arg_plan, size_t len) {
+    if(arg_plan != mp_const_none) {
+        if(!mp_obj_is_type(arg_plan, &fft_plan_type)) {
+            mp_raise_TypeError(translate("plan must be an FFT plan"));
+        }
+        fft_plan_obj_t *plan = MP_OBJ_TO_PTR(arg_plan);
+        if(plan->n != len) {
+            mp_raise_ValueError(translate("plan length does not match the input length"));
+        }
+    }
+}
 
-    uint8_t *array = (uint8_t *)re->array;
-    mp_float_t (*func)(void *) = ndarray_get_float_function(re->dtype);
+static fft_plan_obj_t *fft_use_plan(mp_obj_t arg_plan, size_t len, fft_plan_obj_t *tmp) {
+    // without an explicit plan, a temporary one is created, which, for short
+    // transforms, uses the tables in read-only memory only
+    if(arg_plan == mp_const_none) {
+        fft_plan_init(tmp, len, false);
+        return tmp;
+    }
+    return MP_OBJ_TO_PTR(arg_plan);
+}
 
-    for(size_t i=0; i < len; i++) {
-        *data_re++ = func(array);
-        array += re->strides[ULAB_MAX_DIMS - 1];
+/*
+ * The following function is a helper interface to the python side.
+ * It has been factored out from fft.c, so that the same argument parsing
+ * routine can be called from scipy.signal.spectrogram.
+ *
+ * Two-dimensional arrays are transformed along the given axis. All lanes share the
+ * plan, the results are written into a single pair of arrays of the shape of the
+ * input, and lanes that are not contiguous in the output are transformed in a single
+ * scratch buffer. If overwrite is true, dense float inputs are transformed in place,
+ * and returned.
+ *
+ * A complex input is transformed into a single complex array, whose real and
+ * imaginary parts are interleaved. Since the kernels work on separate arrays,
+ * its lanes always pass through the scratch buffer.
+ */
+
+static bool fft_input_is_complex(mp_obj_t arg) {
+    #if ULAB_SUPPORTS_COMPLEX
+    if(mp_obj_is_type(arg, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(arg);
+        return ndarray->dtype == NDARRAY_COMPLEX;
     }
-    data_re -= len;
-    ndarray_obj_t *out_im = ndarray_new_linear_array(len, NDARRAY_FLOAT);
-    mp_float_t *data_im = (mp_float_t *)out_im->array;
+    #endif
+    return false;
+}
 
+static bool fft_can_overwrite(ndarray_obj_t *ndarray) {
+    bool floats = ndarray->dtype == NDARRAY_FLOAT;
+    #if ULAB_SUPPORTS_COMPLEX
+    floats = floats || (ndarray->dtype == NDARRAY_COMPLEX);
+    #endif
+    return floats && (ndarray->strides[ULAB_MAX_DIMS - 1] == (int32_t)ndarray->itemsize) && ndarray_is_dense(ndarray);
+}
+
+static ndarray_obj_t *fft_output_array(ndarray_obj_t *ndarray, bool overwrite) {
+    // returns the input, if it can hold the results, or a dense float, or complex copy of it otherwise
+    if(overwrite && fft_can_overwrite(ndarray)) {
+        return ndarray;
+    }
+    #if ULAB_SUPPORTS_COMPLEX
+    if(ndarray->dtype == NDARRAY_COMPLEX) {
+        return ndarray_copy_view(ndarray);
+    }
+    #endif
+    ndarray_obj_t *out = ndarray_new_dense_ndarray(ndarray->ndim, ndarray->shape, NDARRAY_FLOAT);
+    mp_float_t *data = (mp_float_t *)out->array;
+    #if ULAB_MAX_DIMS > 1
+    if(ndarray->ndim == 2) {
+        uint8_t *array = (uint8_t *)ndarray->array;
+        mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+        for(size_t j = 0; j < ndarray->shape[ULAB_MAX_DIMS - 2]; j++) {
+            uint8_t *row = array;
+            for(size_t i = 0; i < ndarray->shape[ULAB_MAX_DIMS - 1]; i++) {
+                *data++ = func(row);
+                row += ndarray->strides[ULAB_MAX_DIMS - 1];
+            }
+            array += ndarray->strides[ULAB_MAX_DIMS - 2];
+        }
+        return out;
+    }
+    #endif
+    fft_load_input(ndarray, 0, 1, data, ndarray->len);
+    return out;
+}
+
+mp_obj_t fft_fft_ifft_spectrogram(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_im, mp_obj_t arg_plan, bool overwrite, int8_t axis, uint8_t type) {
+    bool complex_input = fft_input_is_complex(arg_re);
+    if(complex_input && (n_args == 2)) {
+        mp_raise_TypeError(translate("imaginary part cannot be given for complex input"));
+    }
+    if((type == FFT_SPECTROGRAM) && (n_args == 1) && !complex_input) {
+        // the spectrum of a real signal is calculated via the real transform
+        return fft_rfft_irfft(arg_re, mp_const_none, arg_plan, FFT_SPECTROGRAM);
+    }
+    ndarray_obj_t *re = fft_input_array(arg_re, true);
+    if(axis < 0) {
+        axis += re->ndim;
+    }
+    if((axis < 0) || (axis > re->ndim - 1)) {
+        mp_raise_ValueError(translate("axis is out of bounds"));
+    }
+
+    // the transforms are calculated along lanes of length len, whose elements are
+    // estride apart in the dense output arrays, while the lanes start lstride apart
+    size_t len = re->shape[ULAB_MAX_DIMS - 1];
+    size_t lanes = 1, estride = 1, lstride = 0;
+    #if ULAB_MAX_DIMS > 1
+    if(re->ndim == 2) {
+        lanes = re->shape[ULAB_MAX_DIMS - 2];
+        lstride = len;
+        if(axis == 0) {
+            SWAP(size_t, len, lanes);
+            SWAP(size_t, estride, lstride);
+        }
+    }
+    #endif
+    fft_check_length(len);
+    fft_check_plan(arg_plan, len);
+
+    ndarray_obj_t *im = NULL;
     if(n_args == 2) {
-        ndarray_obj_t *im = MP_OBJ_TO_PTR(arg_im);
-        #if ULAB_MAX_DIMS > 1
-        if(im->ndim != 1) {
-            mp_raise_TypeError(translate("FFT is implemented for linear arrays only"));
+        im = fft_input_array(arg_im, true);
+        bool equal = (re->ndim == im->ndim);
+        for(uint8_t i = ULAB_MAX_DIMS; equal && (i > ULAB_MAX_DIMS - re->ndim); i--) {
+            equal = re->shape[i - 1] == im->shape[i - 1];
         }
-        #endif
-        if (re->len != im->len) {
+        if(!equal) {
             mp_raise_ValueError(translate("real and imaginary parts must be of equal length"));
         }
-        array = (uint8_t *)im->array;
-        func = ndarray_get_float_function(im->dtype);
-        for(size_t i=0; i < len; i++) {
-           *data_im++ = func(array);
-           array += im->strides[ULAB_MAX_DIMS - 1];
+    }
+
+    // inputs that cannot be overwritten are copied into new arrays
+    ndarray_obj_t *out_re = fft_output_array(re, overwrite);
+    mp_float_t *data_re = (mp_float_t *)out_re->array;
+    ndarray_obj_t *out_im = NULL;
+    mp_float_t *data_im;
+    // the distance of consecutive real (and imaginary) parts in mp_float_t units
+    size_t fstride = 1;
+    if(complex_input) {
+        data_im = data_re + 1;
+        fstride = 2;
+        estride *= fstride;
+        lstride *= fstride;
+    } else {
+        if(im == NULL) {
+            out_im = ndarray_new_dense_ndarray(re->ndim, re->shape, NDARRAY_FLOAT);
+        } else {
+            // the imaginary part must not overlap with the real part
+            mp_float_t *array = (mp_float_t *)im->array;
+            bool overlap = (array < data_re + re->len) && (data_re < array + im->len);
+            out_im = fft_output_array(im, overwrite && !overlap);
         }
-        data_im -= len;
+        data_im = (mp_float_t *)out_im->array;
     }
 
-    if((type == FFT_FFT) || (type == FFT_SPECTROGRAM)) {
-        fft_kernel(data_re, data_im, len, 1);
-        if(type == FFT_SPECTROGRAM) {
-            for(size_t i=0; i < len; i++) {
-                *data_re = MICROPY_FLOAT_C_FUN(sqrt)(*data_re * *data_re + *data_im * *data_im);
-                data_re++;
-                data_im++;
+    fft_plan_obj_t _plan;
+    fft_plan_obj_t *plan = fft_use_plan(arg_plan, len, &_plan);
+
+    mp_float_t *scratch = NULL;
+    if(estride != 1) {
+        scratch = m_new(mp_float_t, 2 * len);
+    }
+
+    int isign = type == FFT_IFFT ? -1 : 1;
+    for(size_t l = 0; l < lanes; l++) {
+        mp_float_t *lane_re = data_re + l * lstride;
+        mp_float_t *lane_im = data_im + l * lstride;
+        if(scratch == NULL) {
+            fft_plan_kernel(plan, lane_re, lane_im, isign);
+        } else {
+            for(size_t i = 0; i < len; i++) {
+                scratch[i] = lane_re[i * estride];
+                scratch[len + i] = lane_im[i * estride];
             }
+            fft_plan_kernel(plan, scratch, scratch + len, isign);
+            for(size_t i = 0; i < len; i++) {
+                lane_re[i * estride] = scratch[i];
+                lane_im[i * estride] = scratch[len + i];
+            }
+        }
+    }
+    if(scratch != NULL) {
+        m_del(mp_float_t, scratch, 2 * len);
+    }
+    if(plan == &_plan) {
+        fft_plan_free(plan);
+    }
+
+    if(type == FFT_SPECTROGRAM) {
+        // the magnitudes of real inputs overwrite the real parts
+        ndarray_obj_t *out = complex_input ? ndarray_new_dense_ndarray(re->ndim, re->shape, NDARRAY_FLOAT) : out_re;
+        mp_float_t *array = (mp_float_t *)out->array;
+        for(size_t i=0; i < out->len; i++) {
+            *array++ = MICROPY_FLOAT_C_FUN(sqrt)(*data_re * *data_re + *data_im * *data_im);
+            data_re += fstride;
+            data_im += fstride;
         }
-    } else { // inverse transform
-        fft_kernel(data_re, data_im, len, -1);
+        return MP_OBJ_FROM_PTR(out);
+    } else if(type == FFT_IFFT) {
         // TODO: numpy accepts the norm keyword argument
-        for(size_t i=0; i < len; i++) {
-            *data_re++ /= len;
-            *data_im++ /= len;
+        for(size_t i=0; i < out_re->len; i++) {
+            *data_re /= len;
+            *data_im /= len;
+            data_re += fstride;
+            data_im += fstride;
         }
     }
-    if(type == FFT_SPECTROGRAM) {
-        return MP_OBJ_TO_PTR(out_re);
+    if(complex_input) {
+        return MP_OBJ_FROM_PTR(out_re);
+    }
+    mp_obj_t tuple[2];
+    tuple[0] = MP_OBJ_FROM_PTR(out_re);
+    tuple[1] = MP_OBJ_FROM_PTR(out_im);
+    return mp_obj_new_tuple(2, tuple);
+}
+
+/*
+ * The python interface of the real transforms. With FFT_RFFT, the input is a real
+ * array of length n, and the real and imaginary parts of the bins 0...n/2 are
+ * returned. With FFT_IRFFT, the input are the bins 0...n/2, and a real array of
+ * length n is returned. FFT_SPECTROGRAM returns the absolute value of all n bins
+ * of a real input.
+ */
+
+mp_obj_t fft_rfft_irfft(mp_obj_t arg_re, mp_obj_t arg_im, mp_obj_t arg_plan, uint8_t type) {
+    ndarray_obj_t *re = fft_input_array(arg_re, false);
+    size_t len, N;
+    if(type == FFT_IRFFT) {
+        if(re->len < 2) {
+            mp_raise_ValueError(translate("invalid number of FFT data points"));
+        }
+        N = re->len - 1;
+        len = 2 * N;
+    } else {
+        len = re->len;
+        N = len / 2;
+    }
+    fft_check_length(len);
+    fft_check_plan(arg_plan, len);
+
+    // the real parts are held in the output array, which is at least N + 1 long,
+    // and only the imaginary parts require an N + 1 long scratch buffer
+    ndarray_obj_t *out = ndarray_new_linear_array(type == FFT_RFFT ? N + 1 : len, NDARRAY_FLOAT);
+    mp_float_t *data_re = (mp_float_t *)out->array;
+    ndarray_obj_t *out_im = NULL;
+    mp_float_t *data_im;
+    if(type == FFT_RFFT) {
+        out_im = ndarray_new_linear_array(N + 1, NDARRAY_FLOAT);
+        data_im = (mp_float_t *)out_im->array;
+    } else {
+        data_im = m_new0(mp_float_t, N + 1);
+    }
+
+    if(type == FFT_IRFFT) {
+        if(fft_input_is_complex(arg_re)) {
+            if(arg_im != mp_const_none) {
+                m_del(mp_float_t, data_im, N + 1);
+                mp_raise_TypeError(translate("imaginary part cannot be given for complex input"));
+            }
+            uint8_t *array = (uint8_t *)re->array;
+            for(size_t k = 0; k < N + 1; k++) {
+                data_re[k] = ((mp_float_t *)array)[0];
+                data_im[k] = ((mp_float_t *)array)[1];
+                array += re->strides[ULAB_MAX_DIMS - 1];
+            }
+        } else {
+            fft_load_input(re, 0, 1, data_re, N + 1);
+        }
+        if(!fft_input_is_complex(arg_re) && (arg_im != mp_const_none)) {
+            ndarray_obj_t *im = fft_input_array(arg_im, false);
+            if (re->len != im->len) {
+                m_del(mp_float_t, data_im, N + 1);
+                mp_raise_ValueError(translate("real and imaginary parts must be of equal length"));
+            }
+            fft_load_input(im, 0, 1, data_im, N + 1);
+        }
     } else {
-        mp_obj_t tuple[2];
-        tuple[0] = out_re;
-        tuple[1] = out_im;
-        return mp_obj_new_tuple(2, tuple);
+        fft_load_input(re, 0, 2, data_re, (len + 1) / 2);
+        fft_load_input(re, 1, 2, data_im, len / 2);
+    }
+
+    fft_plan_obj_t _plan;
+    fft_plan_obj_t *plan = fft_use_plan(arg_plan, len, &_plan);
+
+    if((len & 1) || (plan->type == FFT_PLAN_BLUESTEIN)) {
+        fft_real_full(plan, data_re, data_im, type);
+    } else if(type == FFT_IRFFT) {
+        fft_irfft_kernel(plan, data_re, data_im);
+        // interleave the even and odd samples; going backwards, no sample is overwritten before it is read
+        for(size_t k = N; k > 0; k--) {
+            mp_float_t even = data_re[k - 1];
+            data_re[2 * k - 1] = data_im[k - 1];
+            data_re[2 * k - 2] = even;
+        }
+    } else {
+        fft_rfft_kernel(plan, data_re, data_im);
+        if(type == FFT_SPECTROGRAM) {
+            for(size_t k = 0; k < N + 1; k++) {
+                data_re[k] = MICROPY_FLOAT_C_FUN(sqrt)(data_re[k] * data_re[k] + data_im[k] * data_im[k]);
+            }
+            // the spectrum of a real signal is symmetric
+            for(size_t k = 1; k < N; k++) {
+                data_re[len - k] = data_re[k];
+            }
+        }
+    }
+    if(plan == &_plan) {
+        fft_plan_free(plan);
+    }
+    if(type != FFT_RFFT) {
+        m_del(mp_float_t, data_im, N + 1);
+        return MP_OBJ_FROM_PTR(out);
     }
+    mp_obj_t tuple[2];
+    tuple[0] = MP_OBJ_FROM_PTR(out);
+    tuple[1] = MP_OBJ_FROM_PTR(out_im);
+    return mp_obj_new_tuple(2, tuple);
 }
@@ -11,13 +11,64 @@
 #ifndef _FFT_TOOLS_
 #define _FFT_TOOLS_
 
+#include "py/obj.h"
+#include "../../ulab.h"
+
 enum FFT_TYPE {
     FFT_FFT,
     FFT_IFFT,
     FFT_SPECTROGRAM,
+    FFT_RFFT,
+    FFT_IRFFT,
+};
+
+enum FFT_PLAN_TYPE {
+    FFT_PLAN_RADIX2,
+    FFT_PLAN_MIXED_RADIX,
+    FFT_PLAN_BLUESTEIN,
 };
 
+// since all radices are at least 2, a length fitting into size_t has at most this many factors
+#define FFT_MAX_FACTORS     (8 * sizeof(size_t))
+
+// A plan holds everything that depends on the length of the transform only,
+// so that it can be re-used in successive transforms of the same length
+typedef struct _fft_plan_obj_t {
+    mp_obj_base_t base;
+    size_t n;
+    // the twiddle factors are stored as cos/sin pairs; the factors belonging
+    // to this plan are found at the given stride in the table
+    size_t stride;
+    const mp_float_t *twiddle;
+    // the bit-reversal permutation, or NULL, if the permutation is calculated on the fly;
+    // a plan of half the length can use the same table, if the indices are shifted to the right
+    uint16_t *bitrev;
+    uint8_t bitrev_shift;
+    uint8_t type;
+    // the radices of the stages of a mixed-radix transform
+    uint8_t nfactors;
+    uint8_t factors[FFT_MAX_FACTORS];
+    // the buffer of the out-of-place stages of the mixed-radix, and Bluestein transforms
+    mp_float_t *scratch;
+    // Bluestein's algorithm calculates the transform via a power-of-two plan, and
+    // requires the chirp, and the transform of the convolution kernel
+    struct _fft_plan_obj_t *bluestein;
+    mp_float_t *chirp;
+    mp_float_t *kernel;
+} fft_plan_obj_t;
+
+extern const mp_obj_type_t fft_plan_type;
+
+void fft_check_length(size_t );
+void fft_plan_init(fft_plan_obj_t *, size_t , bool );
+void fft_plan_free(fft_plan_obj_t *);
+void fft_plan_kernel(fft_plan_obj_t *, mp_float_t *, mp_float_t *, int );
+void fft_rfft_kernel(fft_plan_obj_t *, mp_float_t *, mp_float_t *);
+void fft_irfft_kernel(fft_plan_obj_t *, mp_float_t *, mp_float_t *);
+void fft_real_kernel(fft_plan_obj_t *, mp_float_t *, mp_float_t *);
 void fft_kernel(mp_float_t *, mp_float_t *, size_t , int );
-mp_obj_t fft_fft_ifft_spectrogram(size_t , mp_obj_t , mp_obj_t , uint8_t );
+void fft_check_plan(mp_obj_t , size_t );
+mp_obj_t fft_fft_ifft_spectrogram(size_t , mp_obj_t , mp_obj_t , mp_obj_t , bool , int8_t , uint8_t );
+mp_obj_t fft_rfft_irfft(mp_obj_t , mp_obj_t , mp_obj_t , uint8_t );
 
 #endif /* _FFT_TOOLS_ */
@@ -0,0 +1,279 @@
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+*/
+
+#ifndef _FFT_TWIDDLE_
+#define _FFT_TWIDDLE_
+
+// The table contains the pairs cos(2 pi k / 1024), sin(2 pi k / 1024) for k = 0...511.
+// The values have been calculated offline to high precision, and the twiddle factors
+// of all shorter power-of-two transforms can be found at a constant stride in the table.
+
+#define FFT_TWIDDLE_TABLE_LEN       (1024)
+
+static const mp_float_t fft_twiddle_table[FFT_TWIDDLE_TABLE_LEN] = {
+    MICROPY_FLOAT_CONST(1.0), MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(0.9999811752826011), MICROPY_FLOAT_CONST(0.006135884649154475),
+    MICROPY_FLOAT_CONST(0.9999247018391445), MICROPY_FLOAT_CONST(0.012271538285719925), MICROPY_FLOAT_CONST(0.9998305817958234), MICROPY_FLOAT_CONST(0.01840672990580482),
+    MICROPY_FLOAT_CONST(0.9996988186962042), MICROPY_FLOAT_CONST(0.024541228522912288), MICROPY_FLOAT_CONST(0.9995294175010931), MICROPY_FLOAT_CONST(0.030674803176636626),
+    MICROPY_FLOAT_CONST(0.9993223845883495), MICROPY_FLOAT_CONST(0.03680722294135883), MICROPY_FLOAT_CONST(0.9990777277526454), MICROPY_FLOAT_CONST(0.04293825693494082),
+    MICROPY_FLOAT_CONST(0.9987954562051724), MICROPY_FLOAT_CONST(0.049067674327418015), MICROPY_FLOAT_CONST(0.9984755805732948), MICROPY_FLOAT_CONST(0.05519524434968994),
+    MICROPY_FLOAT_CONST(0.9981181129001492), MICROPY_FLOAT_CONST(0.06132073630220858), MICROPY_FLOAT_CONST(0.9977230666441916), MICROPY_FLOAT_CONST(0.06744391956366406),
+    MICROPY_FLOAT_CONST(0.9972904566786902), MICROPY_FLOAT_CONST(0.07356456359966743), MICROPY_FLOAT_CONST(0.9968202992911657), MICROPY_FLOAT_CONST(0.07968243797143013),
+    MICROPY_FLOAT_CONST(0.996312612182778), MICROPY_FLOAT_CONST(0.0857973123444399), MICROPY_FLOAT_CONST(0.9957674144676598), MICROPY_FLOAT_CONST(0.09190895649713272),
+    MICROPY_FLOAT_CONST(0.9951847266721969), MICROPY_FLOAT_CONST(0.0980171403295606), MICROPY_FLOAT_CONST(0.9945645707342554), MICROPY_FLOAT_CONST(0.10412163387205457),
+    MICROPY_FLOAT_CONST(0.9939069700023561), MICROPY_FLOAT_CONST(0.11022220729388306), MICROPY_FLOAT_CONST(0.9932119492347945), MICROPY_FLOAT_CONST(0.11631863091190477),
+    MICROPY_FLOAT_CONST(0.99247953459871), MICROPY_FLOAT_CONST(0.1224106751992162), MICROPY_FLOAT_CONST(0.9917097536690995), MICROPY_FLOAT_CONST(0.12849811079379317),
+    MICROPY_FLOAT_CONST(0.99090263542778), MICROPY_FLOAT_CONST(0.1345807085071262), MICROPY_FLOAT_CONST(0.9900582102622971), MICROPY_FLOAT_CONST(0.14065823933284924),
+    MICROPY_FLOAT_CONST(0.989176509964781), MICROPY_FLOAT_CONST(0.14673047445536175), MICROPY_FLOAT_CONST(0.9882575677307495), MICROPY_FLOAT_CONST(0.15279718525844344),
+    MICROPY_FLOAT_CONST(0.9873014181578584), MICROPY_FLOAT_CONST(0.15885814333386145), MICROPY_FLOAT_CONST(0.9863080972445987), MICROPY_FLOAT_CONST(0.16491312048996992),
+    MICROPY_FLOAT_CONST(0.9852776423889412), MICROPY_FLOAT_CONST(0.17096188876030122), MICROPY_FLOAT_CONST(0.984210092386929), MICROPY_FLOAT_CONST(0.17700422041214875),
+    MICROPY_FLOAT_CONST(0.9831054874312163), MICROPY_FLOAT_CONST(0.18303988795514095), MICROPY_FLOAT_CONST(0.9819638691095552), MICROPY_FLOAT_CONST(0.18906866414980622),
+    MICROPY_FLOAT_CONST(0.9807852804032304), MICROPY_FLOAT_CONST(0.19509032201612828), MICROPY_FLOAT_CONST(0.9795697656854405), MICROPY_FLOAT_CONST(0.2011046348420919),
+    MICROPY_FLOAT_CONST(0.9783173707196277), MICROPY_FLOAT_CONST(0.20711137619221856), MICROPY_FLOAT_CONST(0.9770281426577544), MICROPY_FLOAT_CONST(0.21311031991609136),
+    MICROPY_FLOAT_CONST(0.9757021300385286), MICROPY_FLOAT_CONST(0.2191012401568698), MICROPY_FLOAT_CONST(0.9743393827855759), MICROPY_FLOAT_CONST(0.22508391135979283),
+    MICROPY_FLOAT_CONST(0.9729399522055602), MICROPY_FLOAT_CONST(0.2310581082806711), MICROPY_FLOAT_CONST(0.9715038909862518), MICROPY_FLOAT_CONST(0.2370236059943672),
+    MICROPY_FLOAT_CONST(0.970031253194544), MICROPY_FLOAT_CONST(0.2429801799032639), MICROPY_FLOAT_CONST(0.9685220942744173), MICROPY_FLOAT_CONST(0.24892760574572018),
+    MICROPY_FLOAT_CONST(0.9669764710448521), MICROPY_FLOAT_CONST(0.25486565960451457), MICROPY_FLOAT_CONST(0.9653944416976894), MICROPY_FLOAT_CONST(0.2607941179152755),
+    MICROPY_FLOAT_CONST(0.9637760657954398), MICROPY_FLOAT_CONST(0.26671275747489837), MICROPY_FLOAT_CONST(0.9621214042690416), MICROPY_FLOAT_CONST(0.272621355449949),
+    MICROPY_FLOAT_CONST(0.9604305194155658), MICROPY_FLOAT_CONST(0.2785196893850531), MICROPY_FLOAT_CONST(0.9587034748958716), MICROPY_FLOAT_CONST(0.2844075372112718),
+    MICROPY_FLOAT_CONST(0.9569403357322088), MICROPY_FLOAT_CONST(0.2902846772544624), MICROPY_FLOAT_CONST(0.9551411683057707), MICROPY_FLOAT_CONST(0.29615088824362384),
+    MICROPY_FLOAT_CONST(0.9533060403541939), MICROPY_FLOAT_CONST(0.3020059493192281), MICROPY_FLOAT_CONST(0.9514350209690083), MICROPY_FLOAT_CONST(0.30784964004153487),
+    MICROPY_FLOAT_CONST(0.9495281805930367), MICROPY_FLOAT_CONST(0.31368174039889146), MICROPY_FLOAT_CONST(0.9475855910177411), MICROPY_FLOAT_CONST(0.3195020308160157),
+    MICROPY_FLOAT_CONST(0.9456073253805213), MICROPY_FLOAT_CONST(0.3253102921622629), MICROPY_FLOAT_CONST(0.9435934581619604), MICROPY_FLOAT_CONST(0.33110630575987643),
+    MICROPY_FLOAT_CONST(0.9415440651830208), MICROPY_FLOAT_CONST(0.33688985339222005), MICROPY_FLOAT_CONST(0.9394592236021899), MICROPY_FLOAT_CONST(0.3426607173119944),
+    MICROPY_FLOAT_CONST(0.937339011912575), MICROPY_FLOAT_CONST(0.34841868024943456), MICROPY_FLOAT_CONST(0.9351835099389476), MICROPY_FLOAT_CONST(0.3541635254204904),
+    MICROPY_FLOAT_CONST(0.9329927988347388), MICROPY_FLOAT_CONST(0.35989503653498817), MICROPY_FLOAT_CONST(0.9307669610789837), MICROPY_FLOAT_CONST(0.36561299780477385),
+    MICROPY_FLOAT_CONST(0.9285060804732156), MICROPY_FLOAT_CONST(0.37131719395183754), MICROPY_FLOAT_CONST(0.9262102421383114), MICROPY_FLOAT_CONST(0.37700741021641826),
+    MICROPY_FLOAT_CONST(0.9238795325112867), MICROPY_FLOAT_CONST(0.3826834323650898), MICROPY_FLOAT_CONST(0.9215140393420419), MICROPY_FLOAT_CONST(0.3883450466988263),
+    MICROPY_FLOAT_CONST(0.9191138516900578), MICROPY_FLOAT_CONST(0.3939920400610481), MICROPY_FLOAT_CONST(0.9166790599210427), MICROPY_FLOAT_CONST(0.39962419984564684),
+    MICROPY_FLOAT_CONST(0.9142097557035307), MICROPY_FLOAT_CONST(0.40524131400498986), MICROPY_FLOAT_CONST(0.9117060320054299), MICROPY_FLOAT_CONST(0.41084317105790397),
+    MICROPY_FLOAT_CONST(0.9091679830905224), MICROPY_FLOAT_CONST(0.4164295600976372), MICROPY_FLOAT_CONST(0.9065957045149153), MICROPY_FLOAT_CONST(0.4220002707997997),
+    MICROPY_FLOAT_CONST(0.9039892931234433), MICROPY_FLOAT_CONST(0.4275550934302821), MICROPY_FLOAT_CONST(0.901348847046022), MICROPY_FLOAT_CONST(0.43309381885315196),
+    MICROPY_FLOAT_CONST(0.8986744656939538), MICROPY_FLOAT_CONST(0.43861623853852766), MICROPY_FLOAT_CONST(0.8959662497561851), MICROPY_FLOAT_CONST(0.44412214457042926),
+    MICROPY_FLOAT_CONST(0.8932243011955153), MICROPY_FLOAT_CONST(0.4496113296546066), MICROPY_FLOAT_CONST(0.8904487232447579), MICROPY_FLOAT_CONST(0.45508358712634384),
+    MICROPY_FLOAT_CONST(0.8876396204028539), MICROPY_FLOAT_CONST(0.46053871095824), MICROPY_FLOAT_CONST(0.8847970984309378), MICROPY_FLOAT_CONST(0.4659764957679662),
+    MICROPY_FLOAT_CONST(0.881921264348355), MICROPY_FLOAT_CONST(0.47139673682599764), MICROPY_FLOAT_CONST(0.8790122264286335), MICROPY_FLOAT_CONST(0.47679923006332214),
+    MICROPY_FLOAT_CONST(0.8760700941954066), MICROPY_FLOAT_CONST(0.4821837720791228), MICROPY_FLOAT_CONST(0.8730949784182901), MICROPY_FLOAT_CONST(0.48755016014843594),
+    MICROPY_FLOAT_CONST(0.8700869911087115), MICROPY_FLOAT_CONST(0.49289819222978404), MICROPY_FLOAT_CONST(0.8670462455156926), MICROPY_FLOAT_CONST(0.49822766697278187),
+    MICROPY_FLOAT_CONST(0.8639728561215867), MICROPY_FLOAT_CONST(0.5035383837257176), MICROPY_FLOAT_CONST(0.8608669386377673), MICROPY_FLOAT_CONST(0.508830142543107),
+    MICROPY_FLOAT_CONST(0.8577286100002721), MICROPY_FLOAT_CONST(0.5141027441932218), MICROPY_FLOAT_CONST(0.8545579883654005), MICROPY_FLOAT_CONST(0.5193559901655896),
+    MICROPY_FLOAT_CONST(0.8513551931052652), MICROPY_FLOAT_CONST(0.524589682678469), MICROPY_FLOAT_CONST(0.8481203448032972), MICROPY_FLOAT_CONST(0.5298036246862947),
+    MICROPY_FLOAT_CONST(0.8448535652497071), MICROPY_FLOAT_CONST(0.5349976198870973), MICROPY_FLOAT_CONST(0.8415549774368984), MICROPY_FLOAT_CONST(0.5401714727298929),
+    MICROPY_FLOAT_CONST(0.8382247055548381), MICROPY_FLOAT_CONST(0.5453249884220465), MICROPY_FLOAT_CONST(0.83486287498638), MICROPY_FLOAT_CONST(0.5504579729366048),
+    MICROPY_FLOAT_CONST(0.8314696123025452), MICROPY_FLOAT_CONST(0.5555702330196022), MICROPY_FLOAT_CONST(0.8280450452577558), MICROPY_FLOAT_CONST(0.560661576197336),
+    MICROPY_FLOAT_CONST(0.8245893027850253), MICROPY_FLOAT_CONST(0.5657318107836132), MICROPY_FLOAT_CONST(0.8211025149911046), MICROPY_FLOAT_CONST(0.5707807458869673),
+    MICROPY_FLOAT_CONST(0.8175848131515837), MICROPY_FLOAT_CONST(0.5758081914178453), MICROPY_FLOAT_CONST(0.8140363297059484), MICROPY_FLOAT_CONST(0.5808139580957645),
+    MICROPY_FLOAT_CONST(0.8104571982525948), MICROPY_FLOAT_CONST(0.5857978574564389), MICROPY_FLOAT_CONST(0.8068475535437992), MICROPY_FLOAT_CONST(0.5907597018588743),
+    MICROPY_FLOAT_CONST(0.8032075314806449), MICROPY_FLOAT_CONST(0.5956993044924334), MICROPY_FLOAT_CONST(0.799537269107905), MICROPY_FLOAT_CONST(0.600616479383869),
+    MICROPY_FLOAT_CONST(0.7958369046088836), MICROPY_FLOAT_CONST(0.6055110414043255), MICROPY_FLOAT_CONST(0.7921065773002124), MICROPY_FLOAT_CONST(0.6103828062763095),
+    MICROPY_FLOAT_CONST(0.7883464276266062), MICROPY_FLOAT_CONST(0.6152315905806268), MICROPY_FLOAT_CONST(0.7845565971555752), MICROPY_FLOAT_CONST(0.6200572117632892),
+    MICROPY_FLOAT_CONST(0.7807372285720945), MICROPY_FLOAT_CONST(0.6248594881423863), MICROPY_FLOAT_CONST(0.7768884656732324), MICROPY_FLOAT_CONST(0.629638238914927),
+    MICROPY_FLOAT_CONST(0.773010453362737), MICROPY_FLOAT_CONST(0.6343932841636455), MICROPY_FLOAT_CONST(0.7691033376455796), MICROPY_FLOAT_CONST(0.6391244448637757),
+    MICROPY_FLOAT_CONST(0.765167265622459), MICROPY_FLOAT_CONST(0.6438315428897915), MICROPY_FLOAT_CONST(0.7612023854842618), MICROPY_FLOAT_CONST(0.6485144010221124),
+    MICROPY_FLOAT_CONST(0.7572088465064846), MICROPY_FLOAT_CONST(0.6531728429537768), MICROPY_FLOAT_CONST(0.7531867990436125), MICROPY_FLOAT_CONST(0.6578066932970786),
+    MICROPY_FLOAT_CONST(0.7491363945234594), MICROPY_FLOAT_CONST(0.6624157775901718), MICROPY_FLOAT_CONST(0.745057785441466), MICROPY_FLOAT_CONST(0.6669999223036375),
+    MICROPY_FLOAT_CONST(0.7409511253549591), MICROPY_FLOAT_CONST(0.6715589548470184), MICROPY_FLOAT_CONST(0.7368165688773699), MICROPY_FLOAT_CONST(0.6760927035753159),
+    MICROPY_FLOAT_CONST(0.7326542716724128), MICROPY_FLOAT_CONST(0.680600997795453), MICROPY_FLOAT_CONST(0.7284643904482252), MICROPY_FLOAT_CONST(0.6850836677727004),
+    MICROPY_FLOAT_CONST(0.7242470829514669), MICROPY_FLOAT_CONST(0.6895405447370669), MICROPY_FLOAT_CONST(0.7200025079613817), MICROPY_FLOAT_CONST(0.693971460889654),
+    MICROPY_FLOAT_CONST(0.7157308252838187), MICROPY_FLOAT_CONST(0.6983762494089728), MICROPY_FLOAT_CONST(0.7114321957452164), MICROPY_FLOAT_CONST(0.7027547444572253),
+    MICROPY_FLOAT_CONST(0.7071067811865476), MICROPY_FLOAT_CONST(0.7071067811865476), MICROPY_FLOAT_CONST(0.7027547444572253), MICROPY_FLOAT_CONST(0.7114321957452164),
+    MICROPY_FLOAT_CONST(0.6983762494089728), MICROPY_FLOAT_CONST(0.7157308252838187), MICROPY_FLOAT_CONST(0.693971460889654), MICROPY_FLOAT_CONST(0.7200025079613817),
+    MICROPY_FLOAT_CONST(0.6895405447370669), MICROPY_FLOAT_CONST(0.7242470829514669), MICROPY_FLOAT_CONST(0.6850836677727004), MICROPY_FLOAT_CONST(0.7284643904482252),
+    MICROPY_FLOAT_CONST(0.680600997795453), MICROPY_FLOAT_CONST(0.7326542716724128), MICROPY_FLOAT_CONST(0.6760927035753159), MICROPY_FLOAT_CONST(0.7368165688773699),
+    MICROPY_FLOAT_CONST(0.6715589548470184), MICROPY_FLOAT_CONST(0.7409511253549591), MICROPY_FLOAT_CONST(0.6669999223036375), MICROPY_FLOAT_CONST(0.745057785441466),
+    MICROPY_FLOAT_CONST(0.6624157775901718), MICROPY_FLOAT_CONST(0.7491363945234594), MICROPY_FLOAT_CONST(0.6578066932970786), MICROPY_FLOAT_CONST(0.7531867990436125),
+    MICROPY_FLOAT_CONST(0.6531728429537768), MICROPY_FLOAT_CONST(0.7572088465064846), MICROPY_FLOAT_CONST(0.6485144010221124), MICROPY_FLOAT_CONST(0.7612023854842618),
+    MICROPY_FLOAT_CONST(0.6438315428897915), MICROPY_FLOAT_CONST(0.765167265622459), MICROPY_FLOAT_CONST(0.6391244448637757), MICROPY_FLOAT_CONST(0.7691033376455796),
+    MICROPY_FLOAT_CONST(0.6343932841636455), MICROPY_FLOAT_CONST(0.773010453362737), MICROPY_FLOAT_CONST(0.629638238914927), MICROPY_FLOAT_CONST(0.7768884656732324),
+    MICROPY_FLOAT_CONST(0.6248594881423863), MICROPY_FLOAT_CONST(0.7807372285720945), MICROPY_FLOAT_CONST(0.6200572117632892), MICROPY_FLOAT_CONST(0.7845565971555752),
+    MICROPY_FLOAT_CONST(0.6152315905806268), MICROPY_FLOAT_CONST(0.7883464276266062), MICROPY_FLOAT_CONST(0.6103828062763095), MICROPY_FLOAT_CONST(0.7921065773002124),
+    MICROPY_FLOAT_CONST(0.6055110414043255), MICROPY_FLOAT_CONST(0.7958369046088836), MICROPY_FLOAT_CONST(0.600616479383869), MICROPY_FLOAT_CONST(0.799537269107905),
+    MICROPY_FLOAT_CONST(0.5956993044924334), MICROPY_FLOAT_CONST(0.8032075314806449), MICROPY_FLOAT_CONST(0.5907597018588743), MICROPY_FLOAT_CONST(0.8068475535437992),
+    MICROPY_FLOAT_CONST(0.5857978574564389), MICROPY_FLOAT_CONST(0.8104571982525948), MICROPY_FLOAT_CONST(0.5808139580957645), MICROPY_FLOAT_CONST(0.8140363297059484),
+    MICROPY_FLOAT_CONST(0.5758081914178453), MICROPY_FLOAT_CONST(0.8175848131515837), MICROPY_FLOAT_CONST(0.5707807458869673), MICROPY_FLOAT_CONST(0.8211025149911046),
+    MICROPY_FLOAT_CONST(0.5657318107836132), MICROPY_FLOAT_CONST(0.8245893027850253), MICROPY_FLOAT_CONST(0.560661576197336), MICROPY_FLOAT_CONST(0.8280450452577558),
+    MICROPY_FLOAT_CONST(0.5555702330196022), MICROPY_FLOAT_CONST(0.8314696123025452), MICROPY_FLOAT_CONST(0.5504579729366048), MICROPY_FLOAT_CONST(0.83486287498638),
+    MICROPY_FLOAT_CONST(0.5453249884220465), MICROPY_FLOAT_CONST(0.8382247055548381), MICROPY_FLOAT_CONST(0.5401714727298929), MICROPY_FLOAT_CONST(0.8415549774368984),
+    MICROPY_FLOAT_CONST(0.5349976198870973), MICROPY_FLOAT_CONST(0.8448535652497071), MICROPY_FLOAT_CONST(0.5298036246862947), MICROPY_FLOAT_CONST(0.8481203448032972),
+    MICROPY_FLOAT_CONST(0.524589682678469), MICROPY_FLOAT_CONST(0.8513551931052652), MICROPY_FLOAT_CONST(0.5193559901655896), MICROPY_FLOAT_CONST(0.8545579883654005),
+    MICROPY_FLOAT_CONST(0.5141027441932218), MICROPY_FLOAT_CONST(0.8577286100002721), MICROPY_FLOAT_CONST(0.508830142543107), MICROPY_FLOAT_CONST(0.8608669386377673),
+    MICROPY_FLOAT_CONST(0.5035383837257176), MICROPY_FLOAT_CONST(0.8639728561215867), MICROPY_FLOAT_CONST(0.49822766697278187), MICROPY_FLOAT_CONST(0.8670462455156926),
+    MICROPY_FLOAT_CONST(0.49289819222978404), MICROPY_FLOAT_CONST(0.8700869911087115), MICROPY_FLOAT_CONST(0.48755016014843594), MICROPY_FLOAT_CONST(0.8730949784182901),
+    MICROPY_FLOAT_CONST(0.4821837720791228), MICROPY_FLOAT_CONST(0.8760700941954066), MICROPY_FLOAT_CONST(0.47679923006332214), MICROPY_FLOAT_CONST(0.8790122264286335),
+    MICROPY_FLOAT_CONST(0.47139673682599764), MICROPY_FLOAT_CONST(0.881921264348355), MICROPY_FLOAT_CONST(0.4659764957679662), MICROPY_FLOAT_CONST(0.8847970984309378),
+    MICROPY_FLOAT_CONST(0.46053871095824), MICROPY_FLOAT_CONST(0.8876396204028539), MICROPY_FLOAT_CONST(0.45508358712634384), MICROPY_FLOAT_CONST(0.8904487232447579),
+    MICROPY_FLOAT_CONST(0.4496113296546066), MICROPY_FLOAT_CONST(0.8932243011955153), MICROPY_FLOAT_CONST(0.44412214457042926), MICROPY_FLOAT_CONST(0.8959662497561851),
+    MICROPY_FLOAT_CONST(0.43861623853852766), MICROPY_FLOAT_CONST(0.8986744656939538), MICROPY_FLOAT_CONST(0.43309381885315196), MICROPY_FLOAT_CONST(0.901348847046022),
+    MICROPY_FLOAT_CONST(0.4275550934302821), MICROPY_FLOAT_CONST(0.9039892931234433), MICROPY_FLOAT_CONST(0.4220002707997997), MICROPY_FLOAT_CONST(0.9065957045149153),
+    MICROPY_FLOAT_CONST(0.4164295600976372), MICROPY_FLOAT_CONST(0.9091679830905224), MICROPY_FLOAT_CONST(0.41084317105790397), MICROPY_FLOAT_CONST(0.9117060320054299),
+    MICROPY_FLOAT_CONST(0.40524131400498986), MICROPY_FLOAT_CONST(0.9142097557035307), MICROPY_FLOAT_CONST(0.39962419984564684), MICROPY_FLOAT_CONST(0.9166790599210427),
+    MICROPY_FLOAT_CONST(0.3939920400610481), MICROPY_FLOAT_CONST(0.9191138516900578), MICROPY_FLOAT_CONST(0.3883450466988263), MICROPY_FLOAT_CONST(0.9215140393420419),
+    MICROPY_FLOAT_CONST(0.3826834323650898), MICROPY_FLOAT_CONST(0.9238795325112867), MICROPY_FLOAT_CONST(0.37700741021641826), MICROPY_FLOAT_CONST(0.9262102421383114),
+    MICROPY_FLOAT_CONST(0.37131719395183754), MICROPY_FLOAT_CONST(0.9285060804732156), MICROPY_FLOAT_CONST(0.36561299780477385), MICROPY_FLOAT_CONST(0.9307669610789837),
+    MICROPY_FLOAT_CONST(0.35989503653498817), MICROPY_FLOAT_CONST(0.9329927988347388), MICROPY_FLOAT_CONST(0.3541635254204904), MICROPY_FLOAT_CONST(0.9351835099389476),
+    MICROPY_FLOAT_CONST(0.34841868024943456), MICROPY_FLOAT_CONST(0.937339011912575), MICROPY_FLOAT_CONST(0.3426607173119944), MICROPY_FLOAT_CONST(0.9394592236021899),
+    MICROPY_FLOAT_CONST(0.33688985339222005), MICROPY_FLOAT_CONST(0.9415440651830208), MICROPY_FLOAT_CONST(0.33110630575987643), MICROPY_FLOAT_CONST(0.9435934581619604),
+    MICROPY_FLOAT_CONST(0.3253102921622629), MICROPY_FLOAT_CONST(0.9456073253805213), MICROPY_FLOAT_CONST(0.3195020308160157), MICROPY_FLOAT_CONST(0.9475855910177411),
+    MICROPY_FLOAT_CONST(0.31368174039889146), MICROPY_FLOAT_CONST(0.9495281805930367), MICROPY_FLOAT_CONST(0.30784964004153487), MICROPY_FLOAT_CONST(0.9514350209690083),
+    MICROPY_FLOAT_CONST(0.3020059493192281), MICROPY_FLOAT_CONST(0.9533060403541939), MICROPY_FLOAT_CONST(0.29615088824362384), MICROPY_FLOAT_CONST(0.9551411683057707),
+    MICROPY_FLOAT_CONST(0.2902846772544624), MICROPY_FLOAT_CONST(0.9569403357322088), MICROPY_FLOAT_CONST(0.2844075372112718), MICROPY_FLOAT_CONST(0.9587034748958716),
+    MICROPY_FLOAT_CONST(0.2785196893850531), MICROPY_FLOAT_CONST(0.9604305194155658), MICROPY_FLOAT_CONST(0.272621355449949), MICROPY_FLOAT_CONST(0.9621214042690416),
+    MICROPY_FLOAT_CONST(0.26671275747489837), MICROPY_FLOAT_CONST(0.9637760657954398), MICROPY_FLOAT_CONST(0.2607941179152755), MICROPY_FLOAT_CONST(0.9653944416976894),
+    MICROPY_FLOAT_CONST(0.25486565960451457), MICROPY_FLOAT_CONST(0.9669764710448521), MICROPY_FLOAT_CONST(0.24892760574572018), MICROPY_FLOAT_CONST(0.9685220942744173),
+    MICROPY_FLOAT_CONST(0.2429801799032639), MICROPY_FLOAT_CONST(0.970031253194544), MICROPY_FLOAT_CONST(0.2370236059943672), MICROPY_FLOAT_CONST(0.9715038909862518),
+    MICROPY_FLOAT_CONST(0.2310581082806711), MICROPY_FLOAT_CONST(0.9729399522055602), MICROPY_FLOAT_CONST(0.22508391135979283), MICROPY_FLOAT_CONST(0.9743393827855759),
+    MICROPY_FLOAT_CONST(0.2191012401568698), MICROPY_FLOAT_CONST(0.9757021300385286), MICROPY_FLOAT_CONST(0.21311031991609136), MICROPY_FLOAT_CONST(0.9770281426577544),
+    MICROPY_FLOAT_CONST(0.20711137619221856), MICROPY_FLOAT_CONST(0.9783173707196277), MICROPY_FLOAT_CONST(0.2011046348420919), MICROPY_FLOAT_CONST(0.9795697656854405),
+    MICROPY_FLOAT_CONST(0.19509032201612828), MICROPY_FLOAT_CONST(0.9807852804032304), MICROPY_FLOAT_CONST(0.18906866414980622), MICROPY_FLOAT_CONST(0.9819638691095552),
+    MICROPY_FLOAT_CONST(0.18303988795514095), MICROPY_FLOAT_CONST(0.9831054874312163), MICROPY_FLOAT_CONST(0.17700422041214875), MICROPY_FLOAT_CONST(0.984210092386929),
+    MICROPY_FLOAT_CONST(0.17096188876030122), MICROPY_FLOAT_CONST(0.9852776423889412), MICROPY_FLOAT_CONST(0.16491312048996992), MICROPY_FLOAT_CONST(0.9863080972445987),
+    MICROPY_FLOAT_CONST(0.15885814333386145), MICROPY_FLOAT_CONST(0.9873014181578584), MICROPY_FLOAT_CONST(0.15279718525844344), MICROPY_FLOAT_CONST(0.9882575677307495),
+    MICROPY_FLOAT_CONST(0.14673047445536175), MICROPY_FLOAT_CONST(0.989176509964781), MICROPY_FLOAT_CONST(0.14065823933284924), MICROPY_FLOAT_CONST(0.9900582102622971),
+    MICROPY_FLOAT_CONST(0.1345807085071262), MICROPY_FLOAT_CONST(0.99090263542778), MICROPY_FLOAT_CONST(0.12849811079379317), MICROPY_FLOAT_CONST(0.9917097536690995),
+    MICROPY_FLOAT_CONST(0.1224106751992162), MICROPY_FLOAT_CONST(0.99247953459871), MICROPY_FLOAT_CONST(0.11631863091190477), MICROPY_FLOAT_CONST(0.9932119492347945),
+    MICROPY_FLOAT_CONST(0.11022220729388306), MICROPY_FLOAT_CONST(0.9939069700023561), MICROPY_FLOAT_CONST(0.10412163387205457), MICROPY_FLOAT_CONST(0.9945645707342554),
+    MICROPY_FLOAT_CONST(0.0980171403295606), MICROPY_FLOAT_CONST(0.9951847266721969), MICROPY_FLOAT_CONST(0.09190895649713272), MICROPY_FLOAT_CONST(0.9957674144676598),
+    MICROPY_FLOAT_CONST(0.0857973123444399), MICROPY_FLOAT_CONST(0.996312612182778), MICROPY_FLOAT_CONST(0.07968243797143013), MICROPY_FLOAT_CONST(0.9968202992911657),
+    MICROPY_FLOAT_CONST(0.07356456359966743), MICROPY_FLOAT_CONST(0.9972904566786902), MICROPY_FLOAT_CONST(0.06744391956366406), MICROPY_FLOAT_CONST(0.9977230666441916),
+    MICROPY_FLOAT_CONST(0.06132073630220858), MICROPY_FLOAT_CONST(0.9981181129001492), MICROPY_FLOAT_CONST(0.05519524434968994), MICROPY_FLOAT_CONST(0.9984755805732948),
+    MICROPY_FLOAT_CONST(0.049067674327418015), MICROPY_FLOAT_CONST(0.9987954562051724), MICROPY_FLOAT_CONST(0.04293825693494082), MICROPY_FLOAT_CONST(0.9990777277526454),
+    MICROPY_FLOAT_CONST(0.03680722294135883), MICROPY_FLOAT_CONST(0.9993223845883495), MICROPY_FLOAT_CONST(0.030674803176636626), MICROPY_FLOAT_CONST(0.9995294175010931),
+    MICROPY_FLOAT_CONST(0.024541228522912288), MICROPY_FLOAT_CONST(0.9996988186962042), MICROPY_FLOAT_CONST(0.01840672990580482), MICROPY_FLOAT_CONST(0.9998305817958234),
+    MICROPY_FLOAT_CONST(0.012271538285719925), MICROPY_FLOAT_CONST(0.9999247018391445), MICROPY_FLOAT_CONST(0.006135884649154475), MICROPY_FLOAT_CONST(0.9999811752826011),
+    MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0), MICROPY_FLOAT_CONST(-0.006135884649154475), MICROPY_FLOAT_CONST(0.9999811752826011),
+    MICROPY_FLOAT_CONST(-0.012271538285719925), MICROPY_FLOAT_CONST(0.9999247018391445), MICROPY_FLOAT_CONST(-0.01840672990580482), MICROPY_FLOAT_CONST(0.9998305817958234),
+    MICROPY_FLOAT_CONST(-0.024541228522912288), MICROPY_FLOAT_CONST(0.9996988186962042), MICROPY_FLOAT_CONST(-0.030674803176636626), MICROPY_FLOAT_CONST(0.9995294175010931),
+    MICROPY_FLOAT_CONST(-0.03680722294135883), MICROPY_FLOAT_CONST(0.9993223845883495), MICROPY_FLOAT_CONST(-0.04293825693494082), MICROPY_FLOAT_CONST(0.9990777277526454),
+    MICROPY_FLOAT_CONST(-0.049067674327418015), MICROPY_FLOAT_CONST(0.9987954562051724), MICROPY_FLOAT_CONST(-0.05519524434968994), MICROPY_FLOAT_CONST(0.9984755805732948),
+    MICROPY_FLOAT_CONST(-0.06132073630220858), MICROPY_FLOAT_CONST(0.9981181129001492), MICROPY_FLOAT_CONST(-0.06744391956366406), MICROPY_FLOAT_CONST(0.9977230666441916),
+    MICROPY_FLOAT_CONST(-0.07356456359966743), MICROPY_FLOAT_CONST(0.9972904566786902), MICROPY_FLOAT_CONST(-0.07968243797143013), MICROPY_FLOAT_CONST(0.9968202992911657),
+    MICROPY_FLOAT_CONST(-0.0857973123444399), MICROPY_FLOAT_CONST(0.996312612182778), MICROPY_FLOAT_CONST(-0.09190895649713272), MICROPY_FLOAT_CONST(0.9957674144676598),
+    MICROPY_FLOAT_CONST(-0.0980171403295606), MICROPY_FLOAT_CONST(0.9951847266721969), MICROPY_FLOAT_CONST(-0.10412163387205457), MICROPY_FLOAT_CONST(0.9945645707342554),
+    MICROPY_FLOAT_CONST(-0.11022220729388306), MICROPY_FLOAT_CONST(0.9939069700023561), MICROPY_FLOAT_CONST(-0.11631863091190477), MICROPY_FLOAT_CONST(0.9932119492347945),
+    MICROPY_FLOAT_CONST(-0.1224106751992162), MICROPY_FLOAT_CONST(0.99247953459871), MICROPY_FLOAT_CONST(-0.12849811079379317), MICROPY_FLOAT_CONST(0.9917097536690995),
+    MICROPY_FLOAT_CONST(-0.1345807085071262), MICROPY_FLOAT_CONST(0.99090263542778), MICROPY_FLOAT_CONST(-0.14065823933284924), MICROPY_FLOAT_CONST(0.9900582102622971),
+    MICROPY_FLOAT_CONST(-0.14673047445536175), MICROPY_FLOAT_CONST(0.989176509964781), MICROPY_FLOAT_CONST(-0.15279718525844344), MICROPY_FLOAT_CONST(0.9882575677307495),
+    MICROPY_FLOAT_CONST(-0.15885814333386145), MICROPY_FLOAT_CONST(0.9873014181578584), MICROPY_FLOAT_CONST(-0.16491312048996992), MICROPY_FLOAT_CONST(0.9863080972445987),
+    MICROPY_FLOAT_CONST(-0.17096188876030122), MICROPY_FLOAT_CONST(0.9852776423889412), MICROPY_FLOAT_CONST(-0.17700422041214875), MICROPY_FLOAT_CONST(0.984210092386929),
+    MICROPY_FLOAT_CONST(-0.18303988795514095), MICROPY_FLOAT_CONST(0.9831054874312163), MICROPY_FLOAT_CONST(-0.18906866414980622), MICROPY_FLOAT_CONST(0.9819638691095552),
+    MICROPY_FLOAT_CONST(-0.19509032201612828), MICROPY_FLOAT_CONST(0.9807852804032304), MICROPY_FLOAT_CONST(-0.2011046348420919), MICROPY_FLOAT_CONST(0.9795697656854405),
+    MICROPY_FLOAT_CONST(-0.20711137619221856), MICROPY_FLOAT_CONST(0.9783173707196277), MICROPY_FLOAT_CONST(-0.21311031991609136), MICROPY_FLOAT_CONST(0.9770281426577544),
+    MICROPY_FLOAT_CONST(-0.2191012401568698), MICROPY_FLOAT_CONST(0.9757021300385286), MICROPY_FLOAT_CONST(-0.22508391135979283), MICROPY_FLOAT_CONST(0.9743393827855759),
+    MICROPY_FLOAT_CONST(-0.2310581082806711), MICROPY_FLOAT_CONST(0.9729399522055602), MICROPY_FLOAT_CONST(-0.2370236059943672), MICROPY_FLOAT_CONST(0.9715038909862518),
+    MICROPY_FLOAT_CONST(-0.2429801799032639), MICROPY_FLOAT_CONST(0.970031253194544), MICROPY_FLOAT_CONST(-0.24892760574572018), MICROPY_FLOAT_CONST(0.9685220942744173),
+    MICROPY_FLOAT_CONST(-0.25486565960451457), MICROPY_FLOAT_CONST(0.9669764710448521), MICROPY_FLOAT_CONST(-0.2607941179152755), MICROPY_FLOAT_CONST(0.9653944416976894),
+    MICROPY_FLOAT_CONST(-0.26671275747489837), MICROPY_FLOAT_CONST(0.9637760657954398), MICROPY_FLOAT_CONST(-0.272621355449949), MICROPY_FLOAT_CONST(0.9621214042690416),
+    MICROPY_FLOAT_CONST(-0.2785196893850531), MICROPY_FLOAT_CONST(0.9604305194155658), MICROPY_FLOAT_CONST(-0.2844075372112718), MICROPY_FLOAT_CONST(0.9587034748958716),
+    MICROPY_FLOAT_CONST(-0.2902846772544624), MICROPY_FLOAT_CONST(0.9569403357322088), MICROPY_FLOAT_CONST(-0.29615088824362384), MICROPY_FLOAT_CONST(0.9551411683057707),
+    MICROPY_FLOAT_CONST(-0.3020059493192281), MICROPY_FLOAT_CONST(0.9533060403541939), MICROPY_FLOAT_CONST(-0.30784964004153487), MICROPY_FLOAT_CONST(0.9514350209690083),
+    MICROPY_FLOAT_CONST(-0.31368174039889146), MICROPY_FLOAT_CONST(0.9495281805930367), MICROPY_FLOAT_CONST(-0.3195020308160157), MICROPY_FLOAT_CONST(0.9475855910177411),
+    MICROPY_FLOAT_CONST(-0.3253102921622629), MICROPY_FLOAT_CONST(0.9456073253805213), MICROPY_FLOAT_CONST(-0.33110630575987643), MICROPY_FLOAT_CONST(0.9435934581619604),
+    MICROPY_FLOAT_CONST(-0.33688985339222005), MICROPY_FLOAT_CONST(0.9415440651830208), MICROPY_FLOAT_CONST(-0.3426607173119944), MICROPY_FLOAT_CONST(0.9394592236021899),
+    MICROPY_FLOAT_CONST(-0.34841868024943456), MICROPY_FLOAT_CONST(0.937339011912575), MICROPY_FLOAT_CONST(-0.3541635254204904), MICROPY_FLOAT_CONST(0.9351835099389476),
+    MICROPY_FLOAT_CONST(-0.35989503653498817), MICROPY_FLOAT_CONST(0.9329927988347388), MICROPY_FLOAT_CONST(-0.36561299780477385), MICROPY_FLOAT_CONST(0.9307669610789837),
+    MICROPY_FLOAT_CONST(-0.37131719395183754), MICROPY_FLOAT_CONST(0.9285060804732156), MICROPY_FLOAT_CONST(-0.37700741021641826), MICROPY_FLOAT_CONST(0.9262102421383114),
+    MICROPY_FLOAT_CONST(-0.3826834323650898), MICROPY_FLOAT_CONST(0.9238795325112867), MICROPY_FLOAT_CONST(-0.3883450466988263), MICROPY_FLOAT_CONST(0.9215140393420419),
+    MICROPY_FLOAT_CONST(-0.3939920400610481), MICROPY_FLOAT_CONST(0.9191138516900578), MICROPY_FLOAT_CONST(-0.39962419984564684), MICROPY_FLOAT_CONST(0.9166790599210427),
+    MICROPY_FLOAT_CONST(-0.40524131400498986), MICROPY_FLOAT_CONST(0.9142097557035307), MICROPY_FLOAT_CONST(-0.41084317105790397), MICROPY_FLOAT_CONST(0.9117060320054299),
+    MICROPY_FLOAT_CONST(-0.4164295600976372), MICROPY_FLOAT_CONST(0.9091679830905224), MICROPY_FLOAT_CONST(-0.4220002707997997), MICROPY_FLOAT_CONST(0.9065957045149153),
+    MICROPY_FLOAT_CONST(-0.4275550934302821), MICROPY_FLOAT_CONST(0.9039892931234433), MICROPY_FLOAT_CONST(-0.43309381885315196), MICROPY_FLOAT_CONST(0.901348847046022),
+    MICROPY_FLOAT_CONST(-0.43861623853852766), MICROPY_FLOAT_CONST(0.8986744656939538), MICROPY_FLOAT_CONST(-0.44412214457042926), MICROPY_FLOAT_CONST(0.8959662497561851),
+    MICROPY_FLOAT_CONST(-0.4496113296546066), MICROPY_FLOAT_CONST(0.8932243011955153), MICROPY_FLOAT_CONST(-0.45508358712634384), MICROPY_FLOAT_CONST(0.8904487232447579),
+    MICROPY_FLOAT_CONST(-0.46053871095824), MICROPY_FLOAT_CONST(0.8876396204028539), MICROPY_FLOAT_CONST(-0.4659764957679662), MICROPY_FLOAT_CONST(0.8847970984309378),
+    MICROPY_FLOAT_CONST(-0.47139673682599764), MICROPY_FLOAT_CONST(0.881921264348355), MICROPY_FLOAT_CONST(-0.47679923006332214), MICROPY_FLOAT_CONST(0.8790122264286335),
+    MICROPY_FLOAT_CONST(-0.4821837720791228), MICROPY_FLOAT_CONST(0.8760700941954066), MICROPY_FLOAT_CONST(-0.48755016014843594), MICROPY_FLOAT_CONST(0.8730949784182901),
+    MICROPY_FLOAT_CONST(-0.49289819222978404), MICROPY_FLOAT_CONST(0.8700869911087115), MICROPY_FLOAT_CONST(-0.49822766697278187), MICROPY_FLOAT_CONST(0.8670462455156926),
+    MICROPY_FLOAT_CONST(-0.5035383837257176), MICROPY_FLOAT_CONST(0.8639728561215867), MICROPY_FLOAT_CONST(-0.508830142543107), MICROPY_FLOAT_CONST(0.8608669386377673),
+    MICROPY_FLOAT_CONST(-0.5141027441932218), MICROPY_FLOAT_CONST(0.8577286100002721), MICROPY_FLOAT_CONST(-0.5193559901655896), MICROPY_FLOAT_CONST(0.8545579883654005),
+    MICROPY_FLOAT_CONST(-0.524589682678469), MICROPY_FLOAT_CONST(0.8513551931052652), MICROPY_FLOAT_CONST(-0.5298036246862947), MICROPY_FLOAT_CONST(0.8481203448032972),
+    MICROPY_FLOAT_CONST(-0.5349976198870973), MICROPY_FLOAT_CONST(0.8448535652497071), MICROPY_FLOAT_CONST(-0.5401714727298929), MICROPY_FLOAT_CONST(0.8415549774368984),
+    MICROPY_FLOAT_CONST(-0.5453249884220465), MICROPY_FLOAT_CONST(0.8382247055548381), MICROPY_FLOAT_CONST(-0.5504579729366048), MICROPY_FLOAT_CONST(0.83486287498638),
+    MICROPY_FLOAT_CONST(-0.5555702330196022), MICROPY_FLOAT_CONST(0.8314696123025452), MICROPY_FLOAT_CONST(-0.560661576197336), MICROPY_FLOAT_CONST(0.8280450452577558),
+    MICROPY_FLOAT_CONST(-0.5657318107836132), MICROPY_FLOAT_CONST(0.8245893027850253), MICROPY_FLOAT_CONST(-0.5707807458869673), MICROPY_FLOAT_CONST(0.8211025149911046),
+    MICROPY_FLOAT_CONST(-0.5758081914178453), MICROPY_FLOAT_CONST(0.8175848131515837), MICROPY_FLOAT_CONST(-0.5808139580957645), MICROPY_FLOAT_CONST(0.8140363297059484),
+    MICROPY_FLOAT_CONST(-0.5857978574564389), MICROPY_FLOAT_CONST(0.8104571982525948), MICROPY_FLOAT_CONST(-0.5907597018588743), MICROPY_FLOAT_CONST(0.8068475535437992),
+    MICROPY_FLOAT_CONST(-0.5956993044924334), MICROPY_FLOAT_CONST(0.8032075314806449), MICROPY_FLOAT_CONST(-0.600616479383869), MICROPY_FLOAT_CONST(0.799537269107905),
+    MICROPY_FLOAT_CONST(-0.6055110414043255), MICROPY_FLOAT_CONST(0.7958369046088836), MICROPY_FLOAT_CONST(-0.6103828062763095), MICROPY_FLOAT_CONST(0.7921065773002124),
+    MICROPY_FLOAT_CONST(-0.6152315905806268), MICROPY_FLOAT_CONST(0.7883464276266062), MICROPY_FLOAT_CONST(-0.6200572117632892), MICROPY_FLOAT_CONST(0.7845565971555752),
+    MICROPY_FLOAT_CONST(-0.6248594881423863), MICROPY_FLOAT_CONST(0.7807372285720945), MICROPY_FLOAT_CONST(-0.629638238914927), MICROPY_FLOAT_CONST(0.7768884656732324),
+    MICROPY_FLOAT_CONST(-0.6343932841636455), MICROPY_FLOAT_CONST(0.773010453362737), MICROPY_FLOAT_CONST(-0.6391244448637757), MICROPY_FLOAT_CONST(0.7691033376455796),
+    MICROPY_FLOAT_CONST(-0.6438315428897915), MICROPY_FLOAT_CONST(0.765167265622459), MICROPY_FLOAT_CONST(-0.6485144010221124), MICROPY_FLOAT_CONST(0.7612023854842618),
+    MICROPY_FLOAT_CONST(-0.6531728429537768), MICROPY_FLOAT_CONST(0.7572088465064846), MICROPY_FLOAT_CONST(-0.6578066932970786), MICROPY_FLOAT_CONST(0.7531867990436125),
+    MICROPY_FLOAT_CONST(-0.6624157775901718), MICROPY_FLOAT_CONST(0.7491363945234594), MICROPY_FLOAT_CONST(-0.6669999223036375), MICROPY_FLOAT_CONST(0.745057785441466),
+    MICROPY_FLOAT_CONST(-0.6715589548470184), MICROPY_FLOAT_CONST(0.7409511253549591), MICROPY_FLOAT_CONST(-0.6760927035753159), MICROPY_FLOAT_CONST(0.7368165688773699),
+    MICROPY_FLOAT_CONST(-0.680600997795453), MICROPY_FLOAT_CONST(0.7326542716724128), MICROPY_FLOAT_CONST(-0.6850836677727004), MICROPY_FLOAT_CONST(0.7284643904482252),
+    MICROPY_FLOAT_CONST(-0.6895405447370669), MICROPY_FLOAT_CONST(0.7242470829514669), MICROPY_FLOAT_CONST(-0.693971460889654), MICROPY_FLOAT_CONST(0.7200025079613817),
+    MICROPY_FLOAT_CONST(-0.6983762494089728), MICROPY_FLOAT_CONST(0.7157308252838187), MICROPY_FLOAT_CONST(-0.7027547444572253), MICROPY_FLOAT_CONST(0.7114321957452164),
+    MICROPY_FLOAT_CONST(-0.7071067811865476), MICROPY_FLOAT_CONST(0.7071067811865476), MICROPY_FLOAT_CONST(-0.7114321957452164), MICROPY_FLOAT_CONST(0.7027547444572253),
+    MICROPY_FLOAT_CONST(-0.7157308252838187), MICROPY_FLOAT_CONST(0.6983762494089728), MICROPY_FLOAT_CONST(-0.7200025079613817), MICROPY_FLOAT_CONST(0.693971460889654),
+    MICROPY_FLOAT_CONST(-0.7242470829514669), MICROPY_FLOAT_CONST(0.6895405447370669), MICROPY_FLOAT_CONST(-0.7284643904482252), MICROPY_FLOAT_CONST(0.6850836677727004),
+    MICROPY_FLOAT_CONST(-0.7326542716724128), MICROPY_FLOAT_CONST(0.680600997795453), MICROPY_FLOAT_CONST(-0.7368165688773699), MICROPY_FLOAT_CONST(0.6760927035753159),
+    MICROPY_FLOAT_CONST(-0.7409511253549591), MICROPY_FLOAT_CONST(0.6715589548470184), MICROPY_FLOAT_CONST(-0.745057785441466), MICROPY_FLOAT_CONST(0.6669999223036375),
+    MICROPY_FLOAT_CONST(-0.7491363945234594), MICROPY_FLOAT_CONST(0.6624157775901718), MICROPY_FLOAT_CONST(-0.7531867990436125), MICROPY_FLOAT_CONST(0.6578066932970786),
+    MICROPY_FLOAT_CONST(-0.7572088465064846), MICROPY_FLOAT_CONST(0.6531728429537768), MICROPY_FLOAT_CONST(-0.7612023854842618), MICROPY_FLOAT_CONST(0.6485144010221124),
+    MICROPY_FLOAT_CONST(-0.765167265622459), MICROPY_FLOAT_CONST(0.6438315428897915), MICROPY_FLOAT_CONST(-0.7691033376455796), MICROPY_FLOAT_CONST(0.6391244448637757),
+    MICROPY_FLOAT_CONST(-0.773010453362737), MICROPY_FLOAT_CONST(0.6343932841636455), MICROPY_FLOAT_CONST(-0.7768884656732324), MICROPY_FLOAT_CONST(0.629638238914927),
+    MICROPY_FLOAT_CONST(-0.7807372285720945), MICROPY_FLOAT_CONST(0.6248594881423863), MICROPY_FLOAT_CONST(-0.7845565971555752), MICROPY_FLOAT_CONST(0.6200572117632892),
+    MICROPY_FLOAT_CONST(-0.7883464276266062), MICROPY_FLOAT_CONST(0.6152315905806268), MICROPY_FLOAT_CONST(-0.7921065773002124), MICROPY_FLOAT_CONST(0.6103828062763095),
+    MICROPY_FLOAT_CONST(-0.7958369046088836), MICROPY_FLOAT_CONST(0.6055110414043255), MICROPY_FLOAT_CONST(-0.799537269107905), MICROPY_FLOAT_CONST(0.600616479383869),
+    MICROPY_FLOAT_CONST(-0.8032075314806449), MICROPY_FLOAT_CONST(0.5956993044924334), MICROPY_FLOAT_CONST(-0.8068475535437992), MICROPY_FLOAT_CONST(0.5907597018588743),
+    MICROPY_FLOAT_CONST(-0.8104571982525948), MICROPY_FLOAT_CONST(0.5857978574564389), MICROPY_FLOAT_CONST(-0.8140363297059484), MICROPY_FLOAT_CONST(0.5808139580957645),
+    MICROPY_FLOAT_CONST(-0.8175848131515837), MICROPY_FLOAT_CONST(0.5758081914178453), MICROPY_FLOAT_CONST(-0.8211025149911046), MICROPY_FLOAT_CONST(0.5707807458869673),
+    MICROPY_FLOAT_CONST(-0.8245893027850253), MICROPY_FLOAT_CONST(0.5657318107836132), MICROPY_FLOAT_CONST(-0.8280450452577558), MICROPY_FLOAT_CONST(0.560661576197336),
+    MICROPY_FLOAT_CONST(-0.8314696123025452), MICROPY_FLOAT_CONST(0.5555702330196022), MICROPY_FLOAT_CONST(-0.83486287498638), MICROPY_FLOAT_CONST(0.5504579729366048),
+    MICROPY_FLOAT_CONST(-0.8382247055548381), MICROPY_FLOAT_CONST(0.5453249884220465), MICROPY_FLOAT_CONST(-0.8415549774368984), MICROPY_FLOAT_CONST(0.5401714727298929),
+    MICROPY_FLOAT_CONST(-0.8448535652497071), MICROPY_FLOAT_CONST(0.5349976198870973), MICROPY_FLOAT_CONST(-0.8481203448032972), MICROPY_FLOAT_CONST(0.5298036246862947),
+    MICROPY_FLOAT_CONST(-0.8513551931052652), MICROPY_FLOAT_CONST(0.524589682678469), MICROPY_FLOAT_CONST(-0.8545579883654005), MICROPY_FLOAT_CONST(0.5193559901655896),
+    MICROPY_FLOAT_CONST(-0.8577286100002721), MICROPY_FLOAT_CONST(0.5141027441932218), MICROPY_FLOAT_CONST(-0.8608669386377673), MICROPY_FLOAT_CONST(0.508830142543107),
+    MICROPY_FLOAT_CONST(-0.8639728561215867), MICROPY_FLOAT_CONST(0.5035383837257176), MICROPY_FLOAT_CONST(-0.8670462455156926), MICROPY_FLOAT_CONST(0.49822766697278187),
+    MICROPY_FLOAT_CONST(-0.8700869911087115), MICROPY_FLOAT_CONST(0.49289819222978404), MICROPY_FLOAT_CONST(-0.8730949784182901), MICROPY_FLOAT_CONST(0.48755016014843594),
+    MICROPY_FLOAT_CONST(-0.8760700941954066), MICROPY_FLOAT_CONST(0.4821837720791228), MICROPY_FLOAT_CONST(-0.8790122264286335), MICROPY_FLOAT_CONST(0.47679923006332214),
+    MICROPY_FLOAT_CONST(-0.881921264348355), MICROPY_FLOAT_CONST(0.47139673682599764), MICROPY_FLOAT_CONST(-0.8847970984309378), MICROPY_FLOAT_CONST(0.4659764957679662),
+    MICROPY_FLOAT_CONST(-0.8876396204028539), MICROPY_FLOAT_CONST(0.46053871095824), MICROPY_FLOAT_CONST(-0.8904487232447579), MICROPY_FLOAT_CONST(0.45508358712634384),
+    MICROPY_FLOAT_CONST(-0.8932243011955153), MICROPY_FLOAT_CONST(0.4496113296546066), MICROPY_FLOAT_CONST(-0.8959662497561851), MICROPY_FLOAT_CONST(0.44412214457042926),
+    MICROPY_FLOAT_CONST(-0.8986744656939538), MICROPY_FLOAT_CONST(0.43861623853852766), MICROPY_FLOAT_CONST(-0.901348847046022), MICROPY_FLOAT_CONST(0.43309381885315196),
+    MICROPY_FLOAT_CONST(-0.9039892931234433), MICROPY_FLOAT_CONST(0.4275550934302821), MICROPY_FLOAT_CONST(-0.9065957045149153), MICROPY_FLOAT_CONST(0.4220002707997997),
+    MICROPY_FLOAT_CONST(-0.9091679830905224), MICROPY_FLOAT_CONST(0.4164295600976372), MICROPY_FLOAT_CONST(-0.9117060320054299), MICROPY_FLOAT_CONST(0.41084317105790397),
+    MICROPY_FLOAT_CONST(-0.9142097557035307), MICROPY_FLOAT_CONST(0.40524131400498986), MICROPY_FLOAT_CONST(-0.9166790599210427), MICROPY_FLOAT_CONST(0.39962419984564684),
+    MICROPY_FLOAT_CONST(-0.9191138516900578), MICROPY_FLOAT_CONST(0.3939920400610481), MICROPY_FLOAT_CONST(-0.9215140393420419), MICROPY_FLOAT_CONST(0.3883450466988263),
+    MICROPY_FLOAT_CONST(-0.9238795325112867), MICROPY_FLOAT_CONST(0.3826834323650898), MICROPY_FLOAT_CONST(-0.9262102421383114), MICROPY_FLOAT_CONST(0.37700741021641826),
+    MICROPY_FLOAT_CONST(-0.9285060804732156), MICROPY_FLOAT_CONST(0.37131719395183754), MICROPY_FLOAT_CONST(-0.9307669610789837), MICROPY_FLOAT_CONST(0.36561299780477385),
+    MICROPY_FLOAT_CONST(-0.9329927988347388), MICROPY_FLOAT_CONST(0.35989503653498817), MICROPY_FLOAT_CONST(-0.9351835099389476), MICROPY_FLOAT_CONST(0.3541635254204904),
+    MICROPY_FLOAT_CONST(-0.937339011912575), MICROPY_FLOAT_CONST(0.34841868024943456), MICROPY_FLOAT_CONST(-0.9394592236021899), MICROPY_FLOAT_CONST(0.3426607173119944),
+    MICROPY_FLOAT_CONST(-0.9415440651830208), MICROPY_FLOAT_CONST(0.33688985339222005), MICROPY_FLOAT_CONST(-0.9435934581619604), MICROPY_FLOAT_CONST(0.33110630575987643),
+    MICROPY_FLOAT_CONST(-0.9456073253805213), MICROPY_FLOAT_CONST(0.3253102921622629), MICROPY_FLOAT_CONST(-0.9475855910177411), MICROPY_FLOAT_CONST(0.3195020308160157),
+    MICROPY_FLOAT_CONST(-0.9495281805930367), MICROPY_FLOAT_CONST(0.31368174039889146), MICROPY_FLOAT_CONST(-0.9514350209690083), MICROPY_FLOAT_CONST(0.30784964004153487),
+    MICROPY_FLOAT_CONST(-0.9533060403541939), MICROPY_FLOAT_CONST(0.3020059493192281), MICROPY_FLOAT_CONST(-0.9551411683057707), MICROPY_FLOAT_CONST(0.29615088824362384),
+    MICROPY_FLOAT_CONST(-0.9569403357322088), MICROPY_FLOAT_CONST(0.2902846772544624), MICROPY_FLOAT_CONST(-0.9587034748958716), MICROPY_FLOAT_CONST(0.2844075372112718),
+    MICROPY_FLOAT_CONST(-0.9604305194155658), MICROPY_FLOAT_CONST(0.2785196893850531), MICROPY_FLOAT_CONST(-0.9621214042690416), MICROPY_FLOAT_CONST(0.272621355449949),
+    MICROPY_FLOAT_CONST(-0.9637760657954398), MICROPY_FLOAT_CONST(0.26671275747489837), MICROPY_FLOAT_CONST(-0.9653944416976894), MICROPY_FLOAT_CONST(0.2607941179152755),
+    MICROPY_FLOAT_CONST(-0.9669764710448521), MICROPY_FLOAT_CONST(0.25486565960451457), MICROPY_FLOAT_CONST(-0.9685220942744173), MICROPY_FLOAT_CONST(0.24892760574572018),
+    MICROPY_FLOAT_CONST(-0.970031253194544), MICROPY_FLOAT_CONST(0.2429801799032639), MICROPY_FLOAT_CONST(-0.9715038909862518), MICROPY_FLOAT_CONST(0.2370236059943672),
+    MICROPY_FLOAT_CONST(-0.9729399522055602), MICROPY_FLOAT_CONST(0.2310581082806711), MICROPY_FLOAT_CONST(-0.9743393827855759), MICROPY_FLOAT_CONST(0.22508391135979283),
+    MICROPY_FLOAT_CONST(-0.9757021300385286), MICROPY_FLOAT_CONST(0.2191012401568698), MICROPY_FLOAT_CONST(-0.9770281426577544), MICROPY_FLOAT_CONST(0.21311031991609136),
+    MICROPY_FLOAT_CONST(-0.9783173707196277), MICROPY_FLOAT_CONST(0.20711137619221856), MICROPY_FLOAT_CONST(-0.9795697656854405), MICROPY_FLOAT_CONST(0.2011046348420919),
+    MICROPY_FLOAT_CONST(-0.9807852804032304), MICROPY_FLOAT_CONST(0.19509032201612828), MICROPY_FLOAT_CONST(-0.9819638691095552), MICROPY_FLOAT_CONST(0.18906866414980622),
+    MICROPY_FLOAT_CONST(-0.9831054874312163), MICROPY_FLOAT_CONST(0.18303988795514095), MICROPY_FLOAT_CONST(-0.984210092386929), MICROPY_FLOAT_CONST(0.17700422041214875),
+    MICROPY_FLOAT_CONST(-0.9852776423889412), MICROPY_FLOAT_CONST(0.17096188876030122), MICROPY_FLOAT_CONST(-0.9863080972445987), MICROPY_FLOAT_CONST(0.16491312048996992),
+    MICROPY_FLOAT_CONST(-0.9873014181578584), MICROPY_FLOAT_CONST(0.15885814333386145), MICROPY_FLOAT_CONST(-0.9882575677307495), MICROPY_FLOAT_CONST(0.15279718525844344),
+    MICROPY_FLOAT_CONST(-0.989176509964781), MICROPY_FLOAT_CONST(0.14673047445536175), MICROPY_FLOAT_CONST(-0.9900582102622971), MICROPY_FLOAT_CONST(0.14065823933284924),
+    MICROPY_FLOAT_CONST(-0.99090263542778), MICROPY_FLOAT_CONST(0.1345807085071262), MICROPY_FLOAT_CONST(-0.9917097536690995), MICROPY_FLOAT_CONST(0.12849811079379317),
+    MICROPY_FLOAT_CONST(-0.99247953459871), MICROPY_FLOAT_CONST(0.1224106751992162), MICROPY_FLOAT_CONST(-0.9932119492347945), MICROPY_FLOAT_CONST(0.11631863091190477),
+    MICROPY_FLOAT_CONST(-0.9939069700023561), MICROPY_FLOAT_CONST(0.11022220729388306), MICROPY_FLOAT_CONST(-0.9945645707342554), MICROPY_FLOAT_CONST(0.10412163387205457),
+    MICROPY_FLOAT_CONST(-0.9951847266721969), MICROPY_FLOAT_CONST(0.0980171403295606), MICROPY_FLOAT_CONST(-0.9957674144676598), MICROPY_FLOAT_CONST(0.09190895649713272),
+    MICROPY_FLOAT_CONST(-0.996312612182778), MICROPY_FLOAT_CONST(0.0857973123444399), MICROPY_FLOAT_CONST(-0.9968202992911657), MICROPY_FLOAT_CONST(0.07968243797143013),
+    MICROPY_FLOAT_CONST(-0.9972904566786902), MICROPY_FLOAT_CONST(0.07356456359966743), MICROPY_FLOAT_CONST(-0.9977230666441916), MICROPY_FLOAT_CONST(0.06744391956366406),
+    MICROPY_FLOAT_CONST(-0.9981181129001492), MICROPY_FLOAT_CONST(0.06132073630220858), MICROPY_FLOAT_CONST(-0.9984755805732948), MICROPY_FLOAT_CONST(0.05519524434968994),
+    MICROPY_FLOAT_CONST(-0.9987954562051724), MICROPY_FLOAT_CONST(0.049067674327418015), MICROPY_FLOAT_CONST(-0.9990777277526454), MICROPY_FLOAT_CONST(0.04293825693494082),
+    MICROPY_FLOAT_CONST(-0.9993223845883495), MICROPY_FLOAT_CONST(0.03680722294135883), MICROPY_FLOAT_CONST(-0.9995294175010931), MICROPY_FLOAT_CONST(0.030674803176636626),
+    MICROPY_FLOAT_CONST(-0.9996988186962042), MICROPY_FLOAT_CONST(0.024541228522912288), MICROPY_FLOAT_CONST(-0.9998305817958234), MICROPY_FLOAT_CONST(0.01840672990580482),
+    MICROPY_FLOAT_CONST(-0.9999247018391445), MICROPY_FLOAT_CONST(0.012271538285719925), MICROPY_FLOAT_CONST(-0.9999811752826011), MICROPY_FLOAT_CONST(0.006135884649154475)
+};
+
+#endif /* _FFT_TWIDDLE_ */
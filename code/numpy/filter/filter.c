@@ -20,65 +20,269 @@
 #include "py/misc.h"
 
 #include "../../ulab.h"
+#include "../../ulab_tools.h"
 #include "../../scipy/signal/signal.h"
+#include "../fft/fft_tools.h"
 #include "filter.h"
 
-#if ULAB_NUMPY_HAS_CONVOLVE
-
-mp_obj_t filter_convolve(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_a, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
-        { MP_QSTR_v, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
-    };
+#if ULAB_NUMPY_HAS_CONVOLVE || ULAB_NUMPY_HAS_CORRELATE
 
-    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
-    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+enum FILTER_MODE {
+    FILTER_MODE_VALID,
+    FILTER_MODE_SAME,
+    FILTER_MODE_FULL,
+};
 
-    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type) || !mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type)) {
+static ndarray_obj_t *filter_input_array(mp_obj_t arg) {
+    if(!mp_obj_is_type(arg, &ulab_ndarray_type)) {
         mp_raise_TypeError(translate("convolve arguments must be ndarrays"));
     }
-
-    ndarray_obj_t *a = MP_OBJ_TO_PTR(args[0].u_obj);
-    ndarray_obj_t *c = MP_OBJ_TO_PTR(args[1].u_obj);
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(arg);
     // deal with linear arrays only
     #if ULAB_MAX_DIMS > 1
-    if((a->ndim != 1) || (c->ndim != 1)) {
+    if(ndarray->ndim != 1) {
         mp_raise_TypeError(translate("convolve arguments must be linear arrays"));
     }
     #endif
-    size_t len_a = a->len;
-    size_t len_c = c->len;
-    if(len_a == 0 || len_c == 0) {
+    #if ULAB_SUPPORTS_COMPLEX
+    if(ndarray->dtype == NDARRAY_COMPLEX) {
+        mp_raise_TypeError(translate("convolve arguments must be real"));
+    }
+    #endif
+    if(ndarray->len == 0) {
         mp_raise_TypeError(translate("convolve arguments must not be empty"));
     }
+    return ndarray;
+}
 
-    int len = len_a + len_c - 1; // convolve mode "full"
-    ndarray_obj_t *out = ndarray_new_linear_array(len, NDARRAY_FLOAT);
-    mp_float_t *outptr = (mp_float_t *)out->array;
-    uint8_t *aarray = (uint8_t *)a->array;
-    uint8_t *carray = (uint8_t *)c->array;
-    
-    int32_t off = len_c - 1;
-    int32_t as = a->strides[ULAB_MAX_DIMS - 1] / a->itemsize;
-    int32_t cs = c->strides[ULAB_MAX_DIMS - 1] / c->itemsize;
-
-    for(int32_t k=-off; k < len-off; k++) {
-        mp_float_t accum = (mp_float_t)0.0;
-        int32_t top_n = MIN(len_c, len_a - k);
-        int32_t bot_n = MAX(-k, 0);
-        for(int32_t n=bot_n; n < top_n; n++) {
-            int32_t idx_c = (len_c - n - 1) * cs;
-            int32_t idx_a = (n + k) * as;
-            mp_float_t ai = ndarray_get_float_index(aarray, a->dtype, idx_a);
-            mp_float_t ci = ndarray_get_float_index(carray, c->dtype, idx_c);
-            accum += ai * ci;
+static mp_float_t *filter_load(ndarray_obj_t *ndarray, bool reverse) {
+    // copies the elements of a linear array into a dense float buffer, so that
+    // the inner loops do not have to deal with the dtype, and the strides
+    mp_float_t *buffer = m_new(mp_float_t, ndarray->len);
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+    uint8_t *array = (uint8_t *)ndarray->array;
+    int32_t stride = ndarray->strides[ULAB_MAX_DIMS - 1];
+    if(reverse) {
+        array += (int32_t)(ndarray->len - 1) * stride;
+        stride = -stride;
+    }
+    for(size_t i=0; i < ndarray->len; i++) {
+        buffer[i] = func(array);
+        array += stride;
+    }
+    return buffer;
+}
+
+static void filter_direct(const mp_float_t *x, size_t n, const mp_float_t *h, size_t m, mp_float_t *out, size_t start, size_t len) {
+    // calculates the elements start...start + len - 1 of the full convolution of x, and h
+    for(size_t k=start; k < start + len; k++) {
+        size_t i0 = k + 1 > m ? k + 1 - m : 0;
+        size_t i1 = k < n ? k + 1 : n;
+        const mp_float_t *xp = x + i0;
+        const mp_float_t *hp = h + (k - i0);
+        mp_float_t accum = MICROPY_FLOAT_CONST(0.0);
+        for(size_t i=i0; i < i1; i++) {
+            accum += *xp++ * *hp--;
+        }
+        *out++ = accum;
+    }
+}
+
+#if ULAB_NUMPY_CONVOLVE_FFT_THRESHOLD
+static void filter_overlap_add(const mp_float_t *x, size_t n, const mp_float_t *h, size_t m, mp_float_t *out, size_t start, size_t len) {
+    // The same as filter_direct, but x is cut into blocks of length L - m + 1, and the blocks
+    // are convolved with h by means of real FFTs of length L. The tails of the blocks overlap
+    // with the next blocks, and are added to the output. m must not be larger than n.
+
+    // the FFT length is chosen such that the number of operations per output sample is minimal
+    size_t full = n + m - 1;
+    size_t L = 2;
+    uint8_t bits = 1;
+    while(L < 2 * m) {
+        L <<= 1;
+        bits++;
+    }
+    size_t best = L;
+    mp_float_t best_cost = MICROPY_FLOAT_CONST(0.0);
+    while(true) {
+        mp_float_t cost = (mp_float_t)L * (bits + 1) / (mp_float_t)(L - m + 1);
+        if((best_cost == MICROPY_FLOAT_CONST(0.0)) || (cost < best_cost)) {
+            best = L;
+            best_cost = cost;
+        }
+        // a single block holds the whole convolution
+        if(L >= full) {
+            break;
+        }
+        L <<= 1;
+        bits++;
+    }
+    L = best;
+    size_t N = L / 2;
+    size_t block = L - m + 1;
+
+    fft_plan_obj_t plan;
+    fft_plan_init(&plan, L, true);
+
+    // the transform of the zero-padded kernel, and the work arrays; the even, and odd
+    // samples are packed into the real, and imaginary parts, as in fft_rfft_kernel
+    mp_float_t *kr = m_new0(mp_float_t, 4 * (N + 1));
+    mp_float_t *ki = kr + N + 1;
+    mp_float_t *wr = ki + N + 1;
+    mp_float_t *wi = wr + N + 1;
+    for(size_t i=0; i < m; i++) {
+        if(i & 1) {
+            ki[i / 2] = h[i];
+        } else {
+            kr[i / 2] = h[i];
         }
-        *outptr++ = accum;
     }
+    fft_rfft_kernel(&plan, kr, ki);
 
-    return out;
+    memset(out, 0, len * sizeof(mp_float_t));
+    for(size_t b=0; b < n; b += block) {
+        size_t count = MIN(block, n - b);
+        // the output samples of this block are b...b + count + m - 2
+        if((b + count + m - 1 <= start) || (b >= start + len)) {
+            continue;
+        }
+        memset(wr, 0, 2 * (N + 1) * sizeof(mp_float_t));
+        for(size_t i=0; i < count; i++) {
+            if(i & 1) {
+                wi[i / 2] = x[b + i];
+            } else {
+                wr[i / 2] = x[b + i];
+            }
+        }
+        fft_rfft_kernel(&plan, wr, wi);
+        for(size_t k=0; k <= N; k++) {
+            mp_float_t re = wr[k] * kr[k] - wi[k] * ki[k];
+            wi[k] = wr[k] * ki[k] + wi[k] * kr[k];
+            wr[k] = re;
+        }
+        fft_irfft_kernel(&plan, wr, wi);
+        for(size_t i=0; i < count + m - 1; i++) {
+            size_t k = b + i;
+            if((k >= start) && (k < start + len)) {
+                out[k - start] += (i & 1) ? wi[i / 2] : wr[i / 2];
+            }
+        }
+    }
+    m_del(mp_float_t, kr, 4 * (N + 1));
+    fft_plan_free(&plan);
+}
+#endif /* ULAB_NUMPY_CONVOLVE_FFT_THRESHOLD */
+
+static mp_obj_t filter_convolve_correlate(mp_obj_t arg_a, mp_obj_t arg_v, mp_obj_t arg_mode, bool correlate) {
+    ndarray_obj_t *a = filter_input_array(arg_a);
+    ndarray_obj_t *v = filter_input_array(arg_v);
+
+    uint8_t mode;
+    qstr name = mp_obj_is_str(arg_mode) ? mp_obj_str_get_qstr(arg_mode) : MP_QSTR_;
+    if(name == MP_QSTR_full) {
+        mode = FILTER_MODE_FULL;
+    } else if(name == MP_QSTR_same) {
+        mode = FILTER_MODE_SAME;
+    } else if(name == MP_QSTR_valid) {
+        mode = FILTER_MODE_VALID;
+    } else {
+        mp_raise_ValueError(translate("mode must be 'full', 'same', or 'valid'"));
+    }
+
+    // the correlation is the convolution with the reversed second argument
+    size_t n = a->len, m = v->len;
+    mp_float_t *x = filter_load(a, false);
+    mp_float_t *h = filter_load(v, correlate);
+
+    // the output is a slice of the full convolution; as in numpy, 'same' is centred on the
+    // longer argument, except for the correlation with a longer second argument, which is
+    // calculated as the reversed correlation of the swapped arguments
+    size_t shorter = MIN(n, m), longer = MAX(n, m);
+    size_t start = 0, len = n + m - 1;
+    if(mode == FILTER_MODE_SAME) {
+        start = (correlate && (n < m)) ? shorter / 2 : (shorter - 1) / 2;
+        len = longer;
+    } else if(mode == FILTER_MODE_VALID) {
+        start = shorter - 1;
+        len = longer - shorter + 1;
+    }
+
+    ndarray_obj_t *out = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    mp_float_t *array = (mp_float_t *)out->array;
+
+    // the convolution is commutative, and the shorter argument is used as the kernel
+    if(m > n) {
+        SWAP(mp_float_t *, x, h);
+        SWAP(size_t, n, m);
+    }
+    #if ULAB_NUMPY_CONVOLVE_FFT_THRESHOLD
+    if((m >= ULAB_NUMPY_CONVOLVE_FFT_MIN_LENGTH) && ((mp_float_t)n * (mp_float_t)m > (mp_float_t)ULAB_NUMPY_CONVOLVE_FFT_THRESHOLD)) {
+        filter_overlap_add(x, n, h, m, array, start, len);
+    } else {
+    #endif
+        filter_direct(x, n, h, m, array, start, len);
+    #if ULAB_NUMPY_CONVOLVE_FFT_THRESHOLD
+    }
+    #endif
+
+    m_del(mp_float_t, x, n);
+    m_del(mp_float_t, h, m);
+    return MP_OBJ_FROM_PTR(out);
+}
+#endif
+
+#if ULAB_NUMPY_HAS_CONVOLVE
+//| def convolve(a: ulab.ndarray, v: ulab.ndarray, mode: str = 'full') -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray a:
+//|     :param ulab.ndarray v:
+//|     :param str mode: One of 'full', 'same', or 'valid'
+//|
+//|     Return the discrete, linear convolution of two one-dimensional arrays. Long convolutions
+//|     are calculated by means of the overlap-add FFT method."""
+//|     ...
+//|
+
+mp_obj_t filter_convolve(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_a, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_v, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_mode, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_full) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return filter_convolve_correlate(args[0].u_obj, args[1].u_obj, args[2].u_obj, false);
 }
 
 MP_DEFINE_CONST_FUN_OBJ_KW(filter_convolve_obj, 2, filter_convolve);
+#endif
+
+#if ULAB_NUMPY_HAS_CORRELATE
+//| def correlate(a: ulab.ndarray, v: ulab.ndarray, mode: str = 'valid') -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray a:
+//|     :param ulab.ndarray v:
+//|     :param str mode: One of 'full', 'same', or 'valid'
+//|
+//|     Return the cross-correlation of two one-dimensional arrays, i.e., the convolution of a
+//|     with the reversed v."""
+//|     ...
+//|
+
+mp_obj_t filter_correlate(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_a, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_v, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_mode, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_valid) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return filter_convolve_correlate(args[0].u_obj, args[1].u_obj, args[2].u_obj, true);
+}
 
+MP_DEFINE_CONST_FUN_OBJ_KW(filter_correlate_obj, 2, filter_correlate);
 #endif
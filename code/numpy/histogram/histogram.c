@@ -0,0 +1,348 @@
+
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "py/obj.h"
+#include "py/runtime.h"
+#include "py/misc.h"
+
+#include "../../ulab.h"
+#include "../../ulab_tools.h"
+#include "histogram.h"
+
+//| """Histograms, and counting of integers"""
+//|
+
+#if ULAB_NUMPY_HAS_HISTOGRAM | ULAB_NUMPY_HAS_BINCOUNT
+static inline void histogram_add(uint8_t *carray, int32_t cstride, size_t idx, uint8_t *warray, mp_float_t (*wfunc)(void *)) {
+    // without weights, the counts are held in a uint32 array, otherwise, in a float array
+    if(wfunc == NULL) {
+        *((uint32_t *)(carray + idx * cstride)) += 1;
+    } else {
+        *((mp_float_t *)(carray + idx * cstride)) += wfunc(warray);
+    }
+}
+
+static ndarray_obj_t *histogram_dense_input(mp_obj_t oin) {
+    // returns a contiguous ndarray, so that the input can be traversed linearly
+    ndarray_obj_t *ndarray = ndarray_from_mp_obj(oin);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    if(!ndarray_is_contiguous(ndarray)) {
+        ndarray = ndarray_copy_view(ndarray);
+    }
+    return ndarray;
+}
+
+static ndarray_obj_t *histogram_counts(mp_obj_t out, size_t nbins, bool weighted) {
+    // without out, a new array of zeros is returned; if out is supplied, it is returned
+    // as is, and the new counts are added to its content, so that a histogram can be
+    // accumulated over a stream of samples
+    uint8_t dtype = weighted ? NDARRAY_FLOAT : NDARRAY_UINT32;
+    if(out == mp_const_none) {
+        return ndarray_new_linear_array(nbins, dtype);
+    }
+    if(!mp_obj_is_type(out, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("out must be an ndarray"));
+    }
+    ndarray_obj_t *counts = MP_OBJ_TO_PTR(out);
+    if((counts->dtype != dtype) || (counts->ndim != 1)) {
+        mp_raise_ValueError(translate("wrong output type"));
+    }
+    if(counts->len < nbins) {
+        mp_raise_ValueError(translate("out array is too small"));
+    }
+    return counts;
+}
+
+static mp_float_t (*histogram_weights(mp_obj_t oin, size_t len, uint8_t **warray, int32_t *wstride))(void *) {
+    // returns the function that reads the weights, or NULL, if there are no weights
+    *warray = NULL;
+    *wstride = 0;
+    if(oin == mp_const_none) {
+        return NULL;
+    }
+    ndarray_obj_t *weights = histogram_dense_input(oin);
+    if(weights->len != len) {
+        mp_raise_ValueError(translate("weights should have the same shape as a"));
+    }
+    *warray = (uint8_t *)weights->array;
+    *wstride = weights->itemsize;
+    return ndarray_get_float_function(weights->dtype);
+}
+#endif
+
+#if ULAB_NUMPY_HAS_BINCOUNT
+//| def bincount(x: ulab.ndarray, weights: Optional[ulab.ndarray] = None, minlength: int = 0, *, out: Optional[ulab.ndarray] = None) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray x: one-dimensional array of non-negative integers
+//|     :param ulab.ndarray weights: optional weights of the same length as x
+//|     :param int minlength: the minimum number of bins in the output
+//|     :param ulab.ndarray out: if supplied, the counts are added to the content of this array
+//|
+//|     Count the number of occurrences of each value in x. The counts are returned as
+//|     a uint32 array, or as a float array, if weights are supplied."""
+//|     ...
+//|
+
+static mp_obj_t histogram_bincount(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+        { MP_QSTR_weights, MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+        { MP_QSTR_minlength, MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *ndarray = ndarray_from_mp_obj(args[0].u_obj);
+    if(ndarray->ndim != 1) {
+        mp_raise_ValueError(translate("input must be a 1D ndarray"));
+    }
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    if(ndarray->dtype == NDARRAY_FLOAT) {
+        mp_raise_TypeError(translate("input must be an integer array"));
+    }
+    if(args[2].u_int < 0) {
+        mp_raise_ValueError(translate("minlength must not be negative"));
+    }
+
+    uint8_t *warray;
+    int32_t wstride;
+    mp_float_t (*wfunc)(void *) = histogram_weights(args[1].u_obj, ndarray->len, &warray, &wstride);
+
+    int32_t stride = ndarray->strides[ULAB_MAX_DIMS - 1];
+    size_t len = ndarray->len;
+    uint8_t *array = (uint8_t *)ndarray->array;
+
+    // the first pass finds the largest value, and makes certain that all values are non-negative
+    size_t max = 0;
+    if(len != 0) {
+        if(ndarray->dtype == NDARRAY_UINT8) {
+            BINCOUNT_MAX_LOOP(uint8_t, array, stride, len, max);
+        } else if(ndarray->dtype == NDARRAY_INT8) {
+            BINCOUNT_SIGNED_MAX_LOOP(int8_t, array, stride, len, max);
+        } else if(ndarray->dtype == NDARRAY_UINT16) {
+            BINCOUNT_MAX_LOOP(uint16_t, array, stride, len, max);
+        } else if(ndarray->dtype == NDARRAY_INT16) {
+            BINCOUNT_SIGNED_MAX_LOOP(int16_t, array, stride, len, max);
+        } else if(ndarray->dtype == NDARRAY_UINT32) {
+            BINCOUNT_MAX_LOOP(uint32_t, array, stride, len, max);
+        } else if(ndarray->dtype == NDARRAY_INT32) {
+            BINCOUNT_SIGNED_MAX_LOOP(int32_t, array, stride, len, max);
+        } else if(ndarray->dtype == NDARRAY_INT64) {
+            BINCOUNT_SIGNED_MAX_LOOP(int64_t, array, stride, len, max);
+        }
+        max++;
+    }
+    size_t nbins = MAX(max, (size_t)args[2].u_int);
+
+    ndarray_obj_t *counts = histogram_counts(args[3].u_obj, nbins, wfunc != NULL);
+    uint8_t *carray = (uint8_t *)counts->array;
+    int32_t cstride = counts->strides[ULAB_MAX_DIMS - 1];
+
+    // the second pass addresses the bins directly with the values
+    array = (uint8_t *)ndarray->array;
+    if(ndarray->dtype == NDARRAY_UINT8) {
+        BINCOUNT_LOOP(uint8_t, array, stride, len, carray, cstride, warray, wstride, wfunc);
+    } else if(ndarray->dtype == NDARRAY_INT8) {
+        BINCOUNT_LOOP(int8_t, array, stride, len, carray, cstride, warray, wstride, wfunc);
+    } else if(ndarray->dtype == NDARRAY_UINT16) {
+        BINCOUNT_LOOP(uint16_t, array, stride, len, carray, cstride, warray, wstride, wfunc);
+    } else if(ndarray->dtype == NDARRAY_INT16) {
+        BINCOUNT_LOOP(int16_t, array, stride, len, carray, cstride, warray, wstride, wfunc);
+    } else if(ndarray->dtype == NDARRAY_UINT32) {
+        BINCOUNT_LOOP(uint32_t, array, stride, len, carray, cstride, warray, wstride, wfunc);
+    } else if(ndarray->dtype == NDARRAY_INT32) {
+        BINCOUNT_LOOP(int32_t, array, stride, len, carray, cstride, warray, wstride, wfunc);
+    } else if(ndarray->dtype == NDARRAY_INT64) {
+        BINCOUNT_LOOP(int64_t, array, stride, len, carray, cstride, warray, wstride, wfunc);
+    }
+    return MP_OBJ_FROM_PTR(counts);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(histogram_bincount_obj, 1, histogram_bincount);
+#endif
+
+#if ULAB_NUMPY_HAS_HISTOGRAM
+//| def histogram(a: ulab.ndarray, bins: Union[int, ulab.ndarray] = 10, range: Optional[Tuple[float, float]] = None, weights: Optional[ulab.ndarray] = None, *, out: Optional[ulab.ndarray] = None) -> Tuple[ulab.ndarray, ulab.ndarray]:
+//|     """
+//|     :param ulab.ndarray a: input data; the histogram is computed over the flattened array
+//|     :param bins: the number of equal-width bins, or a monotonically increasing array of bin edges
+//|     :param tuple range: the lower and upper range of the bins, if bins is an integer. Values outside the range are ignored
+//|     :param ulab.ndarray weights: optional weights of the same shape as a
+//|     :param ulab.ndarray out: if supplied, the counts are added to the content of this array
+//|
+//|     Compute the histogram of a dataset, and return a tuple of the counts, and the bin edges.
+//|     The counts are returned as a uint32 array, or as a float array, if weights are supplied.
+//|     In order to accumulate a histogram over a stream of samples, pass the same out array,
+//|     and a fixed range, or fixed bin edges to each call."""
+//|     ...
+//|
+
+static mp_obj_t histogram_histogram(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+        { MP_QSTR_bins, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_INT(10) } },
+        { MP_QSTR_range, MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+        { MP_QSTR_weights, MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *ndarray = histogram_dense_input(args[0].u_obj);
+    size_t len = ndarray->len;
+    uint8_t *array = (uint8_t *)ndarray->array;
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+
+    uint8_t *warray;
+    int32_t wstride;
+    mp_float_t (*wfunc)(void *) = histogram_weights(args[3].u_obj, len, &warray, &wstride);
+
+    ndarray_obj_t *edges;
+    ndarray_obj_t *counts;
+    size_t nbins;
+
+    if(mp_obj_is_int(args[1].u_obj)) {
+        mp_int_t _nbins = mp_obj_get_int(args[1].u_obj);
+        if(_nbins < 1) {
+            mp_raise_ValueError(translate("bins must be a positive integer"));
+        }
+        nbins = (size_t)_nbins;
+        mp_float_t lo, hi;
+        if(args[2].u_obj != mp_const_none) {
+            mp_obj_t *items;
+            mp_obj_get_array_fixed_n(args[2].u_obj, 2, &items);
+            lo = mp_obj_get_float(items[0]);
+            hi = mp_obj_get_float(items[1]);
+            if(lo > hi) {
+                mp_raise_ValueError(translate("max must be larger than min in range parameter"));
+            }
+        } else {
+            lo = hi = MICROPY_FLOAT_CONST(0.0);
+            if(len != 0) {
+                lo = hi = func(array);
+                for(size_t i=1; i < len; i++) {
+                    mp_float_t value = func(array + i * ndarray->itemsize);
+                    lo = value < lo ? value : lo;
+                    hi = value > hi ? value : hi;
+                }
+            }
+        }
+        if(lo == hi) {
+            lo -= MICROPY_FLOAT_CONST(0.5);
+            hi += MICROPY_FLOAT_CONST(0.5);
+        }
+
+        edges = ndarray_new_linear_array(nbins + 1, NDARRAY_FLOAT);
+        mp_float_t *earray = (mp_float_t *)edges->array;
+        mp_float_t width = (hi - lo) / (mp_float_t)nbins;
+        for(size_t i=0; i < nbins; i++) {
+            earray[i] = lo + (mp_float_t)i * width;
+        }
+        earray[nbins] = hi;
+
+        counts = histogram_counts(args[4].u_obj, nbins, wfunc != NULL);
+        uint8_t *carray = (uint8_t *)counts->array;
+        int32_t cstride = counts->strides[ULAB_MAX_DIMS - 1];
+        mp_float_t scale = (mp_float_t)nbins / (hi - lo);
+
+        if(((ndarray->dtype == NDARRAY_UINT8) || (ndarray->dtype == NDARRAY_INT8)) && (nbins < 0xFFFF)) {
+            // with 8-bit values, the bins of all possible values can be tabulated in advance,
+            // and then the counting requires a single look-up per sample
+            uint16_t *lut = m_new(uint16_t, 256);
+            for(uint16_t v=0; v < 256; v++) {
+                mp_float_t value = ndarray->dtype == NDARRAY_UINT8 ? (mp_float_t)v : (mp_float_t)((int8_t)v);
+                if((value >= lo) && (value <= hi)) {
+                    size_t idx = (size_t)((value - lo) * scale);
+                    lut[v] = idx >= nbins ? nbins - 1 : idx;
+                } else {
+                    lut[v] = 0xFFFF;
+                }
+            }
+            for(size_t i=0; i < len; i++) {
+                uint16_t idx = lut[array[i]];
+                if(idx != 0xFFFF) {
+                    histogram_add(carray, cstride, idx, warray, wfunc);
+                }
+                warray += wstride;
+            }
+            m_del(uint16_t, lut, 256);
+        } else if(ndarray->dtype == NDARRAY_UINT8) {
+            HISTOGRAM_UNIFORM_LOOP(uint8_t, array, len, lo, hi, scale, nbins, carray, cstride, warray, wstride, wfunc);
+        } else if(ndarray->dtype == NDARRAY_INT8) {
+            HISTOGRAM_UNIFORM_LOOP(int8_t, array, len, lo, hi, scale, nbins, carray, cstride, warray, wstride, wfunc);
+        } else if(ndarray->dtype == NDARRAY_UINT16) {
+            HISTOGRAM_UNIFORM_LOOP(uint16_t, array, len, lo, hi, scale, nbins, carray, cstride, warray, wstride, wfunc);
+        } else if(ndarray->dtype == NDARRAY_INT16) {
+            HISTOGRAM_UNIFORM_LOOP(int16_t, array, len, lo, hi, scale, nbins, carray, cstride, warray, wstride, wfunc);
+        } else if(ndarray->dtype == NDARRAY_UINT32) {
+            HISTOGRAM_UNIFORM_LOOP(uint32_t, array, len, lo, hi, scale, nbins, carray, cstride, warray, wstride, wfunc);
+        } else if(ndarray->dtype == NDARRAY_INT32) {
+            HISTOGRAM_UNIFORM_LOOP(int32_t, array, len, lo, hi, scale, nbins, carray, cstride, warray, wstride, wfunc);
+        } else if(ndarray->dtype == NDARRAY_INT64) {
+            HISTOGRAM_UNIFORM_LOOP(int64_t, array, len, lo, hi, scale, nbins, carray, cstride, warray, wstride, wfunc);
+        } else {
+            HISTOGRAM_UNIFORM_LOOP(mp_float_t, array, len, lo, hi, scale, nbins, carray, cstride, warray, wstride, wfunc);
+        }
+    } else {
+        // explicit bin edges; the bin is found by means of a binary search, as in interp
+        ndarray_obj_t *_edges = ndarray_from_mp_obj(args[1].u_obj);
+        if((_edges->ndim != 1) || (_edges->len < 2)) {
+            mp_raise_ValueError(translate("bins must be a 1D array of at least two edges"));
+        }
+        nbins = _edges->len - 1;
+        edges = ndarray_new_linear_array(nbins + 1, NDARRAY_FLOAT);
+        mp_float_t *earray = (mp_float_t *)edges->array;
+        uint8_t *_earray = (uint8_t *)_edges->array;
+        for(size_t i=0; i < nbins + 1; i++) {
+            earray[i] = ndarray_get_float_value(_earray, _edges->dtype);
+            _earray += _edges->strides[ULAB_MAX_DIMS - 1];
+            if((i > 0) && (earray[i] < earray[i-1])) {
+                mp_raise_ValueError(translate("bins must increase monotonically"));
+            }
+        }
+
+        counts = histogram_counts(args[4].u_obj, nbins, wfunc != NULL);
+        uint8_t *carray = (uint8_t *)counts->array;
+        int32_t cstride = counts->strides[ULAB_MAX_DIMS - 1];
+
+        for(size_t i=0; i < len; i++) {
+            mp_float_t value = func(array);
+            array += ndarray->itemsize;
+            if((value >= earray[0]) && (value <= earray[nbins])) {
+                size_t left_index = 0, right_index = nbins, middle_index;
+                while(right_index - left_index > 1) {
+                    middle_index = left_index + (right_index - left_index) / 2;
+                    if(value < earray[middle_index]) {
+                        right_index = middle_index;
+                    } else {
+                        left_index = middle_index;
+                    }
+                }
+                histogram_add(carray, cstride, left_index, warray, wfunc);
+            }
+            warray += wstride;
+        }
+    }
+
+    mp_obj_t tuple[2];
+    tuple[0] = MP_OBJ_FROM_PTR(counts);
+    tuple[1] = MP_OBJ_FROM_PTR(edges);
+    return mp_obj_new_tuple(2, tuple);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(histogram_histogram_obj, 1, histogram_histogram);
+#endif
@@ -0,0 +1,74 @@
+
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+*/
+
+#ifndef _HISTOGRAM_
+#define _HISTOGRAM_
+
+#include "../../ulab.h"
+#include "../../ndarray.h"
+
+// With a uniform grid, the bin is a linear function of the value; the
+// right edge of the last bin is closed, as in numpy
+#define HISTOGRAM_UNIFORM_LOOP(type, array, len, lo, hi, scale, nbins, carray, cstride, warray, wstride, wfunc)\
+{\
+    type *_array = (type *)(array);\
+    for(size_t i=0; i < (len); i++) {\
+        mp_float_t value = (mp_float_t)_array[i];\
+        if((value >= (lo)) && (value <= (hi))) {\
+            size_t idx = (size_t)((value - (lo)) * (scale));\
+            if(idx >= (nbins)) {\
+                idx = (nbins) - 1;\
+            }\
+            histogram_add((carray), (cstride), idx, (warray), (wfunc));\
+        }\
+        (warray) += (wstride);\
+    }\
+}
+
+#define BINCOUNT_MAX_LOOP(type, array, stride, len, max)\
+{\
+    for(size_t i=0; i < (len); i++) {\
+        type value = *((type *)(array));\
+        if((size_t)value > (max)) {\
+            (max) = (size_t)value;\
+        }\
+        (array) += (stride);\
+    }\
+}
+
+// signed types must, in addition, be checked for negative values
+#define BINCOUNT_SIGNED_MAX_LOOP(type, array, stride, len, max)\
+{\
+    for(size_t i=0; i < (len); i++) {\
+        type value = *((type *)(array));\
+        if(value < 0) {\
+            mp_raise_ValueError(translate("input must not contain negative values"));\
+        }\
+        if((size_t)value > (max)) {\
+            (max) = (size_t)value;\
+        }\
+        (array) += (stride);\
+    }\
+}
+
+#define BINCOUNT_LOOP(type, array, stride, len, carray, cstride, warray, wstride, wfunc)\
+{\
+    for(size_t i=0; i < (len); i++) {\
+        histogram_add((carray), (cstride), (size_t)(*((type *)(array))), (warray), (wfunc));\
+        (array) += (stride);\
+        (warray) += (wstride);\
+    }\
+}
+
+MP_DECLARE_CONST_FUN_OBJ_KW(histogram_bincount_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(histogram_histogram_obj);
+
+#endif
@@ -29,6 +29,10 @@ enum NUMERICAL_FUNCTION_TYPE {
     NUMERICAL_ANY,
     NUMERICAL_ARGMAX,
     NUMERICAL_ARGMIN,
+    NUMERICAL_CUMMAX,
+    NUMERICAL_CUMMIN,
+    NUMERICAL_CUMPROD,
+    NUMERICAL_CUMSUM,
     NUMERICAL_MAX,
     NUMERICAL_MEAN,
     NUMERICAL_MIN,
@@ -200,6 +204,7 @@ static mp_obj_t numerical_sum_mean_std_iterable(mp_obj_t oin, uint8_t optype, si
 }
 
 static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t axis, uint8_t optype, size_t ddof) {
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
     uint8_t *array = (uint8_t *)ndarray->array;
     shape_strides _shape_strides = tools_reduce_axes(ndarray, axis);
 
@@ -367,6 +372,7 @@ static mp_obj_t numerical_argmin_argmax_iterable(mp_obj_t oin, uint8_t optype) {
 
 static mp_obj_t numerical_argmin_argmax_ndarray(ndarray_obj_t *ndarray, mp_obj_t axis, uint8_t optype) {
     // TODO: treat the flattened array
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
     if(ndarray->len == 0) {
         mp_raise_ValueError(translate("attempt to get (arg)min/(arg)max of empty sequence"));
     }
@@ -539,6 +545,7 @@ static mp_obj_t numerical_sort_helper(mp_obj_t oin, mp_obj_t axis, uint8_t inpla
     if(!mp_obj_is_type(oin, &ulab_ndarray_type)) {
         mp_raise_TypeError(translate("sort argument must be an ndarray"));
     }
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(((ndarray_obj_t *)MP_OBJ_TO_PTR(oin))->dtype)
 
     ndarray_obj_t *ndarray;
     if(inplace == 1) {
@@ -646,6 +653,7 @@ mp_obj_t numerical_argsort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
     }
 
     ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
     if(args[1].u_obj == mp_const_none) {
         // bail out, though dense arrays could still be sorted
         mp_raise_NotImplementedError(translate("argsort is not implemented for flattened arrays"));
@@ -815,6 +823,167 @@ MP_DEFINE_CONST_FUN_OBJ_2(numerical_cross_obj, numerical_cross);
 
 #endif /* ULAB_NUMERICAL_HAS_CROSS */
 
+#if ULAB_NUMPY_HAS_CUMSUM | ULAB_NUMPY_HAS_CUMPROD | ULAB_NUMPY_HAS_CUMMINMAX
+// sums and products of 8- and 16-bit integers are accumulated in int32
+#define NUMERICAL_WIDE_TYPE(type) int32_t
+#define NUMERICAL_SAME_TYPE(type) type
+
+#define NUMERICAL_CUMULATIVE_LOOP(dtype, array, rarray, shape, strides, rstrides, astride, rstride, N, op, small) do {\
+    if((dtype) == NDARRAY_UINT8) {\
+        RUN_CUMULATIVE(uint8_t, small(uint8_t), (array), (rarray), (shape), (strides), (rstrides), (astride), (rstride), (N), op);\
+    } else if((dtype) == NDARRAY_INT8) {\
+        RUN_CUMULATIVE(int8_t, small(int8_t), (array), (rarray), (shape), (strides), (rstrides), (astride), (rstride), (N), op);\
+    } else if((dtype) == NDARRAY_UINT16) {\
+        RUN_CUMULATIVE(uint16_t, small(uint16_t), (array), (rarray), (shape), (strides), (rstrides), (astride), (rstride), (N), op);\
+    } else if((dtype) == NDARRAY_INT16) {\
+        RUN_CUMULATIVE(int16_t, small(int16_t), (array), (rarray), (shape), (strides), (rstrides), (astride), (rstride), (N), op);\
+    } else if((dtype) == NDARRAY_UINT32) {\
+        RUN_CUMULATIVE(uint32_t, uint32_t, (array), (rarray), (shape), (strides), (rstrides), (astride), (rstride), (N), op);\
+    } else if((dtype) == NDARRAY_INT32) {\
+        RUN_CUMULATIVE(int32_t, int32_t, (array), (rarray), (shape), (strides), (rstrides), (astride), (rstride), (N), op);\
+    } else if((dtype) == NDARRAY_INT64) {\
+        RUN_CUMULATIVE(int64_t, int64_t, (array), (rarray), (shape), (strides), (rstrides), (astride), (rstride), (N), op);\
+    } else {\
+        RUN_CUMULATIVE(mp_float_t, mp_float_t, (array), (rarray), (shape), (strides), (rstrides), (astride), (rstride), (N), op);\
+    }\
+} while(0)
+
+static mp_obj_t numerical_cumulative(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, uint8_t optype) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+        { MP_QSTR_axis, MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *ndarray = ndarray_from_mp_obj(args[0].u_obj);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    mp_obj_t axis = args[1].u_obj;
+    if((axis != mp_const_none) && (!mp_obj_is_int(axis))) {
+        mp_raise_TypeError(translate("axis must be None, or an integer"));
+    }
+
+    // running maxima and minima preserve the dtype, while sums and products
+    // of 8-, and 16-bit integers are promoted to int32
+    uint8_t dtype = ndarray->dtype;
+    if(((optype == NUMERICAL_CUMSUM) || (optype == NUMERICAL_CUMPROD)) && (ndarray->itemsize < 4)) {
+        dtype = NDARRAY_INT32;
+    }
+
+    size_t shape[ULAB_MAX_DIMS] = { 0 };
+    int32_t strides[ULAB_MAX_DIMS] = { 0 };
+    int32_t rstrides[ULAB_MAX_DIMS] = { 0 };
+    ndarray_obj_t *results = NULL;
+    int32_t astride, rstride;
+    size_t N;
+
+    if(axis == mp_const_none) {
+        // work with the flattened array; this can be treated as a single lane
+        // with a constant stride, if the input is contiguous
+        if(!ndarray_is_contiguous(ndarray)) {
+            ndarray = ndarray_copy_view(ndarray);
+        }
+        shape[ULAB_MAX_DIMS - 1] = ndarray->len;
+        results = tools_output_array(args[2].u_obj, 1, shape, dtype);
+        shape[ULAB_MAX_DIMS - 1] = 1;
+        N = ndarray->len;
+        astride = ndarray->itemsize;
+        rstride = results->strides[ULAB_MAX_DIMS - 1];
+    } else {
+        int8_t ax = mp_obj_get_int(axis);
+        if(ax < 0) ax += ndarray->ndim;
+        if((ax < 0) || (ax > ndarray->ndim - 1)) {
+            mp_raise_ValueError(translate("index out of range"));
+        }
+        results = tools_output_array(args[2].u_obj, ndarray->ndim, ndarray->shape, dtype);
+        numerical_reduce_axes(ndarray, ax, shape, strides);
+        numerical_reduce_axes(results, ax, shape, rstrides);
+        uint8_t index = ULAB_MAX_DIMS - ndarray->ndim + ax;
+        N = ndarray->shape[index];
+        astride = ndarray->strides[index];
+        rstride = results->strides[index];
+    }
+
+    if((ndarray->len == 0) || (N == 0)) {
+        return MP_OBJ_FROM_PTR(results);
+    }
+
+    uint8_t *array = (uint8_t *)ndarray->array;
+    uint8_t *rarray = (uint8_t *)results->array;
+
+    if(optype == NUMERICAL_CUMSUM) {
+        NUMERICAL_CUMULATIVE_LOOP(ndarray->dtype, array, rarray, shape, strides, rstrides, astride, rstride, N, NUMERICAL_CUMSUM_OP, NUMERICAL_WIDE_TYPE);
+    } else if(optype == NUMERICAL_CUMPROD) {
+        NUMERICAL_CUMULATIVE_LOOP(ndarray->dtype, array, rarray, shape, strides, rstrides, astride, rstride, N, NUMERICAL_CUMPROD_OP, NUMERICAL_WIDE_TYPE);
+    } else if(optype == NUMERICAL_CUMMAX) {
+        NUMERICAL_CUMULATIVE_LOOP(ndarray->dtype, array, rarray, shape, strides, rstrides, astride, rstride, N, NUMERICAL_CUMMAX_OP, NUMERICAL_SAME_TYPE);
+    } else { // NUMERICAL_CUMMIN
+        NUMERICAL_CUMULATIVE_LOOP(ndarray->dtype, array, rarray, shape, strides, rstrides, astride, rstride, N, NUMERICAL_CUMMIN_OP, NUMERICAL_SAME_TYPE);
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+#endif
+
+#if ULAB_NUMPY_HAS_CUMMINMAX
+//| def cummax(array: _ArrayLike, *, axis: Optional[int] = None, out: Optional[ulab.ndarray] = None) -> ulab.ndarray:
+//|     """Return the running maximum of the elements along the given axis, or of the
+//|        flattened array, if axis is None. This is the equivalent of numpy's
+//|        ``maximum.accumulate``. The dtype of the input is preserved."""
+//|     ...
+//|
+
+mp_obj_t numerical_cummax(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return numerical_cumulative(n_args, pos_args, kw_args, NUMERICAL_CUMMAX);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_cummax_obj, 1, numerical_cummax);
+
+//| def cummin(array: _ArrayLike, *, axis: Optional[int] = None, out: Optional[ulab.ndarray] = None) -> ulab.ndarray:
+//|     """Return the running minimum of the elements along the given axis, or of the
+//|        flattened array, if axis is None. This is the equivalent of numpy's
+//|        ``minimum.accumulate``. The dtype of the input is preserved."""
+//|     ...
+//|
+
+mp_obj_t numerical_cummin(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return numerical_cumulative(n_args, pos_args, kw_args, NUMERICAL_CUMMIN);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_cummin_obj, 1, numerical_cummin);
+#endif
+
+#if ULAB_NUMPY_HAS_CUMPROD
+//| def cumprod(array: _ArrayLike, *, axis: Optional[int] = None, out: Optional[ulab.ndarray] = None) -> ulab.ndarray:
+//|     """Return the cumulative product of the elements along the given axis, or of
+//|        the flattened array, if axis is None. 8-, and 16-bit integers are accumulated,
+//|        and returned as int32."""
+//|     ...
+//|
+
+mp_obj_t numerical_cumprod(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return numerical_cumulative(n_args, pos_args, kw_args, NUMERICAL_CUMPROD);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_cumprod_obj, 1, numerical_cumprod);
+#endif
+
+#if ULAB_NUMPY_HAS_CUMSUM
+//| def cumsum(array: _ArrayLike, *, axis: Optional[int] = None, out: Optional[ulab.ndarray] = None) -> ulab.ndarray:
+//|     """Return the cumulative sum of the elements along the given axis, or of
+//|        the flattened array, if axis is None. 8-, and 16-bit integers are accumulated,
+//|        and returned as int32."""
+//|     ...
+//|
+
+mp_obj_t numerical_cumsum(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return numerical_cumulative(n_args, pos_args, kw_args, NUMERICAL_CUMSUM);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_cumsum_obj, 1, numerical_cumsum);
+#endif
+
 #if ULAB_NUMPY_HAS_DIFF
 //| def diff(array: ulab.ndarray, *, n: int = 1, axis: int = -1) -> ulab.ndarray:
 //|     """Return the numerical derivative of successive elements of the array, as
@@ -837,6 +1006,7 @@ mp_obj_t numerical_diff(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
     }
 
     ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
     int8_t ax = args[2].u_int;
     if(ax < 0) ax += ndarray->ndim;
 
@@ -844,7 +1014,7 @@ mp_obj_t numerical_diff(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
         mp_raise_ValueError(translate("index out of range"));
     }
 
-    if((args[1].u_int < 0) || (args[1].u_int > 9)) {
+    if((args[1].u_int < 0) || (args[1].u_int > NUMERICAL_DIFF_MAX_ORDER)) {
         mp_raise_ValueError(translate("differentiation order out of range"));
     }
     uint8_t N = (uint8_t)args[1].u_int;
@@ -853,13 +1023,16 @@ mp_obj_t numerical_diff(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
         mp_raise_ValueError(translate("differentiation order out of range"));
     }
 
-    int8_t *stencil = m_new(int8_t, N+1);
-    stencil[0] = 1;
-    for(uint8_t i=1; i < N+1; i++) {
-        stencil[i] = -stencil[i-1]*(N-i+1)/i;
+    // the coefficients of the order-N difference are the binomial coefficients with alternating signs,
+    // the last coefficient being +1; with N <= 9, they all fit into an int8_t
+    int8_t stencil[NUMERICAL_DIFF_MAX_ORDER + 1];
+    int16_t binomial = 1;
+    for(uint8_t d=0; d < N+1; d++) {
+        stencil[d] = (N - d) & 1 ? -binomial : binomial;
+        binomial = binomial * (N - d) / (d + 1);
     }
 
-	size_t shape[ULAB_MAX_DIMS] = { 0 };
+    size_t shape[ULAB_MAX_DIMS] = { 0 };
 
     for(uint8_t i=0; i < ULAB_MAX_DIMS; i++) {
         shape[i] = ndarray->shape[i];
@@ -867,29 +1040,41 @@ mp_obj_t numerical_diff(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
             shape[i] -= N;
         }
     }
-    uint8_t *array = (uint8_t *)ndarray->array;
     ndarray_obj_t *results = ndarray_new_dense_ndarray(ndarray->ndim, shape, ndarray->dtype);
+    if(results->len == 0) {
+        return MP_OBJ_FROM_PTR(results);
+    }
+    uint8_t *array = (uint8_t *)ndarray->array;
     uint8_t *rarray = (uint8_t *)results->array;
 
     memset(shape, 0, sizeof(size_t)*ULAB_MAX_DIMS);
-	int32_t strides[ULAB_MAX_DIMS] = { 0 };
-
+    int32_t strides[ULAB_MAX_DIMS] = { 0 };
+    size_t rshape[ULAB_MAX_DIMS] = { 0 };
+    int32_t rstrides[ULAB_MAX_DIMS] = { 0 };
     numerical_reduce_axes(ndarray, ax, shape, strides);
+    numerical_reduce_axes(results, ax, rshape, rstrides);
+
+    size_t len = ndarray->shape[index];
+    int32_t astride = ndarray->strides[index];
+    int32_t rstride = results->strides[index];
 
     if(ndarray->dtype == NDARRAY_UINT8) {
-        RUN_DIFF(ndarray, uint8_t, array, results, rarray, shape, strides, index, stencil, N);
+        RUN_DIFF(uint8_t, array, rarray, shape, strides, rstrides, astride, rstride, len, stencil, N);
     } else if(ndarray->dtype == NDARRAY_INT8) {
-        RUN_DIFF(ndarray, int8_t, array, results, rarray, shape, strides, index, stencil, N);
-    }  else if(ndarray->dtype == NDARRAY_UINT16) {
-        RUN_DIFF(ndarray, uint16_t, array, results, rarray, shape, strides, index, stencil, N);
+        RUN_DIFF(int8_t, array, rarray, shape, strides, rstrides, astride, rstride, len, stencil, N);
+    } else if(ndarray->dtype == NDARRAY_UINT16) {
+        RUN_DIFF(uint16_t, array, rarray, shape, strides, rstrides, astride, rstride, len, stencil, N);
     } else if(ndarray->dtype == NDARRAY_INT16) {
-        RUN_DIFF(ndarray, int16_t, array, results, rarray, shape, strides, index, stencil, N);
+        RUN_DIFF(int16_t, array, rarray, shape, strides, rstrides, astride, rstride, len, stencil, N);
+    } else if(ndarray->dtype == NDARRAY_UINT32) {
+        RUN_DIFF(uint32_t, array, rarray, shape, strides, rstrides, astride, rstride, len, stencil, N);
+    } else if(ndarray->dtype == NDARRAY_INT32) {
+        RUN_DIFF(int32_t, array, rarray, shape, strides, rstrides, astride, rstride, len, stencil, N);
+    } else if(ndarray->dtype == NDARRAY_INT64) {
+        RUN_DIFF(int64_t, array, rarray, shape, strides, rstrides, astride, rstride, len, stencil, N);
     } else {
-        RUN_DIFF(ndarray, mp_float_t, array, results, rarray, shape, strides, index, stencil, N);
+        RUN_DIFF(mp_float_t, array, rarray, shape, strides, rstrides, astride, rstride, len, stencil, N);
     }
-    m_del(int8_t, stencil, N+1);
-    m_del(size_t, shape, ULAB_MAX_DIMS);
-    m_del(int32_t, strides, ULAB_MAX_DIMS);
     return MP_OBJ_FROM_PTR(results);
 }
 
@@ -898,8 +1083,8 @@ MP_DEFINE_CONST_FUN_OBJ_KW(numerical_diff_obj, 1, numerical_diff);
 
 #if ULAB_NUMPY_HAS_FLIP
 //| def flip(array: ulab.ndarray, *, axis: Optional[int] = None) -> ulab.ndarray:
-//|     """Returns a new array that reverses the order of the elements along the
-//|        given axis, or along all axes if axis is None."""
+//|     """Returns a view of the array that reverses the order of the elements along the
+//|        given axis, or along all axes if axis is None. The data are not copied."""
 //|     ...
 //|
 
@@ -918,13 +1103,17 @@ mp_obj_t numerical_flip(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
 
     ndarray_obj_t *results = NULL;
     ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
-    if(args[1].u_obj == mp_const_none) { // flip the flattened array
-        results = ndarray_new_linear_array(ndarray->len, ndarray->dtype);
-        ndarray_copy_array(ndarray, results);
-        uint8_t *rarray = (uint8_t *)results->array;
-        rarray += (results->len - 1) * results->itemsize;
-        results->array = rarray;
-        results->strides[ULAB_MAX_DIMS - 1] = -results->strides[ULAB_MAX_DIMS - 1];
+    if(args[1].u_obj == mp_const_none) { // flip all axes
+        // this is a view with negative strides, hence, no data have to be copied
+        int32_t offset = 0;
+        int32_t strides[ULAB_MAX_DIMS] = { 0 };
+        for(uint8_t i = ULAB_MAX_DIMS - ndarray->ndim; i < ULAB_MAX_DIMS; i++) {
+            if(ndarray->shape[i] != 0) {
+                offset += (ndarray->shape[i] - 1) * ndarray->strides[i];
+            }
+            strides[i] = -ndarray->strides[i];
+        }
+        results = ndarray_new_view(ndarray, ndarray->ndim, ndarray->shape, strides, offset);
     } else if(mp_obj_is_int(args[1].u_obj)){
         int8_t ax = mp_obj_get_int(args[1].u_obj);
         if(ax < 0) ax += ndarray->ndim;
@@ -1082,19 +1271,263 @@ mp_obj_t numerical_min(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_arg
 MP_DEFINE_CONST_FUN_OBJ_KW(numerical_min_obj, 1, numerical_min);
 #endif
 
+#if ULAB_NUMPY_HAS_PTP | ULAB_UTILS_HAS_MINMAX
+static void numerical_minmax_lane(uint8_t dtype, uint8_t *array, int32_t astride, size_t N, uint8_t *lo, uint8_t *hi, bool ptp, size_t *ilo, size_t *ihi) {
+    // finds the extrema of a single lane of length N, and with stride astride
+    if(ilo == NULL) {
+        if(dtype == NDARRAY_UINT8) {
+            RUN_MINMAX1(uint8_t, array, astride, N, lo, hi, ptp);
+        } else if(dtype == NDARRAY_INT8) {
+            RUN_MINMAX1(int8_t, array, astride, N, lo, hi, ptp);
+        } else if(dtype == NDARRAY_UINT16) {
+            RUN_MINMAX1(uint16_t, array, astride, N, lo, hi, ptp);
+        } else if(dtype == NDARRAY_INT16) {
+            RUN_MINMAX1(int16_t, array, astride, N, lo, hi, ptp);
+        } else if(dtype == NDARRAY_UINT32) {
+            RUN_MINMAX1(uint32_t, array, astride, N, lo, hi, ptp);
+        } else if(dtype == NDARRAY_INT32) {
+            RUN_MINMAX1(int32_t, array, astride, N, lo, hi, ptp);
+        } else if(dtype == NDARRAY_INT64) {
+            RUN_MINMAX1(int64_t, array, astride, N, lo, hi, ptp);
+        } else {
+            RUN_MINMAX1(mp_float_t, array, astride, N, lo, hi, ptp);
+        }
+    } else {
+        if(dtype == NDARRAY_UINT8) {
+            RUN_ARGMINMAX1(uint8_t, array, astride, N, lo, hi, ilo, ihi);
+        } else if(dtype == NDARRAY_INT8) {
+            RUN_ARGMINMAX1(int8_t, array, astride, N, lo, hi, ilo, ihi);
+        } else if(dtype == NDARRAY_UINT16) {
+            RUN_ARGMINMAX1(uint16_t, array, astride, N, lo, hi, ilo, ihi);
+        } else if(dtype == NDARRAY_INT16) {
+            RUN_ARGMINMAX1(int16_t, array, astride, N, lo, hi, ilo, ihi);
+        } else if(dtype == NDARRAY_UINT32) {
+            RUN_ARGMINMAX1(uint32_t, array, astride, N, lo, hi, ilo, ihi);
+        } else if(dtype == NDARRAY_INT32) {
+            RUN_ARGMINMAX1(int32_t, array, astride, N, lo, hi, ilo, ihi);
+        } else if(dtype == NDARRAY_INT64) {
+            RUN_ARGMINMAX1(int64_t, array, astride, N, lo, hi, ilo, ihi);
+        } else {
+            RUN_ARGMINMAX1(mp_float_t, array, astride, N, lo, hi, ilo, ihi);
+        }
+    }
+}
+
+mp_obj_t numerical_minmax_ndarray(ndarray_obj_t *ndarray, mp_obj_t axis, bool ptp, bool indices) {
+    // Returns the minimum and maximum (and their indices, if indices is true) of ndarray
+    // along axis, or the peak-to-peak value, if ptp is true. Both extrema are found in the same pass.
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    if(ndarray->len == 0) {
+        mp_raise_ValueError(translate("attempt to get (arg)min/(arg)max of empty sequence"));
+    }
+    if((axis != mp_const_none) && (!mp_obj_is_int(axis))) {
+        mp_raise_TypeError(translate("axis must be None, or an integer"));
+    }
+
+    size_t shape[ULAB_MAX_DIMS] = { 0 };
+    int32_t strides[ULAB_MAX_DIMS] = { 0 };
+    ndarray_obj_t *lo = NULL, *hi = NULL, *ilo = NULL, *ihi = NULL;
+    // scalar results are stored on the stack; 8 bytes can hold any of the dtypes
+    int64_t lbuffer = 0, hbuffer = 0;
+    uint8_t *larray = (uint8_t *)&lbuffer;
+    uint8_t *harray = (uint8_t *)&hbuffer;
+    size_t N, imin = 0, imax = 0;
+    int32_t astride;
+
+    if(axis == mp_const_none) {
+        // a contiguous array can be treated as a single lane
+        if(!ndarray_is_contiguous(ndarray)) {
+            ndarray = ndarray_copy_view(ndarray);
+        }
+        shape[ULAB_MAX_DIMS - 1] = 1;
+        N = ndarray->len;
+        astride = ndarray->itemsize;
+    } else {
+        int8_t ax = mp_obj_get_int(axis);
+        if(ax < 0) ax += ndarray->ndim;
+        if((ax < 0) || (ax > ndarray->ndim - 1)) {
+            mp_raise_ValueError(translate("axis is out of bounds"));
+        }
+        numerical_reduce_axes(ndarray, ax, shape, strides);
+        uint8_t index = ULAB_MAX_DIMS - ndarray->ndim + ax;
+        N = ndarray->shape[index];
+        astride = ndarray->strides[index];
+        if(ndarray->ndim > 1) {
+            lo = ndarray_new_dense_ndarray(ndarray->ndim - 1, shape, ndarray->dtype);
+            larray = (uint8_t *)lo->array;
+            if(!ptp) {
+                hi = ndarray_new_dense_ndarray(ndarray->ndim - 1, shape, ndarray->dtype);
+                harray = (uint8_t *)hi->array;
+            }
+            if(indices) {
+                uint8_t itype = N > 65535 ? NDARRAY_UINT32 : NDARRAY_UINT16;
+                ilo = ndarray_new_dense_ndarray(ndarray->ndim - 1, shape, itype);
+                ihi = ndarray_new_dense_ndarray(ndarray->ndim - 1, shape, itype);
+            }
+        }
+    }
+
+    uint8_t *array = (uint8_t *)ndarray->array;
+    size_t r = 0;
+
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t k = 0;
+            do {
+            #endif
+                numerical_minmax_lane(ndarray->dtype, array, astride, N, larray, harray, ptp, indices ? &imin : NULL, &imax);
+                if(ilo != NULL) {
+                    if(ilo->dtype == NDARRAY_UINT16) {
+                        ((uint16_t *)ilo->array)[r] = (uint16_t)imin;
+                        ((uint16_t *)ihi->array)[r] = (uint16_t)imax;
+                    } else {
+                        ((uint32_t *)ilo->array)[r] = (uint32_t)imin;
+                        ((uint32_t *)ihi->array)[r] = (uint32_t)imax;
+                    }
+                }
+                r++;
+                if(lo != NULL) {
+                    larray += ndarray->itemsize;
+                }
+                if(hi != NULL) {
+                    harray += ndarray->itemsize;
+                }
+            #if ULAB_MAX_DIMS > 1
+                array += strides[ULAB_MAX_DIMS - 1];
+                k++;
+            } while(k < shape[ULAB_MAX_DIMS - 1]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            array -= strides[ULAB_MAX_DIMS - 1] * shape[ULAB_MAX_DIMS - 1];
+            array += strides[ULAB_MAX_DIMS - 2];
+            j++;
+        } while(j < shape[ULAB_MAX_DIMS - 2]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        array -= strides[ULAB_MAX_DIMS - 2] * shape[ULAB_MAX_DIMS - 2];
+        array += strides[ULAB_MAX_DIMS - 3];
+        i++;
+    } while(i < shape[ULAB_MAX_DIMS - 3]);
+    #endif
+
+    mp_obj_t items[4];
+    if(lo == NULL) {
+        items[0] = mp_binary_get_val_array(ndarray->dtype, &lbuffer, 0);
+        items[1] = mp_binary_get_val_array(ndarray->dtype, &hbuffer, 0);
+        items[2] = mp_obj_new_int_from_uint(imin);
+        items[3] = mp_obj_new_int_from_uint(imax);
+    } else {
+        items[0] = MP_OBJ_FROM_PTR(lo);
+        items[1] = MP_OBJ_FROM_PTR(hi);
+        items[2] = MP_OBJ_FROM_PTR(ilo);
+        items[3] = MP_OBJ_FROM_PTR(ihi);
+    }
+    if(ptp) {
+        return items[0];
+    }
+    return mp_obj_new_tuple(indices ? 4 : 2, items);
+}
+#endif
+
+#if ULAB_NUMPY_HAS_PTP
+//| def ptp(array: _ArrayLike, *, axis: Optional[int] = None) -> Union[float, int, ulab.ndarray]:
+//|     """Return the range (maximum - minimum) of the values along the given axis, or
+//|        of the flattened array, if axis is None. The dtype of the input is preserved."""
+//|     ...
+//|
+
+mp_obj_t numerical_ptp(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+        { MP_QSTR_axis, MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *ndarray = ndarray_from_mp_obj(args[0].u_obj);
+    return numerical_minmax_ndarray(ndarray, args[1].u_obj, true, false);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_ptp_obj, 1, numerical_ptp);
+#endif
+
 #if ULAB_NUMPY_HAS_ROLL
-//| def roll(array: ulab.ndarray, distance: int, *, axis: Optional[int] = None) -> None:
+//| def roll(array: ulab.ndarray, distance: int, *, axis: Optional[int] = None, inplace: bool = False) -> Optional[ulab.ndarray]:
 //|     """Shift the content of a vector by the positions given as the second
 //|        argument. If the ``axis`` keyword is supplied, the shift is applied to
-//|        the given axis.  The array is modified in place."""
+//|        the given axis. If ``inplace`` is ``True``, the array is modified in place,
+//|        and ``None`` is returned, otherwise, a new array is returned."""
 //|     ...
 //|
 
+static uint8_t *numerical_roll_address(ndarray_obj_t *ndarray, uint8_t *array, int32_t stride, size_t index) {
+    // returns the address of the element at index in the lane starting at array;
+    // a stride of 0 means that the lane is the flattened array
+    if(stride != 0) {
+        return array + (int32_t)index * stride;
+    }
+    for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndarray->ndim; i--) {
+        array += (int32_t)(index % ndarray->shape[i-1]) * ndarray->strides[i-1];
+        index /= ndarray->shape[i-1];
+    }
+    return array;
+}
+
+static void numerical_roll_inplace(ndarray_obj_t *ndarray, uint8_t *array, int32_t stride, size_t len, size_t shift) {
+    // rotates the lane to the right by shift positions; the elements are moved along the
+    // cycles of the permutation, so that each element is moved exactly once, and only
+    // a single element has to be held in a temporary
+    if((len == 0) || (shift == 0)) {
+        return;
+    }
+    size_t a = len, b = shift;
+    while(b != 0) {
+        size_t t = a % b;
+        a = b;
+        b = t;
+    }
+    uint8_t tmp[sizeof(int64_t) > sizeof(mp_float_t) ? sizeof(int64_t) : sizeof(mp_float_t)];
+    for(size_t c=0; c < a; c++) {
+        uint8_t *target = numerical_roll_address(ndarray, array, stride, c);
+        memcpy(tmp, target, ndarray->itemsize);
+        size_t j = c;
+        while(true) {
+            size_t k = j >= shift ? j - shift : j + len - shift;
+            if(k == c) {
+                break;
+            }
+            uint8_t *source = numerical_roll_address(ndarray, array, stride, k);
+            memcpy(target, source, ndarray->itemsize);
+            target = source;
+            j = k;
+        }
+        memcpy(target, tmp, ndarray->itemsize);
+    }
+}
+
+static size_t numerical_roll_shift(int32_t shift, size_t len) {
+    // converts the shift into the equivalent shift to the right in the range [0, len)
+    if(len == 0) {
+        return 0;
+    }
+    int32_t _shift = (int32_t)((shift < 0 ? -(int64_t)shift : shift) % len);
+    return shift < 0 ? (len - _shift) % len : (size_t)_shift;
+}
+
 mp_obj_t numerical_roll(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none  } },
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
         { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_inplace, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false } },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -1105,9 +1538,67 @@ mp_obj_t numerical_roll(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
     }
     ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
     uint8_t *array = ndarray->array;
-    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndarray->ndim, ndarray->shape, ndarray->dtype);
-
     int32_t shift = mp_obj_get_int(args[1].u_obj);
+
+    if(args[3].u_bool) {
+        if(args[2].u_obj == mp_const_none) { // roll the flattened array
+            // contiguous arrays can be traversed with a single stride, otherwise, the
+            // address has to be calculated from the shape
+            int32_t stride = 0;
+            if((ndarray->ndim == 1) || ndarray_is_contiguous(ndarray)) {
+                stride = ndarray->strides[ULAB_MAX_DIMS - 1];
+            }
+            numerical_roll_inplace(ndarray, array, stride, ndarray->len, numerical_roll_shift(shift, ndarray->len));
+        } else if(mp_obj_is_int(args[2].u_obj)) {
+            int8_t ax = mp_obj_get_int(args[2].u_obj);
+            if(ax < 0) ax += ndarray->ndim;
+            if((ax < 0) || (ax > ndarray->ndim - 1)) {
+                mp_raise_ValueError(translate("index out of range"));
+            }
+            size_t shape[ULAB_MAX_DIMS] = { 0 };
+            int32_t strides[ULAB_MAX_DIMS] = { 0 };
+            numerical_reduce_axes(ndarray, ax, shape, strides);
+            ax = ULAB_MAX_DIMS - ndarray->ndim + ax;
+            size_t len = ndarray->shape[ax];
+            size_t _shift = numerical_roll_shift(shift, len);
+
+            #if ULAB_MAX_DIMS > 3
+            size_t i = 0;
+            do {
+            #endif
+                #if ULAB_MAX_DIMS > 2
+                size_t j = 0;
+                do {
+                #endif
+                    #if ULAB_MAX_DIMS > 1
+                    size_t k = 0;
+                    do {
+                    #endif
+                        numerical_roll_inplace(ndarray, array, ndarray->strides[ax], len, _shift);
+                    #if ULAB_MAX_DIMS > 1
+                        array += strides[ULAB_MAX_DIMS - 1];
+                        k++;
+                    } while(k < shape[ULAB_MAX_DIMS - 1]);
+                    #endif
+                #if ULAB_MAX_DIMS > 2
+                    array -= strides[ULAB_MAX_DIMS - 1] * shape[ULAB_MAX_DIMS-1];
+                    array += strides[ULAB_MAX_DIMS - 2];
+                    j++;
+                } while(j < shape[ULAB_MAX_DIMS - 2]);
+                #endif
+            #if ULAB_MAX_DIMS > 3
+                array -= strides[ULAB_MAX_DIMS - 2] * shape[ULAB_MAX_DIMS-2];
+                array += strides[ULAB_MAX_DIMS - 3];
+                i++;
+            } while(i < shape[ULAB_MAX_DIMS - 3]);
+            #endif
+        } else {
+            mp_raise_TypeError(translate("wrong axis index"));
+        }
+        return mp_const_none;
+    }
+
+    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndarray->ndim, ndarray->shape, ndarray->dtype);
     int32_t _shift = shift < 0 ? -shift : shift;
 
     size_t counter;
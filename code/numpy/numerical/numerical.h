@@ -15,8 +15,6 @@
 #include "../../ulab.h"
 #include "../../ndarray.h"
 
-// TODO: implement cumsum
-
 #define RUN_ARGMIN1(ndarray, type, array, results, rarray, index, op)\
 {\
     uint16_t best_index = 0;\
@@ -101,19 +99,110 @@
     *(rarray)++ = isStd ? MICROPY_FLOAT_C_FUN(sqrt)(S / (div)) : M;\
 }
 
-#define RUN_DIFF1(ndarray, type, array, results, rarray, index, stencil, N)\
+#define NUMERICAL_DIFF_MAX_ORDER     (9)
+
+// The order+1 most recent values of the lane are held in a small, fixed-size
+// window, so that each element is read exactly once, and no scratch
+// memory is required on the heap
+#define RUN_DIFF1(type, array, rarray, astride, rstride, N, stencil, order)\
 {\
-    for(size_t i=0; i < (results)->shape[ULAB_MAX_DIMS - 1]; i++) {\
+    type window[NUMERICAL_DIFF_MAX_ORDER + 1];\
+    for(uint8_t d=0; d < (order); d++) {\
+        window[d] = *((type *)(array));\
+        (array) += (astride);\
+    }\
+    for(size_t i=(order); i < (N); i++) {\
+        window[(order)] = *((type *)(array));\
+        (array) += (astride);\
         type sum = 0;\
-        uint8_t *source = (array);\
-        for(uint8_t d=0; d < (N)+1; d++) {\
-            sum -= (stencil)[d] * *((type *)source);\
-            source += (ndarray)->strides[(index)];\
+        for(uint8_t d=0; d < (order)+1; d++) {\
+            sum += (stencil)[d] * window[d];\
+        }\
+        for(uint8_t d=0; d < (order); d++) {\
+            window[d] = window[d+1];\
+        }\
+        *((type *)(rarray)) = sum;\
+        (rarray) += (rstride);\
+    }\
+}
+
+// The extrema are found in a single pass; if the elements are contiguous,
+// the loop is free of branches and strides, so that it can be vectorised.
+// If ptp is true, the difference of the extrema is written to lo
+#define RUN_MINMAX1(type, array, astride, N, lo, hi, ptp)\
+{\
+    type *_array = (type *)(array);\
+    type _lo = *_array;\
+    type _hi = _lo;\
+    if((astride) == sizeof(type)) {\
+        for(size_t i=1; i < (N); i++) {\
+            type value = _array[i];\
+            _lo = value < _lo ? value : _lo;\
+            _hi = value > _hi ? value : _hi;\
+        }\
+    } else {\
+        int32_t increment = (astride) / (int32_t)sizeof(type);\
+        for(size_t i=1; i < (N); i++) {\
+            _array += increment;\
+            type value = *_array;\
+            _lo = value < _lo ? value : _lo;\
+            _hi = value > _hi ? value : _hi;\
+        }\
+    }\
+    if(ptp) {\
+        *((type *)(lo)) = _hi - _lo;\
+    } else {\
+        *((type *)(lo)) = _lo;\
+        *((type *)(hi)) = _hi;\
+    }\
+}
+
+// Same as RUN_MINMAX1, but the positions of the first occurrences are also recorded
+#define RUN_ARGMINMAX1(type, array, astride, N, lo, hi, ilo, ihi)\
+{\
+    type *_array = (type *)(array);\
+    int32_t increment = (astride) / (int32_t)sizeof(type);\
+    type _lo = *_array;\
+    type _hi = _lo;\
+    size_t _ilo = 0, _ihi = 0;\
+    for(size_t i=1; i < (N); i++) {\
+        _array += increment;\
+        type value = *_array;\
+        if(value < _lo) {\
+            _lo = value;\
+            _ilo = i;\
+        }\
+        if(value > _hi) {\
+            _hi = value;\
+            _ihi = i;\
         }\
-        (array) += (ndarray)->strides[ULAB_MAX_DIMS - 1];\
-        *(type *)(rarray) = sum;\
-        (rarray) += (results)->itemsize;\
     }\
+    *((type *)(lo)) = _lo;\
+    *((type *)(hi)) = _hi;\
+    *(ilo) = _ilo;\
+    *(ihi) = _ihi;\
+}
+
+#define NUMERICAL_CUMSUM_OP(acc, value) ((acc) + (value))
+#define NUMERICAL_CUMPROD_OP(acc, value) ((acc) * (value))
+#define NUMERICAL_CUMMAX_OP(acc, value) ((value) > (acc) ? (value) : (acc))
+#define NUMERICAL_CUMMIN_OP(acc, value) ((value) < (acc) ? (value) : (acc))
+
+// The accumulator is carried in a register of type atype, which is also the
+// type of the output; rarray can be an arbitrary strided array, e.g., out=,
+// and N must be at least 1
+#define RUN_CUMULATIVE1(type, atype, array, rarray, astride, rstride, N, op)\
+{\
+    atype acc = (atype)(*((type *)(array)));\
+    *((atype *)(rarray)) = acc;\
+    for(size_t i=1; i < (N); i++) {\
+        (array) += (astride);\
+        (rarray) += (rstride);\
+        acc = op(acc, (atype)(*((type *)(array))));\
+        *((atype *)(rarray)) = acc;\
+    }\
+    (array) += (astride);\
+    (rarray) += (rstride);\
 }
 
 #define HEAPSORT1(type, array, increment, N)\
@@ -208,8 +297,12 @@
     RUN_ARGMIN1((ndarray), type, (array), (results), (rarray), (index), (op));\
 } while(0)
 
-#define RUN_DIFF(ndarray, type, array, results, rarray, shape, strides, index, stencil, N) do {\
-    RUN_DIFF1((ndarray), type, (array), (results), (rarray), (index), (stencil), (N));\
+#define RUN_DIFF(type, array, rarray, shape, strides, rstrides, astride, rstride, N, stencil, order) do {\
+    RUN_DIFF1(type, (array), (rarray), (astride), (rstride), (N), (stencil), (order));\
+} while(0)
+
+#define RUN_CUMULATIVE(type, atype, array, rarray, shape, strides, rstrides, astride, rstride, N, op) do {\
+    RUN_CUMULATIVE1(type, atype, (array), (rarray), (astride), (rstride), (N), op);\
 } while(0)
 
 #define HEAPSORT(ndarray, type, array, shape, strides, index, increment, N) do {\
@@ -274,16 +367,28 @@
     } while(l < (shape)[ULAB_MAX_DIMS - 1]);\
 } while(0)
 
-#define RUN_DIFF(ndarray, type, array, results, rarray, shape, strides, index, stencil, N) do {\
+#define RUN_DIFF(type, array, rarray, shape, strides, rstrides, astride, rstride, N, stencil, order) do {\
     size_t l = 0;\
     do {\
-        RUN_DIFF1((ndarray), type, (array), (results), (rarray), (index), (stencil), (N));\
-        (array) -= (ndarray)->strides[ULAB_MAX_DIMS - 1] * (results)->shape[ULAB_MAX_DIMS - 1];\
-        (array) += (ndarray)->strides[ULAB_MAX_DIMS - 2];\
-        (rarray) -= (results)->strides[ULAB_MAX_DIMS - 1] * (results)->shape[ULAB_MAX_DIMS - 1];\
-        (rarray) += (results)->strides[ULAB_MAX_DIMS - 2];\
+        RUN_DIFF1(type, (array), (rarray), (astride), (rstride), (N), (stencil), (order));\
+        (array) -= (astride) * (N);\
+        (array) += (strides)[ULAB_MAX_DIMS - 1];\
+        (rarray) -= (rstride) * ((N) - (order));\
+        (rarray) += (rstrides)[ULAB_MAX_DIMS - 1];\
         l++;\
-    } while(l < (results)->shape[ULAB_MAX_DIMS - 2]);\
+    } while(l < (shape)[ULAB_MAX_DIMS - 1]);\
+} while(0)
+
+#define RUN_CUMULATIVE(type, atype, array, rarray, shape, strides, rstrides, astride, rstride, N, op) do {\
+    size_t l = 0;\
+    do {\
+        RUN_CUMULATIVE1(type, atype, (array), (rarray), (astride), (rstride), (N), op);\
+        (array) -= (astride) * (N);\
+        (array) += (strides)[ULAB_MAX_DIMS - 1];\
+        (rarray) -= (rstride) * (N);\
+        (rarray) += (rstrides)[ULAB_MAX_DIMS - 1];\
+        l++;\
+    } while(l < (shape)[ULAB_MAX_DIMS - 1]);\
 } while(0)
 
 #define HEAPSORT(ndarray, type, array, shape, strides, index, increment, N) do {\
@@ -388,24 +493,44 @@
     } while(k < (shape)[ULAB_MAX_DIMS - 2]);\
 } while(0)
 
-#define RUN_DIFF(ndarray, type, array, results, rarray, shape, strides, index, stencil, N) do {\
+#define RUN_DIFF(type, array, rarray, shape, strides, rstrides, astride, rstride, N, stencil, order) do {\
     size_t k = 0;\
     do {\
         size_t l = 0;\
         do {\
-            RUN_DIFF1((ndarray), type, (array), (results), (rarray), (index), (stencil), (N));\
-            (array) -= (ndarray)->strides[ULAB_MAX_DIMS - 1] * (results)->shape[ULAB_MAX_DIMS - 1];\
-			(array) += (ndarray)->strides[ULAB_MAX_DIMS - 2];\
-            (rarray) -= (results)->strides[ULAB_MAX_DIMS - 1] * (results)->shape[ULAB_MAX_DIMS - 1];\
-            (rarray) += (results)->strides[ULAB_MAX_DIMS - 2];\
+            RUN_DIFF1(type, (array), (rarray), (astride), (rstride), (N), (stencil), (order));\
+            (array) -= (astride) * (N);\
+            (array) += (strides)[ULAB_MAX_DIMS - 1];\
+            (rarray) -= (rstride) * ((N) - (order));\
+            (rarray) += (rstrides)[ULAB_MAX_DIMS - 1];\
             l++;\
-        } while(l < (shape)[ULAB_MAX_DIMS - 2]);\
-        (array) -= (ndarray)->strides[ULAB_MAX_DIMS - 2] * (results)->shape[ULAB_MAX_DIMS-2];\
-        (array) += (ndarray)->strides[ULAB_MAX_DIMS - 3];\
-        (rarray) -= (results)->strides[ULAB_MAX_DIMS - 2] * (results)->shape[ULAB_MAX_DIMS - 2];\
-        (rarray) += (results)->strides[ULAB_MAX_DIMS - 3];\
+        } while(l < (shape)[ULAB_MAX_DIMS - 1]);\
+        (array) -= (strides)[ULAB_MAX_DIMS - 1] * (shape)[ULAB_MAX_DIMS - 1];\
+        (array) += (strides)[ULAB_MAX_DIMS - 2];\
+        (rarray) -= (rstrides)[ULAB_MAX_DIMS - 1] * (shape)[ULAB_MAX_DIMS - 1];\
+        (rarray) += (rstrides)[ULAB_MAX_DIMS - 2];\
         k++;\
-    } while(k < (shape)[ULAB_MAX_DIMS - 3]);\
+    } while(k < (shape)[ULAB_MAX_DIMS - 2]);\
+} while(0)
+
+#define RUN_CUMULATIVE(type, atype, array, rarray, shape, strides, rstrides, astride, rstride, N, op) do {\
+    size_t k = 0;\
+    do {\
+        size_t l = 0;\
+        do {\
+            RUN_CUMULATIVE1(type, atype, (array), (rarray), (astride), (rstride), (N), op);\
+            (array) -= (astride) * (N);\
+            (array) += (strides)[ULAB_MAX_DIMS - 1];\
+            (rarray) -= (rstride) * (N);\
+            (rarray) += (rstrides)[ULAB_MAX_DIMS - 1];\
+            l++;\
+        } while(l < (shape)[ULAB_MAX_DIMS - 1]);\
+        (array) -= (strides)[ULAB_MAX_DIMS - 1] * (shape)[ULAB_MAX_DIMS - 1];\
+        (array) += (strides)[ULAB_MAX_DIMS - 2];\
+        (rarray) -= (rstrides)[ULAB_MAX_DIMS - 1] * (shape)[ULAB_MAX_DIMS - 1];\
+        (rarray) += (rstrides)[ULAB_MAX_DIMS - 2];\
+        k++;\
+    } while(k < (shape)[ULAB_MAX_DIMS - 2]);\
 } while(0)
 
 #define HEAPSORT(ndarray, type, array, shape, strides, index, increment, N) do {\
@@ -554,32 +679,60 @@
     } while(j < (shape)[ULAB_MAX_DIMS - 3]);\
 } while(0)
 
-#define RUN_DIFF(ndarray, type, array, results, rarray, shape, strides, index, stencil, N) do {\
+#define RUN_DIFF(type, array, rarray, shape, strides, rstrides, astride, rstride, N, stencil, order) do {\
     size_t j = 0;\
     do {\
         size_t k = 0;\
         do {\
             size_t l = 0;\
             do {\
-                RUN_DIFF1((ndarray), type, (array), (results), (rarray), (index), (stencil), (N));\
-                (array) -= (ndarray)->strides[ULAB_MAX_DIMS - 1] * (results)->shape[ULAB_MAX_DIMS - 1];\
-                (array) += (ndarray)->strides[ULAB_MAX_DIMS - 2];\
-                (rarray) -= (results)->strides[ULAB_MAX_DIMS - 1] * (results)->shape[ULAB_MAX_DIMS - 1];\
-                (rarray) += (results)->strides[ULAB_MAX_DIMS - 2];\
+                RUN_DIFF1(type, (array), (rarray), (astride), (rstride), (N), (stencil), (order));\
+                (array) -= (astride) * (N);\
+                (array) += (strides)[ULAB_MAX_DIMS - 1];\
+                (rarray) -= (rstride) * ((N) - (order));\
+                (rarray) += (rstrides)[ULAB_MAX_DIMS - 1];\
                 l++;\
-            } while(l < (shape)[ULAB_MAX_DIMS - 2]);\
-            (array) -= (strides)[ULAB_MAX_DIMS - 2] * (shape)[ULAB_MAX_DIMS-2];\
-            (array) += (strides)[ULAB_MAX_DIMS - 3];\
-            (rarray) -= (results)->strides[ULAB_MAX_DIMS - 2] * (results)->shape[ULAB_MAX_DIMS - 2];\
-            (rarray) += (results)->strides[ULAB_MAX_DIMS - 3];\
+            } while(l < (shape)[ULAB_MAX_DIMS - 1]);\
+            (array) -= (strides)[ULAB_MAX_DIMS - 1] * (shape)[ULAB_MAX_DIMS - 1];\
+            (array) += (strides)[ULAB_MAX_DIMS - 2];\
+            (rarray) -= (rstrides)[ULAB_MAX_DIMS - 1] * (shape)[ULAB_MAX_DIMS - 1];\
+            (rarray) += (rstrides)[ULAB_MAX_DIMS - 2];\
             k++;\
-        } while(k < (shape)[ULAB_MAX_DIMS - 3]);\
-        (array) -= (strides)[ULAB_MAX_DIMS - 3] * (shape)[ULAB_MAX_DIMS-3];\
-        (array) += (strides)[ULAB_MAX_DIMS - 4];\
-        (rarray) -= (results)->strides[ULAB_MAX_DIMS - 3] * (results)->shape[ULAB_MAX_DIMS - 3];\
-        (rarray) += (results)->strides[ULAB_MAX_DIMS - 4];\
+        } while(k < (shape)[ULAB_MAX_DIMS - 2]);\
+        (array) -= (strides)[ULAB_MAX_DIMS - 2] * (shape)[ULAB_MAX_DIMS - 2];\
+        (array) += (strides)[ULAB_MAX_DIMS - 3];\
+        (rarray) -= (rstrides)[ULAB_MAX_DIMS - 2] * (shape)[ULAB_MAX_DIMS - 2];\
+        (rarray) += (rstrides)[ULAB_MAX_DIMS - 3];\
         j++;\
-    } while(j < (shape)[ULAB_MAX_DIMS - 4]);\
+    } while(j < (shape)[ULAB_MAX_DIMS - 3]);\
+} while(0)
+
+#define RUN_CUMULATIVE(type, atype, array, rarray, shape, strides, rstrides, astride, rstride, N, op) do {\
+    size_t j = 0;\
+    do {\
+        size_t k = 0;\
+        do {\
+            size_t l = 0;\
+            do {\
+                RUN_CUMULATIVE1(type, atype, (array), (rarray), (astride), (rstride), (N), op);\
+                (array) -= (astride) * (N);\
+                (array) += (strides)[ULAB_MAX_DIMS - 1];\
+                (rarray) -= (rstride) * (N);\
+                (rarray) += (rstrides)[ULAB_MAX_DIMS - 1];\
+                l++;\
+            } while(l < (shape)[ULAB_MAX_DIMS - 1]);\
+            (array) -= (strides)[ULAB_MAX_DIMS - 1] * (shape)[ULAB_MAX_DIMS - 1];\
+            (array) += (strides)[ULAB_MAX_DIMS - 2];\
+            (rarray) -= (rstrides)[ULAB_MAX_DIMS - 1] * (shape)[ULAB_MAX_DIMS - 1];\
+            (rarray) += (rstrides)[ULAB_MAX_DIMS - 2];\
+            k++;\
+        } while(k < (shape)[ULAB_MAX_DIMS - 2]);\
+        (array) -= (strides)[ULAB_MAX_DIMS - 2] * (shape)[ULAB_MAX_DIMS - 2];\
+        (array) += (strides)[ULAB_MAX_DIMS - 3];\
+        (rarray) -= (rstrides)[ULAB_MAX_DIMS - 2] * (shape)[ULAB_MAX_DIMS - 2];\
+        (rarray) += (rstrides)[ULAB_MAX_DIMS - 3];\
+        j++;\
+    } while(j < (shape)[ULAB_MAX_DIMS - 3]);\
 } while(0)
 
 #define HEAPSORT(ndarray, type, array, shape, strides, index, increment, N) do {\
@@ -631,18 +784,25 @@
 
 #endif
 
+mp_obj_t numerical_minmax_ndarray(ndarray_obj_t *, mp_obj_t , bool , bool );
+
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_all_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_any_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_argmax_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_argmin_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_argsort_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(numerical_cross_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_cummax_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_cummin_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_cumprod_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_cumsum_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_diff_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_flip_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_max_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_mean_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_median_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_min_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_ptp_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_roll_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_std_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_sum_obj);
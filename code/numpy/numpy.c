@@ -19,15 +19,18 @@
 #include "numpy.h"
 #include "../ulab_create.h"
 #include "approx/approx.h"
+#include "carray/carray.h"
 #include "compare/compare.h"
 #include "fft/fft.h"
 #include "filter/filter.h"
+#include "histogram/histogram.h"
 #include "linalg/linalg.h"
 #include "numerical/numerical.h"
 #include "stats/stats.h"
 #include "transform/transform.h"
 #include "poly/poly.h"
 #include "vector/vector.h"
+#include "window/window.h"
 
 //| """Compatibility layer for numpy"""
 //|
@@ -112,6 +115,9 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR_uint32), (mp_obj_t)&ndscalar_uint32_obj },
     { MP_OBJ_NEW_QSTR(MP_QSTR_int64), (mp_obj_t)&ndscalar_int64_obj },
     { MP_OBJ_NEW_QSTR(MP_QSTR_float), (mp_obj_t)&ndscalar_float_obj },
+    #if ULAB_SUPPORTS_COMPLEX
+    { MP_OBJ_NEW_QSTR(MP_QSTR_complex), (mp_obj_t)&carray_complex_obj },
+    #endif
 #else
     { MP_ROM_QSTR(MP_QSTR_bool), MP_ROM_INT(NDARRAY_BOOL) },
     { MP_ROM_QSTR(MP_QSTR_uint8), MP_ROM_INT(NDARRAY_UINT8) },
@@ -122,6 +128,9 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_int32), MP_ROM_INT(NDARRAY_INT32) },
     { MP_ROM_QSTR(MP_QSTR_int64), MP_ROM_INT(NDARRAY_INT64) },
     { MP_ROM_QSTR(MP_QSTR_float), MP_ROM_INT(NDARRAY_FLOAT) },
+    #if ULAB_SUPPORTS_COMPLEX
+    { MP_ROM_QSTR(MP_QSTR_complex), MP_ROM_INT(NDARRAY_COMPLEX) },
+    #endif
 #endif
 
 
@@ -179,6 +188,19 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
 	#if ULAB_NUMPY_HAS_ZEROS
         { MP_ROM_QSTR(MP_QSTR_zeros), (mp_obj_t)&create_zeros_obj },
     #endif
+    // functions of the carray sub-module
+    #if ULAB_SUPPORTS_COMPLEX
+        #if ULAB_NUMPY_HAS_CONJUGATE
+            { MP_OBJ_NEW_QSTR(MP_QSTR_conj), (mp_obj_t)&carray_conjugate_obj },
+            { MP_OBJ_NEW_QSTR(MP_QSTR_conjugate), (mp_obj_t)&carray_conjugate_obj },
+        #endif
+        #if ULAB_NUMPY_HAS_IMAG
+            { MP_OBJ_NEW_QSTR(MP_QSTR_imag), (mp_obj_t)&carray_imag_obj },
+        #endif
+        #if ULAB_NUMPY_HAS_REAL
+            { MP_OBJ_NEW_QSTR(MP_QSTR_real), (mp_obj_t)&carray_real_obj },
+        #endif
+    #endif
     // functions of the compare sub-module
     #if ULAB_NUMPY_HAS_CLIP
         { MP_OBJ_NEW_QSTR(MP_QSTR_clip), (mp_obj_t)&compare_clip_obj },
@@ -208,6 +230,16 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_CONVOLVE
         { MP_OBJ_NEW_QSTR(MP_QSTR_convolve), (mp_obj_t)&filter_convolve_obj },
     #endif
+    #if ULAB_NUMPY_HAS_CORRELATE
+        { MP_OBJ_NEW_QSTR(MP_QSTR_correlate), (mp_obj_t)&filter_correlate_obj },
+    #endif
+    // functions of the histogram sub-module
+    #if ULAB_NUMPY_HAS_BINCOUNT
+        { MP_OBJ_NEW_QSTR(MP_QSTR_bincount), (mp_obj_t)&histogram_bincount_obj },
+    #endif
+    #if ULAB_NUMPY_HAS_HISTOGRAM
+        { MP_OBJ_NEW_QSTR(MP_QSTR_histogram), (mp_obj_t)&histogram_histogram_obj },
+    #endif
     // functions of the numerical sub-module
     #if ULAB_NUMPY_HAS_ALL
         { MP_OBJ_NEW_QSTR(MP_QSTR_all), (mp_obj_t)&numerical_all_obj },
@@ -225,6 +257,16 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_CROSS
         { MP_OBJ_NEW_QSTR(MP_QSTR_cross), (mp_obj_t)&numerical_cross_obj },
     #endif
+    #if ULAB_NUMPY_HAS_CUMMINMAX
+        { MP_OBJ_NEW_QSTR(MP_QSTR_cummax), (mp_obj_t)&numerical_cummax_obj },
+        { MP_OBJ_NEW_QSTR(MP_QSTR_cummin), (mp_obj_t)&numerical_cummin_obj },
+    #endif
+    #if ULAB_NUMPY_HAS_CUMPROD
+        { MP_OBJ_NEW_QSTR(MP_QSTR_cumprod), (mp_obj_t)&numerical_cumprod_obj },
+    #endif
+    #if ULAB_NUMPY_HAS_CUMSUM
+        { MP_OBJ_NEW_QSTR(MP_QSTR_cumsum), (mp_obj_t)&numerical_cumsum_obj },
+    #endif
     #if ULAB_NUMPY_HAS_DIFF
         { MP_OBJ_NEW_QSTR(MP_QSTR_diff), (mp_obj_t)&numerical_diff_obj },
     #endif
@@ -249,6 +291,9 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_MINMAX
         { MP_OBJ_NEW_QSTR(MP_QSTR_min), (mp_obj_t)&numerical_min_obj },
     #endif
+    #if ULAB_NUMPY_HAS_PTP
+        { MP_OBJ_NEW_QSTR(MP_QSTR_ptp), (mp_obj_t)&numerical_ptp_obj },
+    #endif
     #if ULAB_NUMPY_HAS_ROLL
         { MP_OBJ_NEW_QSTR(MP_QSTR_roll), (mp_obj_t)&numerical_roll_obj },
     #endif
@@ -343,6 +388,19 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #endif
     #if ULAB_NUMPY_HAS_VECTORIZE
     { MP_OBJ_NEW_QSTR(MP_QSTR_vectorize), (mp_obj_t)&vectorise_vectorize_obj },
+    #endif
+    // functions of the window sub-module
+    #if ULAB_NUMPY_HAS_BLACKMAN
+        { MP_OBJ_NEW_QSTR(MP_QSTR_blackman), (mp_obj_t)&window_blackman_obj },
+    #endif
+    #if ULAB_NUMPY_HAS_HAMMING
+        { MP_OBJ_NEW_QSTR(MP_QSTR_hamming), (mp_obj_t)&window_hamming_obj },
+    #endif
+    #if ULAB_NUMPY_HAS_HANNING
+        { MP_OBJ_NEW_QSTR(MP_QSTR_hanning), (mp_obj_t)&window_hanning_obj },
+    #endif
+    #if ULAB_NUMPY_HAS_KAISER
+        { MP_OBJ_NEW_QSTR(MP_QSTR_kaiser), (mp_obj_t)&window_kaiser_obj },
     #endif
 	#if NDARRAY_HAS_COPY	// todo: verify if required
 	{ MP_OBJ_NEW_QSTR(MP_QSTR_copy), (mp_obj_t)&ndarray_copy_obj },
@@ -168,9 +168,21 @@ const char float_type_string[] = "float64";
 
 const char* dtype_index_to_sting[] = { "uint8", "int8", "uint16", "int16", "uint32", "int32", "int64", float_type_string};
 
+#if ULAB_SUPPORTS_COMPLEX
+#if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+const char complex_type_string[] = "complex64";
+#else
+const char complex_type_string[] = "complex128";
+#endif
+#endif
+
 const char* python_type_to_string(int type)
 {
 	int w;
+#if ULAB_SUPPORTS_COMPLEX
+	// complexes have no temporary buffer type, hence, no index
+	if (type == NDARRAY_COMPLEX) return complex_type_string;
+#endif
 	return  dtype_index_to_sting[python_type_to_index(type, &w)];
 }
 
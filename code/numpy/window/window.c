@@ -0,0 +1,251 @@
+
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+*/
+
+#include <math.h>
+#include <string.h>
+#include "py/obj.h"
+#include "py/runtime.h"
+#include "py/misc.h"
+
+#include "../../ulab.h"
+#include "../../ulab_tools.h"
+#include "window.h"
+
+//| """Window functions"""
+//|
+
+#if WINDOW_HAS_GENERATOR
+mp_float_t window_bessel_i0(mp_float_t x) {
+    // the power series of the modified Bessel function of the first kind of order 0
+    mp_float_t sum = MICROPY_FLOAT_CONST(1.0), term = MICROPY_FLOAT_CONST(1.0);
+    mp_float_t q = x * x / MICROPY_FLOAT_CONST(4.0);
+    for(uint16_t k=1; term > sum * WINDOW_EPSILON; k++) {
+        term *= q / ((mp_float_t)k * (mp_float_t)k);
+        sum += term;
+    }
+    return sum;
+}
+
+void window_fill(mp_float_t *window, size_t n, uint8_t type, mp_float_t beta, bool periodic) {
+    // symmetric windows are those of numpy; periodic windows are the first n points of the
+    // symmetric window of length n + 1, as in scipy.signal.get_window(..., fftbins=True)
+    if(n == 1) {
+        window[0] = MICROPY_FLOAT_CONST(1.0);
+        return;
+    }
+    mp_float_t d = (mp_float_t)(periodic ? n : n - 1);
+    if(type == WINDOW_KAISER) {
+        mp_float_t i0beta = window_bessel_i0(beta);
+        for(size_t i=0; i < n; i++) {
+            mp_float_t r = MICROPY_FLOAT_CONST(2.0) * (mp_float_t)i / d - MICROPY_FLOAT_CONST(1.0);
+            window[i] = window_bessel_i0(beta * MICROPY_FLOAT_C_FUN(sqrt)(MICROPY_FLOAT_CONST(1.0) - r * r)) / i0beta;
+        }
+        return;
+    }
+    // the others are generalised cosine windows a0 - a1 cos(x) + a2 cos(2x)
+    mp_float_t a0 = MICROPY_FLOAT_CONST(1.0), a1 = MICROPY_FLOAT_CONST(0.0), a2 = MICROPY_FLOAT_CONST(0.0);
+    if(type == WINDOW_HANN) {
+        a0 = MICROPY_FLOAT_CONST(0.5);
+        a1 = MICROPY_FLOAT_CONST(0.5);
+    } else if(type == WINDOW_HAMMING) {
+        a0 = MICROPY_FLOAT_CONST(0.54);
+        a1 = MICROPY_FLOAT_CONST(0.46);
+    } else if(type == WINDOW_BLACKMAN) {
+        a0 = MICROPY_FLOAT_CONST(0.42);
+        a1 = MICROPY_FLOAT_CONST(0.5);
+        a2 = MICROPY_FLOAT_CONST(0.08);
+    }
+    for(size_t i=0; i < n; i++) {
+        mp_float_t x = MICROPY_FLOAT_CONST(2.0) * MP_PI * (mp_float_t)i / d;
+        window[i] = a0 - a1 * MICROPY_FLOAT_C_FUN(cos)(x) + a2 * MICROPY_FLOAT_C_FUN(cos)(MICROPY_FLOAT_CONST(2.0) * x);
+    }
+}
+#endif /* WINDOW_HAS_GENERATOR */
+
+#if WINDOW_HAS_ARRAY
+// The first ULAB_WINDOW_CACHE_SIZE windows, which fit, are kept in a static pool of
+// ULAB_WINDOW_CACHE_LENGTH values, so that later requests of the same window return the
+// same array without allocation, or evaluation. The cached windows are never evicted,
+// and they are shared by the short-time Fourier transform, and the FIR design, hence
+// the functions that hand a window to the user return a copy of it.
+#define WINDOW_HAS_CACHE    ((ULAB_WINDOW_CACHE_SIZE > 0) && (ULAB_WINDOW_CACHE_LENGTH > 0))
+
+#if WINDOW_HAS_CACHE
+typedef struct _window_cache_t {
+    uint8_t type;
+    bool periodic;
+    mp_float_t beta;
+    ndarray_obj_t ndarray;
+} window_cache_t;
+
+static window_cache_t window_cache[ULAB_WINDOW_CACHE_SIZE];
+static mp_float_t window_pool[ULAB_WINDOW_CACHE_LENGTH];
+static size_t window_cache_count = 0;
+static size_t window_pool_used = 0;
+#endif
+
+static ndarray_obj_t *window_cached(uint8_t type, size_t n, bool periodic, mp_float_t beta) {
+    #if WINDOW_HAS_CACHE
+    for(size_t k=0; k < window_cache_count; k++) {
+        window_cache_t *entry = &window_cache[k];
+        if((entry->type == type) && (entry->ndarray.len == n) && (entry->periodic == periodic) && (entry->beta == beta)) {
+            return &entry->ndarray;
+        }
+    }
+    if((n > 0) && (window_cache_count < ULAB_WINDOW_CACHE_SIZE) && (window_pool_used + n <= ULAB_WINDOW_CACHE_LENGTH)) {
+        window_cache_t *entry = &window_cache[window_cache_count++];
+        entry->type = type;
+        entry->periodic = periodic;
+        entry->beta = beta;
+        ndarray_obj_t *ndarray = &entry->ndarray;
+        memset(ndarray, 0, sizeof(ndarray_obj_t));
+        ndarray->base.type = &ulab_ndarray_type;
+        ndarray->dtype = NDARRAY_FLOAT;
+        ndarray->itemsize = sizeof(mp_float_t);
+        ndarray->boolean = NDARRAY_NUMERIC;
+        ndarray->ndim = 1;
+        ndarray->len = n;
+        ndarray->shape[ULAB_MAX_DIMS - 1] = n;
+        ndarray->strides[ULAB_MAX_DIMS - 1] = sizeof(mp_float_t);
+        ndarray->array = window_pool + window_pool_used;
+        ndarray->origin = ndarray->array;
+        window_pool_used += n;
+        window_fill((mp_float_t *)ndarray->array, n, type, beta, periodic);
+        return ndarray;
+    }
+    #endif
+    ndarray_obj_t *ndarray = ndarray_new_linear_array(n, NDARRAY_FLOAT);
+    if(n > 0) {
+        window_fill((mp_float_t *)ndarray->array, n, type, beta, periodic);
+    }
+    return ndarray;
+}
+
+ndarray_obj_t *window_copy(ndarray_obj_t *ndarray) {
+    // returns an array that the caller can modify; only windows in the pool are copied
+    #if WINDOW_HAS_CACHE
+    mp_float_t *array = (mp_float_t *)ndarray->array;
+    if((array >= window_pool) && (array < window_pool + ULAB_WINDOW_CACHE_LENGTH)) {
+        return ndarray_copy_view(ndarray);
+    }
+    #endif
+    return ndarray;
+}
+
+ndarray_obj_t *window_get(mp_obj_t spec, size_t n, bool periodic) {
+    // the window is either a name, or a (name, parameter) tuple, as in scipy.signal.get_window
+    mp_obj_t name = spec;
+    mp_obj_t param = mp_const_none;
+    if(mp_obj_is_type(spec, &mp_type_tuple)) {
+        mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(spec);
+        if((tuple->len < 1) || (tuple->len > 2)) {
+            mp_raise_ValueError(translate("window must be a name, or a (name, parameter) tuple"));
+        }
+        name = tuple->items[0];
+        if(tuple->len == 2) {
+            param = tuple->items[1];
+        }
+    }
+    if(!mp_obj_is_str(name)) {
+        mp_raise_TypeError(translate("window must be a name, or a (name, parameter) tuple"));
+    }
+    qstr window = mp_obj_str_get_qstr(name);
+    uint8_t type;
+    if(window == MP_QSTR_boxcar) {
+        type = WINDOW_BOXCAR;
+    } else if((window == MP_QSTR_hann) || (window == MP_QSTR_hanning)) {
+        type = WINDOW_HANN;
+    } else if(window == MP_QSTR_hamming) {
+        type = WINDOW_HAMMING;
+    } else if(window == MP_QSTR_blackman) {
+        type = WINDOW_BLACKMAN;
+    } else if(window == MP_QSTR_kaiser) {
+        if(param == mp_const_none) {
+            mp_raise_ValueError(translate("the kaiser window requires beta"));
+        }
+        return window_cached(WINDOW_KAISER, n, periodic, mp_obj_get_float(param));
+    } else {
+        mp_raise_ValueError(translate("unknown window"));
+    }
+    return window_cached(type, n, periodic, MICROPY_FLOAT_CONST(0.0));
+}
+
+static size_t window_length(mp_obj_t M) {
+    // as in numpy, the window is empty for M < 1
+    mp_int_t m = mp_obj_get_int(M);
+    return m < 1 ? 0 : (size_t)m;
+}
+#endif /* WINDOW_HAS_ARRAY */
+
+#if ULAB_NUMPY_HAS_BLACKMAN
+//| def blackman(M: int) -> ulab.ndarray:
+//|     """
+//|     :param int M: The number of points
+//|
+//|     Return the symmetric Blackman window."""
+//|     ...
+//|
+
+mp_obj_t window_blackman(mp_obj_t M) {
+    return MP_OBJ_FROM_PTR(window_copy(window_cached(WINDOW_BLACKMAN, window_length(M), false, MICROPY_FLOAT_CONST(0.0))));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(window_blackman_obj, window_blackman);
+#endif
+
+#if ULAB_NUMPY_HAS_HAMMING
+//| def hamming(M: int) -> ulab.ndarray:
+//|     """
+//|     :param int M: The number of points
+//|
+//|     Return the symmetric Hamming window."""
+//|     ...
+//|
+
+mp_obj_t window_hamming(mp_obj_t M) {
+    return MP_OBJ_FROM_PTR(window_copy(window_cached(WINDOW_HAMMING, window_length(M), false, MICROPY_FLOAT_CONST(0.0))));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(window_hamming_obj, window_hamming);
+#endif
+
+#if ULAB_NUMPY_HAS_HANNING
+//| def hanning(M: int) -> ulab.ndarray:
+//|     """
+//|     :param int M: The number of points
+//|
+//|     Return the symmetric Hann window."""
+//|     ...
+//|
+
+mp_obj_t window_hanning(mp_obj_t M) {
+    return MP_OBJ_FROM_PTR(window_copy(window_cached(WINDOW_HANN, window_length(M), false, MICROPY_FLOAT_CONST(0.0))));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(window_hanning_obj, window_hanning);
+#endif
+
+#if ULAB_NUMPY_HAS_KAISER
+//| def kaiser(M: int, beta: float) -> ulab.ndarray:
+//|     """
+//|     :param int M: The number of points
+//|     :param float beta: The shape parameter
+//|
+//|     Return the symmetric Kaiser window."""
+//|     ...
+//|
+
+mp_obj_t window_kaiser(mp_obj_t M, mp_obj_t beta) {
+    return MP_OBJ_FROM_PTR(window_copy(window_cached(WINDOW_KAISER, window_length(M), false, mp_obj_get_float(beta))));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(window_kaiser_obj, window_kaiser);
+#endif
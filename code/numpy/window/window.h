@@ -0,0 +1,63 @@
+
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+*/
+
+#ifndef _WINDOW_
+#define _WINDOW_
+
+#include "../../ulab.h"
+#include "../../ndarray.h"
+
+// the windows are generated for numpy, scipy.signal.get_window, the short-time Fourier
+// transform of scipy.signal, and the design of FIR filters
+#define WINDOW_HAS_GENERATOR (ULAB_NUMPY_HAS_BLACKMAN || ULAB_NUMPY_HAS_HAMMING || ULAB_NUMPY_HAS_HANNING ||\
+                                ULAB_NUMPY_HAS_KAISER || ULAB_SCIPY_SIGNAL_HAS_GET_WINDOW ||\
+                                ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM || ULAB_SCIPY_SIGNAL_HAS_WELCH || ULAB_SCIPY_SIGNAL_HAS_CSD ||\
+                                ULAB_SCIPY_SIGNAL_HAS_RESAMPLE_POLY || ULAB_SCIPY_SIGNAL_HAS_DECIMATE ||\
+                                ULAB_SCIPY_SIGNAL_HAS_FIRWIN)
+
+// only these return the windows as arrays, and use the cache
+#define WINDOW_HAS_ARRAY (ULAB_NUMPY_HAS_BLACKMAN || ULAB_NUMPY_HAS_HAMMING || ULAB_NUMPY_HAS_HANNING ||\
+                                ULAB_NUMPY_HAS_KAISER || ULAB_SCIPY_SIGNAL_HAS_GET_WINDOW ||\
+                                ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM || ULAB_SCIPY_SIGNAL_HAS_WELCH || ULAB_SCIPY_SIGNAL_HAS_CSD ||\
+                                ULAB_SCIPY_SIGNAL_HAS_FIRWIN)
+
+#ifndef WINDOW_EPSILON
+#if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+#define WINDOW_EPSILON      MICROPY_FLOAT_CONST(1.2e-7)
+#elif MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
+#define WINDOW_EPSILON      MICROPY_FLOAT_CONST(2.3e-16)
+#endif
+#endif /* WINDOW_EPSILON */
+
+enum WINDOW_TYPE {
+    WINDOW_BOXCAR,
+    WINDOW_HANN,
+    WINDOW_HAMMING,
+    WINDOW_BLACKMAN,
+    WINDOW_KAISER,
+};
+
+#if WINDOW_HAS_GENERATOR
+mp_float_t window_bessel_i0(mp_float_t );
+void window_fill(mp_float_t *, size_t , uint8_t , mp_float_t , bool );
+#endif
+
+#if WINDOW_HAS_ARRAY
+ndarray_obj_t *window_copy(ndarray_obj_t *);
+ndarray_obj_t *window_get(mp_obj_t , size_t , bool );
+#endif
+
+MP_DECLARE_CONST_FUN_OBJ_1(window_blackman_obj);
+MP_DECLARE_CONST_FUN_OBJ_1(window_hamming_obj);
+MP_DECLARE_CONST_FUN_OBJ_1(window_hanning_obj);
+MP_DECLARE_CONST_FUN_OBJ_2(window_kaiser_obj);
+
+#endif
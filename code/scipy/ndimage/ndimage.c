@@ -0,0 +1,820 @@
+
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+*/
+
+#include <math.h>
+#include <string.h>
+#include "py/runtime.h"
+#include "py/binary.h"
+
+#include "../../ulab.h"
+#include "../../ndarray.h"
+#include "../../ulab_tools.h"
+#include "ndimage.h"
+
+#if NDIMAGE_HAS_RANK_FILTER || NDIMAGE_HAS_CORRELATE
+static size_t ndimage_boundary_index(int32_t i, size_t n, uint8_t mode) {
+    // maps an index outside [0, n) into the array according to the boundary mode; returns n,
+    // if the constant is to be used
+    if((i >= 0) && ((size_t)i < n)) {
+        return (size_t)i;
+    }
+    int32_t len = (int32_t)n;
+    if(mode == NDIMAGE_MODE_CONSTANT) {
+        return n;
+    } else if(mode == NDIMAGE_MODE_NEAREST) {
+        return i < 0 ? 0 : n - 1;
+    } else if(mode == NDIMAGE_MODE_WRAP) {
+        i %= len;
+        return (size_t)(i < 0 ? i + len : i);
+    } else if(mode == NDIMAGE_MODE_REFLECT) {
+        // d c b a | a b c d | d c b a, whose period is 2n
+        i %= 2 * len;
+        if(i < 0) {
+            i += 2 * len;
+        }
+        return (size_t)(i < len ? i : 2 * len - 1 - i);
+    }
+    // mirror: d c b | a b c d | c b a, whose period is 2n - 2
+    if(len == 1) {
+        return 0;
+    }
+    i %= 2 * len - 2;
+    if(i < 0) {
+        i += 2 * len - 2;
+    }
+    return (size_t)(i < len ? i : 2 * len - 2 - i);
+}
+#endif
+
+#if NDIMAGE_HAS_RANK_FILTER
+// The rank filter keeps the k values of the window in two heaps: the rank + 1 smallest
+// values are in a max-heap, and the rest in a min-heap, so that the top of the max-heap is
+// the value of the requested rank. Since the boundaries are padded, the window is always
+// full, and moving the window replaces the oldest values; a replacement restores the heap,
+// in which the value sits, and, if the tops of the two heaps are out of order, swaps them,
+// hence an update costs O(log k).
+typedef struct _ndimage_rank_window_t {
+    size_t k;
+    size_t nlow;
+    mp_float_t *value;
+    uint8_t **source;
+    // heap[0..nlow) is the max-heap, heap[nlow..k) the min-heap, and pos is the inverse of heap
+    size_t *heap;
+    size_t *pos;
+} ndimage_rank_window_t;
+
+static void ndimage_heap_swap(ndimage_rank_window_t *w, size_t a, size_t b) {
+    size_t tmp = w->heap[a];
+    w->heap[a] = w->heap[b];
+    w->heap[b] = tmp;
+    w->pos[w->heap[a]] = a;
+    w->pos[w->heap[b]] = b;
+}
+
+static bool ndimage_heap_above(ndimage_rank_window_t *w, size_t a, size_t b, bool low) {
+    // true, if the entry at a belongs above the entry at b
+    mp_float_t va = w->value[w->heap[a]];
+    mp_float_t vb = w->value[w->heap[b]];
+    return low ? va > vb : va < vb;
+}
+
+static void ndimage_heap_sift_up(ndimage_rank_window_t *w, size_t i, bool low) {
+    size_t base = low ? 0 : w->nlow;
+    while(i > base) {
+        size_t parent = base + (i - base - 1) / 2;
+        if(!ndimage_heap_above(w, i, parent, low)) {
+            break;
+        }
+        ndimage_heap_swap(w, i, parent);
+        i = parent;
+    }
+}
+
+static void ndimage_heap_sift_down(ndimage_rank_window_t *w, size_t i, bool low) {
+    size_t base = low ? 0 : w->nlow;
+    size_t end = low ? w->nlow : w->k;
+    while(1) {
+        size_t child = base + 2 * (i - base) + 1;
+        if(child >= end) {
+            break;
+        }
+        if((child + 1 < end) && ndimage_heap_above(w, child + 1, child, low)) {
+            child++;
+        }
+        if(!ndimage_heap_above(w, child, i, low)) {
+            break;
+        }
+        ndimage_heap_swap(w, i, child);
+        i = child;
+    }
+}
+
+static void ndimage_heap_balance(ndimage_rank_window_t *w) {
+    // moves the largest value of the max-heap, and the smallest value of the min-heap across,
+    // until the max-heap holds the smallest values
+    while((w->nlow < w->k) && (w->value[w->heap[0]] > w->value[w->heap[w->nlow]])) {
+        ndimage_heap_swap(w, 0, w->nlow);
+        ndimage_heap_sift_down(w, 0, true);
+        ndimage_heap_sift_down(w, w->nlow, false);
+    }
+}
+
+static void ndimage_rank_window_init(ndimage_rank_window_t *w) {
+    // builds the heaps from the values, which have been filled in, in arbitrary order
+    for(size_t i=0; i < w->k; i++) {
+        w->heap[i] = i;
+        w->pos[i] = i;
+    }
+    for(size_t i = w->nlow / 2; i-- > 0;) {
+        ndimage_heap_sift_down(w, i, true);
+    }
+    for(size_t i = (w->k - w->nlow) / 2; i-- > 0;) {
+        ndimage_heap_sift_down(w, w->nlow + i, false);
+    }
+    ndimage_heap_balance(w);
+}
+
+static void ndimage_rank_window_replace(ndimage_rank_window_t *w, size_t slot, mp_float_t value, uint8_t *source) {
+    w->value[slot] = value;
+    w->source[slot] = source;
+    size_t i = w->pos[slot];
+    bool low = i < w->nlow;
+    ndimage_heap_sift_up(w, i, low);
+    ndimage_heap_sift_down(w, w->pos[slot], low);
+    ndimage_heap_balance(w);
+}
+
+void ndimage_filter_size(mp_obj_t arg, ndarray_obj_t *input, size_t *size) {
+    // size is either an integer, or a tuple with an entry for each axis of the input;
+    // size[0] is the extent of the window along the rows, size[1] along the columns
+    size[0] = 1;
+    size[1] = 1;
+    if(mp_obj_is_int(arg)) {
+        mp_int_t k = mp_obj_get_int(arg);
+        if(k < 1) {
+            mp_raise_ValueError(translate("size must be positive"));
+        }
+        size[1] = (size_t)k;
+        if(input->ndim == 2) {
+            size[0] = (size_t)k;
+        }
+    } else {
+        if(!ndarray_object_is_array_like(arg) || ((uint8_t)mp_obj_get_int(mp_obj_len_maybe(arg)) != input->ndim)) {
+            mp_raise_ValueError(translate("size must be an integer, or a sequence with an entry for each axis"));
+        }
+        mp_obj_iter_buf_t iter_buf;
+        mp_obj_t item, iterable = mp_getiter(arg, &iter_buf);
+        uint8_t axis = 2 - input->ndim;
+        while((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+            mp_int_t k = mp_obj_get_int(item);
+            if(k < 1) {
+                mp_raise_ValueError(translate("size must be positive"));
+            }
+            size[axis++] = (size_t)k;
+        }
+    }
+}
+
+ndarray_obj_t *ndimage_rank_filter_array(ndarray_obj_t *input, size_t *size, mp_int_t rank, uint8_t mode, mp_float_t cval) {
+    // returns the rank-th smallest value of the size[0] x size[1] window around each element
+    // of the one-, or two-dimensional input; the output has the dtype of the input, and each of
+    // its elements is copied from the input, or from the constant
+    #if ULAB_SUPPORTS_COMPLEX
+    if(input->dtype == NDARRAY_COMPLEX) {
+        mp_raise_TypeError(translate("input must be real"));
+    }
+    #endif
+    if((input->ndim < 1) || (input->ndim > 2)) {
+        mp_raise_ValueError(translate("input must be one-, or two-dimensional"));
+    }
+    size_t k = size[0] * size[1];
+    if(rank < 0) {
+        rank += (mp_int_t)k;
+    }
+    if((rank < 0) || ((size_t)rank >= k)) {
+        mp_raise_ValueError(translate("rank is out of range"));
+    }
+
+    ndarray_obj_t *output = ndarray_new_dense_ndarray(input->ndim, input->shape, input->dtype);
+    if(output->len == 0) {
+        return output;
+    }
+    size_t rows = 1, cols = input->shape[ULAB_MAX_DIMS - 1];
+    int32_t rstride = 0, cstride = input->strides[ULAB_MAX_DIMS - 1];
+    #if ULAB_MAX_DIMS > 1
+    if(input->ndim == 2) {
+        rows = input->shape[ULAB_MAX_DIMS - 2];
+        rstride = input->strides[ULAB_MAX_DIMS - 2];
+    }
+    #endif
+
+    // the constant of the boundary in the dtype of the input
+    ndarray_obj_t *constant = ndarray_new_linear_array(1, input->dtype);
+    if(input->dtype == NDARRAY_FLOAT) {
+        *((mp_float_t *)constant->array) = cval;
+    } else {
+        mp_binary_set_val_array(input->dtype, constant->array, 0, mp_obj_new_int((mp_int_t)cval));
+    }
+    mp_float_t (*func)(void *) = ndarray_get_float_function(input->dtype);
+    mp_float_t cvalue = func(constant->array);
+
+    ndimage_rank_window_t w;
+    w.k = k;
+    w.nlow = (size_t)rank + 1;
+    w.value = m_new(mp_float_t, k);
+    w.source = m_new(uint8_t *, k);
+    w.heap = m_new(size_t, k);
+    w.pos = m_new(size_t, k);
+
+    // the row, and column indices of the window, which are mapped back into the input
+    size_t *rindex = m_new(size_t, size[0]);
+    int32_t roffset = (int32_t)(size[0] / 2), coffset = (int32_t)(size[1] / 2);
+
+    uint8_t *array = (uint8_t *)input->array;
+    uint8_t *oarray = (uint8_t *)output->array;
+    for(size_t r=0; r < rows; r++) {
+        for(size_t i=0; i < size[0]; i++) {
+            rindex[i] = ndimage_boundary_index((int32_t)(r + i) - roffset, rows, mode);
+        }
+        // the window of the first column is filled in column by column, and the slots of
+        // a column are consecutive, so that a new column replaces the oldest one
+        for(size_t j=0; j < size[1]; j++) {
+            size_t c = ndimage_boundary_index((int32_t)j - coffset, cols, mode);
+            for(size_t i=0; i < size[0]; i++) {
+                size_t slot = j * size[0] + i;
+                if((rindex[i] == rows) || (c == cols)) {
+                    w.value[slot] = cvalue;
+                    w.source[slot] = (uint8_t *)constant->array;
+                } else {
+                    w.source[slot] = array + rindex[i] * rstride + c * cstride;
+                    w.value[slot] = func(w.source[slot]);
+                }
+            }
+        }
+        ndimage_rank_window_init(&w);
+        memcpy(oarray, w.source[w.heap[0]], input->itemsize);
+        oarray += output->itemsize;
+
+        size_t oldest = 0;
+        for(size_t col=1; col < cols; col++) {
+            size_t c = ndimage_boundary_index((int32_t)(col + size[1] - 1) - coffset, cols, mode);
+            for(size_t i=0; i < size[0]; i++) {
+                size_t slot = oldest * size[0] + i;
+                if((rindex[i] == rows) || (c == cols)) {
+                    ndimage_rank_window_replace(&w, slot, cvalue, (uint8_t *)constant->array);
+                } else {
+                    uint8_t *source = array + rindex[i] * rstride + c * cstride;
+                    ndimage_rank_window_replace(&w, slot, func(source), source);
+                }
+            }
+            oldest = oldest + 1 == size[1] ? 0 : oldest + 1;
+            memcpy(oarray, w.source[w.heap[0]], input->itemsize);
+            oarray += output->itemsize;
+        }
+    }
+
+    m_del(size_t, rindex, size[0]);
+    m_del(mp_float_t, w.value, k);
+    m_del(uint8_t *, w.source, k);
+    m_del(size_t, w.heap, k);
+    m_del(size_t, w.pos, k);
+    return output;
+}
+#endif /* NDIMAGE_HAS_RANK_FILTER */
+
+#if NDIMAGE_HAS_CORRELATE
+// The correlation keeps a ring of the kernel-height most recent rows of the input, which are
+// padded according to the boundary mode, so that a new row is loaded for each output row.
+// If the weights are the outer product of a column, and a row, each row is filtered by the
+// row, when it is loaded, and the ring holds the filtered rows, hence an output costs
+// kr + kc, instead of kr * kc multiplications. 8-, and 16-bit input is accumulated in
+// integers, if the weights and the constant of the boundary are integers.
+
+static void ndimage_load_row_float(mp_float_t *dst, uint8_t *row, int32_t stride, const size_t *colmap, size_t n,
+                                    size_t cols, mp_float_t cval, mp_float_t (*func)(void *)) {
+    // row is NULL, if the row lies beyond the boundary in constant mode
+    for(size_t t=0; t < n; t++) {
+        dst[t] = ((row == NULL) || (colmap[t] == cols)) ? cval : func(row + colmap[t] * stride);
+    }
+}
+
+#define NDIMAGE_LOAD_ROW_INT(type)\
+({\
+    for(size_t t=0; t < n; t++) {\
+        dst[t] = ((row == NULL) || (colmap[t] == cols)) ? cval : (int32_t)*((type *)(row + colmap[t] * stride));\
+    }\
+})
+
+static void ndimage_load_row_int(int32_t *dst, uint8_t *row, int32_t stride, const size_t *colmap, size_t n,
+                                    size_t cols, int32_t cval, uint8_t dtype) {
+    if(dtype == NDARRAY_UINT8) {
+        NDIMAGE_LOAD_ROW_INT(uint8_t);
+    } else if(dtype == NDARRAY_INT8) {
+        NDIMAGE_LOAD_ROW_INT(int8_t);
+    } else if(dtype == NDARRAY_UINT16) {
+        NDIMAGE_LOAD_ROW_INT(uint16_t);
+    } else {
+        NDIMAGE_LOAD_ROW_INT(int16_t);
+    }
+}
+
+static void ndimage_store_int(uint8_t *p, uint8_t dtype, int64_t value) {
+    // integer outputs saturate
+    #define NDIMAGE_STORE(type, min, max) *((type *)p) = (type)(value < (min) ? (min) : (value > (max) ? (max) : value))
+    if(dtype == NDARRAY_FLOAT) {
+        *((mp_float_t *)p) = (mp_float_t)value;
+    } else if(dtype == NDARRAY_UINT8) {
+        NDIMAGE_STORE(uint8_t, 0, UINT8_MAX);
+    } else if(dtype == NDARRAY_INT8) {
+        NDIMAGE_STORE(int8_t, INT8_MIN, INT8_MAX);
+    } else if(dtype == NDARRAY_UINT16) {
+        NDIMAGE_STORE(uint16_t, 0, UINT16_MAX);
+    } else if(dtype == NDARRAY_INT16) {
+        NDIMAGE_STORE(int16_t, INT16_MIN, INT16_MAX);
+    } else if(dtype == NDARRAY_UINT32) {
+        NDIMAGE_STORE(uint32_t, 0, UINT32_MAX);
+    } else if(dtype == NDARRAY_INT32) {
+        NDIMAGE_STORE(int32_t, INT32_MIN, INT32_MAX);
+    } else {
+        *((int64_t *)p) = value;
+    }
+    #undef NDIMAGE_STORE
+}
+
+static void ndimage_store_float(uint8_t *p, uint8_t dtype, mp_float_t value) {
+    // float results are rounded to the nearest integer, if the output is an integer type
+    if(dtype == NDARRAY_FLOAT) {
+        *((mp_float_t *)p) = value;
+        return;
+    }
+    mp_float_t limit = MICROPY_FLOAT_CONST(9.2e18);
+    value = MICROPY_FLOAT_C_FUN(round)(value);
+    ndimage_store_int(p, dtype, value < -limit ? INT64_MIN : (value > limit ? INT64_MAX : (int64_t)value));
+}
+
+static bool ndimage_separable(const mp_float_t *w, size_t kr, size_t kc, size_t *p, size_t *q, bool exact) {
+    // checks, whether w is of rank 1, and returns the indices of its largest entry in p, and q,
+    // whose row, and column are then the factors of w up to the scaling by w[p, q]
+    mp_float_t max = MICROPY_FLOAT_CONST(0.0);
+    *p = 0;
+    *q = 0;
+    for(size_t i=0; i < kr; i++) {
+        for(size_t j=0; j < kc; j++) {
+            if(MICROPY_FLOAT_C_FUN(fabs)(w[i * kc + j]) > max) {
+                max = MICROPY_FLOAT_C_FUN(fabs)(w[i * kc + j]);
+                *p = i;
+                *q = j;
+            }
+        }
+    }
+    if((kr == 1) || (kc == 1) || (max == MICROPY_FLOAT_CONST(0.0))) {
+        return false;
+    }
+    mp_float_t pivot = w[*p * kc + *q];
+    for(size_t i=0; i < kr; i++) {
+        for(size_t j=0; j < kc; j++) {
+            if(exact) {
+                int64_t d = (int64_t)w[i * kc + j] * (int64_t)pivot - (int64_t)w[i * kc + *q] * (int64_t)w[*p * kc + j];
+                if(d != 0) {
+                    return false;
+                }
+            } else {
+                mp_float_t d = w[i * kc + j] * pivot - w[i * kc + *q] * w[*p * kc + j];
+                if(MICROPY_FLOAT_C_FUN(fabs)(d) > NDIMAGE_EPSILON * max * max * (mp_float_t)(kr * kc)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+ndarray_obj_t *ndimage_correlate_array(ndarray_obj_t *input, ndarray_obj_t *weights, bool flip, size_t orows, size_t ocols,
+                                        int32_t rstart, int32_t cstart, uint8_t mode, mp_float_t cval, uint8_t dtype) {
+    // correlates the one-, or two-dimensional input with the weights of the same dimension; the output has
+    // orows x ocols elements, and the window of the output at (i, j) starts at (rstart + i, cstart + j)
+    // in the input; if flip is true, the weights are reversed along both axes, i.e., this is a convolution
+    #if ULAB_SUPPORTS_COMPLEX
+    if((input->dtype == NDARRAY_COMPLEX) || (weights->dtype == NDARRAY_COMPLEX) || (dtype == NDARRAY_COMPLEX)) {
+        mp_raise_TypeError(translate("input must be real"));
+    }
+    #endif
+    if((input->ndim < 1) || (input->ndim > 2)) {
+        mp_raise_ValueError(translate("input must be one-, or two-dimensional"));
+    }
+    if(weights->ndim != input->ndim) {
+        mp_raise_ValueError(translate("weights must have the dimension of the input"));
+    }
+
+    size_t rows = 1, cols = input->shape[ULAB_MAX_DIMS - 1];
+    size_t kr = 1, kc = weights->shape[ULAB_MAX_DIMS - 1];
+    int32_t rstride = 0, cstride = input->strides[ULAB_MAX_DIMS - 1];
+    int32_t wrstride = 0;
+    #if ULAB_MAX_DIMS > 1
+    if(input->ndim == 2) {
+        rows = input->shape[ULAB_MAX_DIMS - 2];
+        rstride = input->strides[ULAB_MAX_DIMS - 2];
+        kr = weights->shape[ULAB_MAX_DIMS - 2];
+        wrstride = weights->strides[ULAB_MAX_DIMS - 2];
+    }
+    #endif
+
+    size_t shape[ULAB_MAX_DIMS];
+    memset(shape, 0, ULAB_MAX_DIMS * sizeof(size_t));
+    shape[ULAB_MAX_DIMS - 1] = ocols;
+    #if ULAB_MAX_DIMS > 1
+    if(input->ndim == 2) {
+        shape[ULAB_MAX_DIMS - 2] = orows;
+    }
+    #endif
+    ndarray_obj_t *output = ndarray_new_dense_ndarray(input->ndim, shape, dtype);
+    if((output->len == 0) || (kr * kc == 0) || (input->len == 0)) {
+        return output;
+    }
+
+    // the weights are copied into a dense kr x kc array
+    size_t kn = kr * kc;
+    mp_float_t *w = m_new(mp_float_t, kn);
+    mp_float_t (*wfunc)(void *) = ndarray_get_float_function(weights->dtype);
+    uint8_t *warray = (uint8_t *)weights->array;
+    bool integral = MICROPY_FLOAT_C_FUN(floor)(cval) == cval;
+    mp_float_t wsum = MICROPY_FLOAT_CONST(0.0);
+    for(size_t i=0; i < kr; i++) {
+        for(size_t j=0; j < kc; j++) {
+            mp_float_t value = wfunc(warray + i * wrstride + j * weights->strides[ULAB_MAX_DIMS - 1]);
+            w[flip ? kn - 1 - (i * kc + j) : i * kc + j] = value;
+            integral = integral && (MICROPY_FLOAT_C_FUN(floor)(value) == value);
+            wsum += MICROPY_FLOAT_C_FUN(fabs)(value);
+        }
+    }
+    // the integer accumulator must not overflow, even if all values of the window are at the extremes
+    mp_float_t vmax = MICROPY_FLOAT_C_FUN(fabs)(cval);
+    if((input->dtype == NDARRAY_UINT8) || (input->dtype == NDARRAY_INT8)) {
+        vmax = MAX(vmax, MICROPY_FLOAT_CONST(255.0));
+    } else if((input->dtype == NDARRAY_UINT16) || (input->dtype == NDARRAY_INT16)) {
+        vmax = MAX(vmax, MICROPY_FLOAT_CONST(65535.0));
+    } else {
+        integral = false;
+    }
+    integral = integral && (wsum * vmax < MICROPY_FLOAT_CONST(2147483647.0));
+
+    size_t p, q;
+    bool separable = ndimage_separable(w, kr, kc, &p, &q, integral);
+
+    // colmap maps the columns of the padded rows onto the columns of the input, or to cols for the constant
+    size_t prow = ocols + kc - 1;
+    size_t *colmap = m_new(size_t, prow);
+    for(size_t t=0; t < prow; t++) {
+        colmap[t] = ndimage_boundary_index(cstart + (int32_t)t, cols, mode);
+    }
+    // the ring holds kr rows, either padded, or filtered
+    size_t width = separable ? ocols : prow;
+    uint8_t *array = (uint8_t *)input->array;
+    uint8_t *oarray = (uint8_t *)output->array;
+    mp_float_t (*func)(void *) = ndarray_get_float_function(input->dtype);
+
+    if(integral) {
+        int32_t *iw = m_new(int32_t, kn);
+        for(size_t i=0; i < kn; i++) {
+            iw[i] = (int32_t)w[i];
+        }
+        int32_t pivot = iw[p * kc + q];
+        int32_t *ring = m_new(int32_t, kr * width);
+        int32_t *padded = separable ? m_new(int32_t, prow) : NULL;
+        for(size_t i=0; i < orows; i++) {
+            // loads the rows, which are not in the ring yet
+            for(size_t a = i == 0 ? 0 : kr - 1; a < kr; a++) {
+                size_t r = ndimage_boundary_index(rstart + (int32_t)(i + a), rows, mode);
+                uint8_t *row = r == rows ? NULL : array + r * rstride;
+                int32_t *slot = ring + ((i + a) % kr) * width;
+                if(separable) {
+                    ndimage_load_row_int(padded, row, cstride, colmap, prow, cols, (int32_t)cval, input->dtype);
+                    for(size_t j=0; j < ocols; j++) {
+                        int32_t acc = 0;
+                        for(size_t b=0; b < kc; b++) {
+                            acc += iw[p * kc + b] * padded[j + b];
+                        }
+                        slot[j] = acc;
+                    }
+                } else {
+                    ndimage_load_row_int(slot, row, cstride, colmap, prow, cols, (int32_t)cval, input->dtype);
+                }
+            }
+            for(size_t j=0; j < ocols; j++) {
+                if(separable) {
+                    int64_t acc = 0;
+                    for(size_t a=0; a < kr; a++) {
+                        acc += (int64_t)iw[a * kc + q] * ring[((i + a) % kr) * width + j];
+                    }
+                    ndimage_store_int(oarray, dtype, acc / pivot);
+                } else {
+                    int32_t acc = 0;
+                    for(size_t a=0; a < kr; a++) {
+                        int32_t *slot = ring + ((i + a) % kr) * width + j;
+                        int32_t *wa = iw + a * kc;
+                        for(size_t b=0; b < kc; b++) {
+                            acc += wa[b] * slot[b];
+                        }
+                    }
+                    ndimage_store_int(oarray, dtype, acc);
+                }
+                oarray += output->itemsize;
+            }
+        }
+        m_del(int32_t, iw, kn);
+        m_del(int32_t, ring, kr * width);
+        if(separable) {
+            m_del(int32_t, padded, prow);
+        }
+    } else {
+        // the row is normalised, so that the column carries the scale
+        mp_float_t pivot = w[p * kc + q];
+        if(separable) {
+            for(size_t b=0; b < kc; b++) {
+                w[p * kc + b] /= pivot;
+            }
+        }
+        mp_float_t *ring = m_new(mp_float_t, kr * width);
+        mp_float_t *padded = separable ? m_new(mp_float_t, prow) : NULL;
+        for(size_t i=0; i < orows; i++) {
+            for(size_t a = i == 0 ? 0 : kr - 1; a < kr; a++) {
+                size_t r = ndimage_boundary_index(rstart + (int32_t)(i + a), rows, mode);
+                uint8_t *row = r == rows ? NULL : array + r * rstride;
+                mp_float_t *slot = ring + ((i + a) % kr) * width;
+                if(separable) {
+                    ndimage_load_row_float(padded, row, cstride, colmap, prow, cols, cval, func);
+                    for(size_t j=0; j < ocols; j++) {
+                        mp_float_t acc = MICROPY_FLOAT_CONST(0.0);
+                        for(size_t b=0; b < kc; b++) {
+                            acc += w[p * kc + b] * padded[j + b];
+                        }
+                        slot[j] = acc;
+                    }
+                } else {
+                    ndimage_load_row_float(slot, row, cstride, colmap, prow, cols, cval, func);
+                }
+            }
+            for(size_t j=0; j < ocols; j++) {
+                mp_float_t acc = MICROPY_FLOAT_CONST(0.0);
+                if(separable) {
+                    for(size_t a=0; a < kr; a++) {
+                        acc += (a == p ? pivot : w[a * kc + q]) * ring[((i + a) % kr) * width + j];
+                    }
+                } else {
+                    for(size_t a=0; a < kr; a++) {
+                        mp_float_t *slot = ring + ((i + a) % kr) * width + j;
+                        mp_float_t *wa = w + a * kc;
+                        for(size_t b=0; b < kc; b++) {
+                            acc += wa[b] * slot[b];
+                        }
+                    }
+                }
+                ndimage_store_float(oarray, dtype, acc);
+                oarray += output->itemsize;
+            }
+        }
+        m_del(mp_float_t, ring, kr * width);
+        if(separable) {
+            m_del(mp_float_t, padded, prow);
+        }
+    }
+    m_del(size_t, colmap, prow);
+    m_del(mp_float_t, w, kn);
+    return output;
+}
+uint8_t ndimage_output_dtype(mp_obj_t arg) {
+    // the requested dtype of an output, either a dtype object, or one of the integer constants
+    uint8_t dtype;
+    #if ULAB_HAS_DTYPE_OBJECT
+    if(mp_obj_is_type(arg, &ulab_dtype_type)) {
+        dtype_obj_t *dtype_obj = MP_OBJ_TO_PTR(arg);
+        dtype = dtype_obj->dtype;
+    } else {
+        dtype = mp_obj_get_int(arg);
+    }
+    #else
+    dtype = mp_obj_get_int(arg);
+    #endif
+    if((dtype != NDARRAY_UINT8) && (dtype != NDARRAY_INT8) && (dtype != NDARRAY_UINT16) && (dtype != NDARRAY_INT16) &&
+        (dtype != NDARRAY_UINT32) && (dtype != NDARRAY_INT32) && (dtype != NDARRAY_INT64) && (dtype != NDARRAY_FLOAT)) {
+        mp_raise_TypeError(translate("output must be a real dtype"));
+    }
+    return dtype;
+}
+#endif /* NDIMAGE_HAS_CORRELATE */
+
+#if ULAB_SCIPY_NDIMAGE_HAS_CONVOLVE || ULAB_SCIPY_NDIMAGE_HAS_CORRELATE ||\
+    ULAB_SCIPY_NDIMAGE_HAS_MEDIAN_FILTER || ULAB_SCIPY_NDIMAGE_HAS_RANK_FILTER
+static uint8_t ndimage_mode(mp_obj_t arg) {
+    if(!mp_obj_is_str(arg)) {
+        mp_raise_TypeError(translate("mode must be a string"));
+    }
+    qstr mode = mp_obj_str_get_qstr(arg);
+    if(mode == MP_QSTR_reflect) {
+        return NDIMAGE_MODE_REFLECT;
+    } else if(mode == MP_QSTR_constant) {
+        return NDIMAGE_MODE_CONSTANT;
+    } else if(mode == MP_QSTR_nearest) {
+        return NDIMAGE_MODE_NEAREST;
+    } else if(mode == MP_QSTR_mirror) {
+        return NDIMAGE_MODE_MIRROR;
+    } else if(mode == MP_QSTR_wrap) {
+        return NDIMAGE_MODE_WRAP;
+    }
+    mp_raise_ValueError(translate("mode must be one of 'reflect', 'constant', 'nearest', 'mirror', or 'wrap'"));
+}
+
+static ndarray_obj_t *ndimage_filter_input(mp_obj_t arg) {
+    if(!mp_obj_is_type(arg, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("input must be an ndarray"));
+    }
+    return MP_OBJ_TO_PTR(arg);
+}
+#endif
+
+#if ULAB_SCIPY_NDIMAGE_HAS_CONVOLVE || ULAB_SCIPY_NDIMAGE_HAS_CORRELATE
+static mp_obj_t ndimage_correlate_arg(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, bool flip) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_input, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_weights, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_output, MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_mode, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_reflect) } },
+        { MP_QSTR_cval, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_INT(0) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *input = ndimage_filter_input(args[0].u_obj);
+    ndarray_obj_t *weights = ndimage_filter_input(args[1].u_obj);
+    uint8_t dtype = args[2].u_obj == mp_const_none ? input->dtype : ndimage_output_dtype(args[2].u_obj);
+    uint8_t mode = ndimage_mode(args[3].u_obj);
+
+    // the window is centred on the output, and for even sizes, the centre of the convolution
+    // is shifted to the left with respect to that of the correlation
+    size_t rows = 1, kr = 1;
+    #if ULAB_MAX_DIMS > 1
+    if(input->ndim == 2) {
+        rows = input->shape[ULAB_MAX_DIMS - 2];
+        kr = weights->shape[ULAB_MAX_DIMS - 2];
+    }
+    #endif
+    size_t kc = weights->shape[ULAB_MAX_DIMS - 1];
+    int32_t rstart = flip ? -(int32_t)((kr - 1) / 2) : -(int32_t)(kr / 2);
+    int32_t cstart = flip ? -(int32_t)((kc - 1) / 2) : -(int32_t)(kc / 2);
+    ndarray_obj_t *output = ndimage_correlate_array(input, weights, flip, rows, input->shape[ULAB_MAX_DIMS - 1],
+                                                    rstart, cstart, mode, mp_obj_get_float(args[4].u_obj), dtype);
+    return MP_OBJ_FROM_PTR(output);
+}
+#endif
+
+#if ULAB_SCIPY_NDIMAGE_HAS_CONVOLVE
+//| def convolve(input: ulab.ndarray, weights: ulab.ndarray, output: Optional[_DType] = None, mode: str = 'reflect', cval: float = 0.0) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray input: A one-, or two-dimensional array
+//|     :param ulab.ndarray weights: The kernel, with the same number of dimensions as the input
+//|     :param output: The dtype of the result; by default, that of the input
+//|     :param str mode: The boundary condition, one of 'reflect', 'constant', 'nearest', 'mirror', or 'wrap'
+//|     :param float cval: The value beyond the boundaries with mode='constant'
+//|
+//|     Return the convolution of the input with the weights, centred on each element.
+//|     Weights that are the outer product of a column, and a row are applied as two
+//|     one-dimensional passes. If the input is an 8-, or 16-bit integer array, and the
+//|     weights, and cval are integers, the sums are computed in integers. Unlike in scipy,
+//|     results are rounded, and saturated, if the output is an integer type."""
+//|     ...
+//|
+
+mp_obj_t ndimage_convolve(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return ndimage_correlate_arg(n_args, pos_args, kw_args, true);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(ndimage_convolve_obj, 2, ndimage_convolve);
+#endif /* ULAB_SCIPY_NDIMAGE_HAS_CONVOLVE */
+
+#if ULAB_SCIPY_NDIMAGE_HAS_CORRELATE
+//| def correlate(input: ulab.ndarray, weights: ulab.ndarray, output: Optional[_DType] = None, mode: str = 'reflect', cval: float = 0.0) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray input: A one-, or two-dimensional array
+//|     :param ulab.ndarray weights: The kernel, with the same number of dimensions as the input
+//|     :param output: The dtype of the result; by default, that of the input
+//|     :param str mode: The boundary condition, one of 'reflect', 'constant', 'nearest', 'mirror', or 'wrap'
+//|     :param float cval: The value beyond the boundaries with mode='constant'
+//|
+//|     Return the correlation of the input with the weights, centred on each element.
+//|     The computation is the same as in convolve, but the weights are not reversed."""
+//|     ...
+//|
+
+mp_obj_t ndimage_correlate(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return ndimage_correlate_arg(n_args, pos_args, kw_args, false);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(ndimage_correlate_obj, 2, ndimage_correlate);
+#endif /* ULAB_SCIPY_NDIMAGE_HAS_CORRELATE */
+
+#if ULAB_SCIPY_NDIMAGE_HAS_MEDIAN_FILTER
+//| def median_filter(input: ulab.ndarray, size: Union[int, Tuple[int, ...]], *, mode: str = 'reflect', cval: float = 0.0) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray input: A one-, or two-dimensional array
+//|     :param size: The extent of the window, either the same for all axes, or one per axis
+//|     :param str mode: The boundary condition, one of 'reflect', 'constant', 'nearest', 'mirror', or 'wrap'
+//|     :param float cval: The value beyond the boundaries with mode='constant'
+//|
+//|     Return the median of the window around each element; for windows of even size, the
+//|     upper one of the two middle values. The result has the dtype of the input. The window
+//|     is updated incrementally, so that the cost of an output is proportional to the log of
+//|     its size, and the length of its leading axis."""
+//|     ...
+//|
+
+mp_obj_t ndimage_median_filter(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_input, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_size, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_mode, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_reflect) } },
+        { MP_QSTR_cval, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_INT(0) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *input = ndimage_filter_input(args[0].u_obj);
+    size_t size[2];
+    ndimage_filter_size(args[1].u_obj, input, size);
+    uint8_t mode = ndimage_mode(args[2].u_obj);
+    ndarray_obj_t *output = ndimage_rank_filter_array(input, size, (mp_int_t)(size[0] * size[1] / 2), mode, mp_obj_get_float(args[3].u_obj));
+    return MP_OBJ_FROM_PTR(output);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(ndimage_median_filter_obj, 2, ndimage_median_filter);
+#endif /* ULAB_SCIPY_NDIMAGE_HAS_MEDIAN_FILTER */
+
+#if ULAB_SCIPY_NDIMAGE_HAS_RANK_FILTER
+//| def rank_filter(input: ulab.ndarray, rank: int, size: Union[int, Tuple[int, ...]], *, mode: str = 'reflect', cval: float = 0.0) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray input: A one-, or two-dimensional array
+//|     :param int rank: The rank of the returned value in the window; negative values count from the largest
+//|     :param size: The extent of the window, either the same for all axes, or one per axis
+//|     :param str mode: The boundary condition, one of 'reflect', 'constant', 'nearest', 'mirror', or 'wrap'
+//|     :param float cval: The value beyond the boundaries with mode='constant'
+//|
+//|     Return the rank-th smallest value of the window around each element, e.g., rank=0
+//|     is a minimum, and rank=-1 a maximum filter. The result has the dtype of the input."""
+//|     ...
+//|
+
+mp_obj_t ndimage_rank_filter(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_input, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_rank, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0 } },
+        { MP_QSTR_size, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_mode, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_reflect) } },
+        { MP_QSTR_cval, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_INT(0) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *input = ndimage_filter_input(args[0].u_obj);
+    size_t size[2];
+    ndimage_filter_size(args[2].u_obj, input, size);
+    uint8_t mode = ndimage_mode(args[3].u_obj);
+    ndarray_obj_t *output = ndimage_rank_filter_array(input, size, args[1].u_int, mode, mp_obj_get_float(args[4].u_obj));
+    return MP_OBJ_FROM_PTR(output);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(ndimage_rank_filter_obj, 3, ndimage_rank_filter);
+#endif /* ULAB_SCIPY_NDIMAGE_HAS_RANK_FILTER */
+
+static const mp_rom_map_elem_t ulab_scipy_ndimage_globals_table[] = {
+    { MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_ndimage) },
+    #if ULAB_SCIPY_NDIMAGE_HAS_CONVOLVE
+        { MP_OBJ_NEW_QSTR(MP_QSTR_convolve), (mp_obj_t)&ndimage_convolve_obj },
+    #endif
+    #if ULAB_SCIPY_NDIMAGE_HAS_CORRELATE
+        { MP_OBJ_NEW_QSTR(MP_QSTR_correlate), (mp_obj_t)&ndimage_correlate_obj },
+    #endif
+    #if ULAB_SCIPY_NDIMAGE_HAS_MEDIAN_FILTER
+        { MP_OBJ_NEW_QSTR(MP_QSTR_median_filter), (mp_obj_t)&ndimage_median_filter_obj },
+    #endif
+    #if ULAB_SCIPY_NDIMAGE_HAS_RANK_FILTER
+        { MP_OBJ_NEW_QSTR(MP_QSTR_rank_filter), (mp_obj_t)&ndimage_rank_filter_obj },
+    #endif
+};
+
+static MP_DEFINE_CONST_DICT(mp_module_ulab_scipy_ndimage_globals, ulab_scipy_ndimage_globals_table);
+
+mp_obj_module_t ulab_scipy_ndimage_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&mp_module_ulab_scipy_ndimage_globals,
+};
@@ -0,0 +1,55 @@
+
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+*/
+
+#ifndef _SCIPY_NDIMAGE_
+#define _SCIPY_NDIMAGE_
+
+#include "../../ulab.h"
+#include "../../ndarray.h"
+
+extern mp_obj_module_t ulab_scipy_ndimage_module;
+
+// the rank filter is shared by median_filter, rank_filter, and scipy.signal.medfilt
+#define NDIMAGE_HAS_RANK_FILTER (ULAB_SCIPY_NDIMAGE_HAS_MEDIAN_FILTER || ULAB_SCIPY_NDIMAGE_HAS_RANK_FILTER ||\
+                                ULAB_SCIPY_SIGNAL_HAS_MEDFILT)
+
+// the correlation is shared by convolve, correlate, and scipy.signal.convolve2d
+#define NDIMAGE_HAS_CORRELATE   (ULAB_SCIPY_NDIMAGE_HAS_CONVOLVE || ULAB_SCIPY_NDIMAGE_HAS_CORRELATE ||\
+                                ULAB_SCIPY_SIGNAL_HAS_CONVOLVE2D)
+
+#define NDIMAGE_EPSILON         MICROPY_FLOAT_CONST(1.2e-7)
+
+// the boundary conditions of scipy.ndimage
+enum NDIMAGE_MODE {
+    NDIMAGE_MODE_REFLECT,
+    NDIMAGE_MODE_CONSTANT,
+    NDIMAGE_MODE_NEAREST,
+    NDIMAGE_MODE_MIRROR,
+    NDIMAGE_MODE_WRAP,
+};
+
+#if NDIMAGE_HAS_RANK_FILTER
+void ndimage_filter_size(mp_obj_t , ndarray_obj_t *, size_t *);
+ndarray_obj_t *ndimage_rank_filter_array(ndarray_obj_t *, size_t *, mp_int_t , uint8_t , mp_float_t );
+#endif
+
+#if NDIMAGE_HAS_CORRELATE
+uint8_t ndimage_output_dtype(mp_obj_t );
+ndarray_obj_t *ndimage_correlate_array(ndarray_obj_t *, ndarray_obj_t *, bool , size_t , size_t , int32_t , int32_t , uint8_t , mp_float_t , uint8_t );
+#endif
+
+MP_DECLARE_CONST_FUN_OBJ_KW(ndimage_convolve_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(ndimage_correlate_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(ndimage_median_filter_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(ndimage_rank_filter_obj);
+
+#endif /* _SCIPY_NDIMAGE_ */
@@ -16,6 +16,7 @@
 #include "py/runtime.h"
 
 #include "../ulab.h"
+#include "ndimage/ndimage.h"
 #include "optimize/optimize.h"
 #include "signal/signal.h"
 #include "special/special.h"
@@ -30,6 +31,9 @@ static const mp_rom_map_elem_t ulab_scipy_globals_table[] = {
     #if ULAB_SCIPY_HAS_LINALG_MODULE
         { MP_ROM_QSTR(MP_QSTR_linalg), MP_ROM_PTR(&ulab_scipy_linalg_module) },
     #endif
+    #if ULAB_SCIPY_HAS_NDIMAGE_MODULE
+        { MP_ROM_QSTR(MP_QSTR_ndimage), MP_ROM_PTR(&ulab_scipy_ndimage_module) },
+    #endif
     #if ULAB_SCIPY_HAS_OPTIMIZE_MODULE
         { MP_ROM_QSTR(MP_QSTR_optimize), MP_ROM_PTR(&ulab_scipy_optimize_module) },
     #endif
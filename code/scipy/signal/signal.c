@@ -18,131 +18,3522 @@
 
 #include "../../ulab.h"
 #include "../../ndarray.h"
+#include "../../ulab_tools.h"
 #include "../../numpy/fft/fft_tools.h"
+#include "../../numpy/window/window.h"
+#include "../ndimage/ndimage.h"
+#include "signal.h"
+
+#if SIGNAL_HAS_STFT
+static bool signal_stft_window_is_named(mp_obj_t arg) {
+    // a window is given either by its name, or by a (name, parameter) tuple, or explicitly
+    if(mp_obj_is_type(arg, &mp_type_tuple)) {
+        mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(arg);
+        return (tuple->len > 0) && mp_obj_is_str(tuple->items[0]);
+    }
+    return mp_obj_is_str(arg);
+}
+
+static void signal_stft_window(mp_float_t *window, size_t n, mp_obj_t arg) {
+    // the named windows are periodic, as in scipy.signal.get_window(..., fftbins=True),
+    // and are taken from the cache of the windows
+    if(signal_stft_window_is_named(arg)) {
+        ndarray_obj_t *ndarray = window_get(arg, n, true);
+        memcpy(window, ndarray->array, n * sizeof(mp_float_t));
+    } else {
+        fill_array_iterable(window, arg);
+    }
+}
+
+static void signal_stft_init(signal_stft_t *stft, size_t nperseg, mp_obj_t arg_noverlap, mp_float_t fs, mp_obj_t arg_window,
+                            mp_obj_t arg_scaling, mp_obj_t arg_detrend, mp_obj_t arg_plan, bool twosided) {
+    // the arguments are checked before anything is allocated
+    stft->nperseg = nperseg;
+    if(arg_noverlap == mp_const_none) {
+        stft->noverlap = nperseg / 8;
+    } else {
+        mp_int_t noverlap = mp_obj_get_int(arg_noverlap);
+        if((noverlap < 0) || ((size_t)noverlap >= nperseg)) {
+            mp_raise_ValueError(translate("noverlap must be less than nperseg"));
+        }
+        stft->noverlap = (size_t)noverlap;
+    }
+
+    if(!signal_stft_window_is_named(arg_window) && (!ndarray_object_is_array_like(arg_window) ||
+        ((size_t)mp_obj_get_int(mp_obj_len(arg_window)) != nperseg))) {
+        mp_raise_ValueError(translate("window must be a name, a (name, parameter) tuple, or an iterable of length nperseg"));
+    }
+
+    bool density = true;
+    if(mp_obj_is_str(arg_scaling) && (mp_obj_str_get_qstr(arg_scaling) == MP_QSTR_spectrum)) {
+        density = false;
+    } else if(!mp_obj_is_str(arg_scaling) || (mp_obj_str_get_qstr(arg_scaling) != MP_QSTR_density)) {
+        mp_raise_ValueError(translate("scaling must be 'density', or 'spectrum'"));
+    }
+
+    if((arg_detrend == mp_const_none) || (arg_detrend == mp_const_false)) {
+        stft->detrend = false;
+    } else if(mp_obj_is_str(arg_detrend) && (mp_obj_str_get_qstr(arg_detrend) == MP_QSTR_constant)) {
+        stft->detrend = true;
+    } else {
+        mp_raise_ValueError(translate("detrend must be 'constant', or None"));
+    }
+
+    fft_check_length(nperseg);
+    fft_check_plan(arg_plan, nperseg);
+
+    stft->window = m_new(mp_float_t, nperseg);
+    signal_stft_window(stft->window, nperseg, arg_window);
+    mp_float_t sum = MICROPY_FLOAT_CONST(0.0), sum2 = MICROPY_FLOAT_CONST(0.0);
+    for(size_t i=0; i < nperseg; i++) {
+        sum += stft->window[i];
+        sum2 += stft->window[i] * stft->window[i];
+    }
+    stft->scale = density ? MICROPY_FLOAT_CONST(1.0) / (fs * sum2) : MICROPY_FLOAT_CONST(1.0) / (sum * sum);
+
+    // all segments are transformed with the same plan
+    if(arg_plan == mp_const_none) {
+        stft->plan = m_new_obj(fft_plan_obj_t);
+        fft_plan_init(stft->plan, nperseg, true);
+        stft->own_plan = true;
+    } else {
+        stft->plan = MP_OBJ_TO_PTR(arg_plan);
+        stft->own_plan = false;
+    }
+
+    stft->twosided = twosided;
+    if(twosided) {
+        stft->nfreq = nperseg;
+        stft->segment = m_new(mp_float_t, 2 * nperseg);
+    } else {
+        // real segments are transformed via the real transform, whose arrays hold nperseg/2 + 1 bins
+        stft->nfreq = nperseg / 2 + 1;
+        stft->segment = m_new(mp_float_t, nperseg);
+    }
+    stft->real = m_new(mp_float_t, 2 * stft->nfreq);
+    stft->imag = stft->real + stft->nfreq;
+}
+
+static void signal_stft_free(signal_stft_t *stft) {
+    m_del(mp_float_t, stft->window, stft->nperseg);
+    m_del(mp_float_t, stft->segment, stft->twosided ? 2 * stft->nperseg : stft->nperseg);
+    m_del(mp_float_t, stft->real, 2 * stft->nfreq);
+    if(stft->own_plan) {
+        fft_plan_free(stft->plan);
+        m_del_obj(fft_plan_obj_t, stft->plan);
+    }
+}
+
+static void signal_stft_transform(signal_stft_t *stft, mp_float_t *segment, mp_float_t *real, mp_float_t *imag) {
+    // removes the mean, applies the window, and transforms the samples of the segment;
+    // the nfreq bins of the transform are written into real, and imag
+    size_t n = stft->nperseg;
+    mp_float_t mean_re = MICROPY_FLOAT_CONST(0.0), mean_im = MICROPY_FLOAT_CONST(0.0);
+    if(stft->detrend) {
+        for(size_t i=0; i < n; i++) {
+            mean_re += segment[i];
+        }
+        mean_re /= n;
+        if(stft->twosided) {
+            for(size_t i=0; i < n; i++) {
+                mean_im += segment[n + i];
+            }
+            mean_im /= n;
+        }
+    }
+
+    if(stft->twosided) {
+        for(size_t i=0; i < n; i++) {
+            real[i] = (segment[i] - mean_re) * stft->window[i];
+            imag[i] = (segment[n + i] - mean_im) * stft->window[i];
+        }
+        fft_plan_kernel(stft->plan, real, imag, 1);
+    } else {
+        // the even, and odd samples are packed into the real, and imaginary parts
+        for(size_t i=0; i < n; i++) {
+            mp_float_t value = (segment[i] - mean_re) * stft->window[i];
+            if(i & 1) {
+                imag[i / 2] = value;
+            } else {
+                real[i / 2] = value;
+            }
+        }
+        fft_real_kernel(stft->plan, real, imag);
+    }
+}
+
+static mp_float_t signal_stft_weight(signal_stft_t *stft, size_t k) {
+    // a one-sided spectrum holds the power of the negative frequencies, too,
+    // except at zero frequency, and at the Nyquist frequency
+    if(!stft->twosided && (k > 0) && (2 * k != stft->nperseg)) {
+        return MICROPY_FLOAT_CONST(2.0) * stft->scale;
+    }
+    return stft->scale;
+}
+
+static void signal_stft_load(mp_float_t *segment, ndarray_obj_t *ndarray, size_t offset, size_t len, bool imag) {
+    // copies len samples of a linear array, starting at offset; with imag, the
+    // imaginary parts of a complex array are copied
+    int32_t stride = ndarray->strides[ULAB_MAX_DIMS - 1];
+    uint8_t *array = (uint8_t *)ndarray->array + (int32_t)offset * stride;
+    #if ULAB_SUPPORTS_COMPLEX
+    if(ndarray->dtype == NDARRAY_COMPLEX) {
+        array += imag ? sizeof(mp_float_t) : 0;
+        for(size_t i=0; i < len; i++) {
+            *segment++ = *((mp_float_t *)array);
+            array += stride;
+        }
+        return;
+    }
+    #endif
+    (void)imag;
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+    for(size_t i=0; i < len; i++) {
+        *segment++ = func(array);
+        array += stride;
+    }
+}
+
+static ndarray_obj_t *signal_stft_input(mp_obj_t arg) {
+    if(!mp_obj_is_type(arg, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("input must be an ndarray"));
+    }
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(arg);
+    if(ndarray->ndim != 1) {
+        mp_raise_ValueError(translate("input must be one-dimensional"));
+    }
+    return ndarray;
+}
+
+static void signal_stft_fill(signal_stft_t *stft, mp_float_t *segment, ndarray_obj_t *re, ndarray_obj_t *im, size_t offset) {
+    // loads the segment starting at offset; the imaginary parts of a two-sided
+    // transform are taken from im, which can be the complex re, or are 0, if im is NULL
+    signal_stft_load(segment, re, offset, stft->nperseg, false);
+    if(stft->twosided) {
+        if(im == NULL) {
+            memset(segment + stft->nperseg, 0, stft->nperseg * sizeof(mp_float_t));
+        } else {
+            signal_stft_load(segment + stft->nperseg, im, offset, stft->nperseg, true);
+        }
+    }
+}
+
+static mp_obj_t signal_stft_frequencies(signal_stft_t *stft, mp_float_t fs) {
+    // the frequencies of the bins; those of a two-sided transform are in the order of numpy.fft.fftfreq
+    ndarray_obj_t *out = ndarray_new_linear_array(stft->nfreq, NDARRAY_FLOAT);
+    mp_float_t *array = (mp_float_t *)out->array;
+    for(size_t k=0; k < stft->nfreq; k++) {
+        mp_float_t f = (mp_float_t)k;
+        if(2 * k >= stft->nperseg + 1) {
+            f -= (mp_float_t)stft->nperseg;
+        }
+        *array++ = f * fs / (mp_float_t)stft->nperseg;
+    }
+    return MP_OBJ_FROM_PTR(out);
+}
+#endif /* SIGNAL_HAS_STFT */
 
 #if ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM
-//| def spectrogram(r: ulab.ndarray) -> ulab.ndarray:
+#if ULAB_MAX_DIMS > 1
+static void signal_stft_segment(signal_stft_t *stft, mp_float_t *out, size_t ostride) {
+    // transforms the samples in the segment buffer, and writes the nfreq values of
+    // the power spectrum into out, whose consecutive elements are ostride apart
+    mp_float_t *real = stft->real;
+    mp_float_t *imag = stft->imag;
+    signal_stft_transform(stft, stft->segment, real, imag);
+    for(size_t k=0; k < stft->nfreq; k++) {
+        *out = (real[k] * real[k] + imag[k] * imag[k]) * signal_stft_weight(stft, k);
+        out += ostride;
+    }
+}
+
+static mp_obj_t signal_spectrogram_stft(mp_obj_t arg_re, mp_obj_t arg_im, mp_arg_val_t *args) {
+    ndarray_obj_t *re = signal_stft_input(arg_re);
+    ndarray_obj_t *im = NULL;
+    bool twosided = false;
+    #if ULAB_SUPPORTS_COMPLEX
+    if(re->dtype == NDARRAY_COMPLEX) {
+        if(arg_im != mp_const_none) {
+            mp_raise_TypeError(translate("imaginary part cannot be given for complex input"));
+        }
+        im = re;
+        twosided = true;
+    }
+    #endif
+    if(arg_im != mp_const_none) {
+        im = signal_stft_input(arg_im);
+        if(im->len != re->len) {
+            mp_raise_ValueError(translate("real and imaginary parts must be of equal length"));
+        }
+        twosided = true;
+    }
+
+    size_t len = re->len;
+    mp_int_t nperseg = mp_obj_get_int(args[5].u_obj);
+    if((nperseg < 1) || (len == 0)) {
+        mp_raise_ValueError(translate("nperseg must be positive"));
+    }
+    // as in scipy, the segments are not longer than the input
+    if((size_t)nperseg > len) {
+        nperseg = (mp_int_t)len;
+    }
+
+    signal_stft_t stft;
+    signal_stft_init(&stft, (size_t)nperseg, args[6].u_obj, mp_obj_get_float(args[3].u_obj), args[4].u_obj,
+                    args[7].u_obj, args[8].u_obj, args[2].u_obj, twosided);
+
+    // the segments are the columns of the output
+    size_t step = stft.nperseg - stft.noverlap;
+    size_t nframes = (len - stft.nperseg) / step + 1;
+    size_t *shape = ndarray_shape_vector(0, 0, stft.nfreq, nframes);
+    ndarray_obj_t *out = ndarray_new_dense_ndarray(2, shape, NDARRAY_FLOAT);
+    mp_float_t *array = (mp_float_t *)out->array;
+
+    for(size_t t=0; t < nframes; t++) {
+        signal_stft_fill(&stft, stft.segment, re, im, t * step);
+        signal_stft_segment(&stft, array + t, nframes);
+    }
+    signal_stft_free(&stft);
+    return MP_OBJ_FROM_PTR(out);
+}
+#endif /* ULAB_MAX_DIMS > 1 */
+
+//| def spectrogram(
+//|     r: ulab.ndarray,
+//|     c: Optional[ulab.ndarray] = None,
+//|     *,
+//|     plan: Optional[ulab.numpy.fft.plan] = None,
+//|     fs: float = 1.0,
+//|     window: Union[str, _ArrayLike] = 'hann',
+//|     nperseg: Optional[int] = None,
+//|     noverlap: Optional[int] = None,
+//|     scaling: str = 'density',
+//|     detrend: Optional[str] = 'constant'
+//| ) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray r: A 1-dimension array of values
+//|     :param ulab.ndarray c: An optional 1-dimension array of values of the same length as r, giving the complex part of the value
+//|     :param plan: An optional plan of the length of the transform, as returned by ``ulab.numpy.fft.plan``
+//|     :param float fs: The sampling frequency
+//|     :param window: One of 'boxcar', 'hann', 'hamming', or 'blackman', a ('kaiser', beta) tuple, or an iterable of length nperseg
+//|     :param int nperseg: The length of the segments
+//|     :param int noverlap: The number of samples shared by consecutive segments, nperseg // 8 by default
+//|     :param str scaling: Either 'density', or 'spectrum'
+//|     :param detrend: Either 'constant', in which case the mean of each segment is removed, or None
+//|
+//|     If nperseg is not given, this computes the spectrum of the input signal, i.e., the absolute
+//|     value of the (complex-valued) fft of the signal, and the remaining keyword arguments are ignored.
+//|     If c is not supplied, the spectrum is calculated by means of the real transform.
+//|
+//|     If nperseg is given, the power spectra of the windowed, overlapping segments of the signal are
+//|     returned in a two-dimensional array, whose rows are the frequencies, and whose columns are the
+//|     segments, as the third item of the tuple returned by ``scipy.signal.spectrogram``. For real input,
+//|     the nperseg // 2 + 1 non-negative frequencies are returned, otherwise, all nperseg frequencies."""
+//|     ...
+//|
+
+mp_obj_t signal_spectrogram(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_, MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_plan, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_fs, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_INT(1) } },
+        { MP_QSTR_window, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_hann) } },
+        { MP_QSTR_nperseg, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_noverlap, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_scaling, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_density) } },
+        { MP_QSTR_detrend, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_constant) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(args[5].u_obj != mp_const_none) {
+        #if ULAB_MAX_DIMS > 1
+        return signal_spectrogram_stft(args[0].u_obj, args[1].u_obj, args);
+        #else
+        mp_raise_NotImplementedError(translate("nperseg requires two-dimensional arrays"));
+        #endif
+    }
+    n_args = args[1].u_obj == mp_const_none ? 1 : 2;
+    return fft_fft_ifft_spectrogram(n_args, args[0].u_obj, args[1].u_obj, args[2].u_obj, false, -1, FFT_SPECTROGRAM);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_spectrogram_obj, 1, signal_spectrogram);
+
+#if ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM_STREAM && (ULAB_MAX_DIMS > 1)
+static void signal_spectrogram_stream_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    (void)kind;
+    signal_spectrogram_stream_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "spectrogram_stream(nperseg=%u, noverlap=%u)", (unsigned)self->stft.nperseg, (unsigned)self->stft.noverlap);
+}
+
+static mp_obj_t signal_spectrogram_stream_call(mp_obj_t self_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    signal_spectrogram_stream_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    signal_stft_t *stft = &self->stft;
+
+    if(!ndarray_object_is_array_like(args[0])) {
+        mp_raise_TypeError(translate("input must be an ndarray, or an iterable"));
+    }
+    ndarray_obj_t *ndarray = NULL;
+    uint8_t *iarray = NULL;
+    int32_t istride = 0;
+    mp_float_t (*func)(void *) = NULL;
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = MP_OBJ_NULL;
+    size_t m;
+    if(mp_obj_is_type(args[0], &ulab_ndarray_type)) {
+        ndarray = signal_stft_input(args[0]);
+        #if ULAB_SUPPORTS_COMPLEX
+        if(ndarray->dtype == NDARRAY_COMPLEX) {
+            mp_raise_TypeError(translate("input must be real"));
+        }
+        #endif
+        iarray = (uint8_t *)ndarray->array;
+        istride = ndarray->strides[ULAB_MAX_DIMS - 1];
+        func = ndarray_get_float_function(ndarray->dtype);
+        m = ndarray->len;
+    } else {
+        iterable = mp_getiter(args[0], &iter_buf);
+        m = (size_t)mp_obj_get_int(mp_obj_len(args[0]));
+    }
+
+    // each segment that is completed by the new samples is a column of the output
+    size_t step = stft->nperseg - stft->noverlap;
+    size_t total = self->count + m;
+    size_t nframes = total < stft->nperseg ? 0 : (total - stft->nperseg) / step + 1;
+    size_t *shape = ndarray_shape_vector(0, 0, stft->nfreq, nframes);
+    ndarray_obj_t *out = ndarray_new_dense_ndarray(2, shape, NDARRAY_FLOAT);
+    mp_float_t *array = (mp_float_t *)out->array;
+
+    for(size_t i=0; i < m; i++) {
+        mp_float_t value;
+        if(ndarray != NULL) {
+            value = func(iarray);
+            iarray += istride;
+        } else {
+            value = mp_obj_get_float(mp_iternext(iterable));
+        }
+        stft->segment[self->count++] = value;
+        if(self->count == stft->nperseg) {
+            signal_stft_segment(stft, array++, nframes);
+            // the overlapping samples are the beginning of the next segment
+            memmove(stft->segment, stft->segment + step, stft->noverlap * sizeof(mp_float_t));
+            self->count = stft->noverlap;
+        }
+    }
+    return MP_OBJ_FROM_PTR(out);
+}
+
+const mp_obj_type_t signal_spectrogram_stream_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_spectrogram_stream,
+    .print = signal_spectrogram_stream_print,
+    .call = signal_spectrogram_stream_call,
+};
+
+//| def spectrogram_stream(
+//|     nperseg: int,
+//|     *,
+//|     noverlap: Optional[int] = None,
+//|     fs: float = 1.0,
+//|     window: Union[str, _ArrayLike] = 'hann',
+//|     scaling: str = 'density',
+//|     detrend: Optional[str] = 'constant',
+//|     plan: Optional[ulab.numpy.fft.plan] = None
+//| ) -> Callable[[_ArrayLike], ulab.ndarray]:
+//|     """
+//|     :param int nperseg: The length of the segments
+//|
+//|     The remaining arguments are the same as in ``spectrogram``.
+//|
+//|     Return a callable object, which computes the spectrogram of a real signal, whose samples
+//|     arrive in chunks of arbitrary length. Each call takes the new samples, and returns the
+//|     power spectra of the segments completed by them as the columns of a two-dimensional array,
+//|     which has no columns, if no segment was completed. The samples of an incomplete segment,
+//|     and the overlap are kept between calls, hence, feeding a signal in chunks returns the same
+//|     columns as ``spectrogram`` with the same arguments. The window, and the plan are calculated
+//|     only once, when the object is created."""
+//|     ...
+//|
+
+mp_obj_t signal_spectrogram_stream(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_nperseg, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0 } },
+        { MP_QSTR_noverlap, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_fs, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_INT(1) } },
+        { MP_QSTR_window, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_hann) } },
+        { MP_QSTR_scaling, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_density) } },
+        { MP_QSTR_detrend, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_constant) } },
+        { MP_QSTR_plan, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(args[0].u_int < 1) {
+        mp_raise_ValueError(translate("nperseg must be positive"));
+    }
+    signal_spectrogram_stream_obj_t *self = m_new_obj(signal_spectrogram_stream_obj_t);
+    self->base.type = &signal_spectrogram_stream_type;
+    signal_stft_init(&self->stft, (size_t)args[0].u_int, args[1].u_obj, mp_obj_get_float(args[2].u_obj), args[3].u_obj,
+                    args[4].u_obj, args[5].u_obj, args[6].u_obj, false);
+    self->count = 0;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_spectrogram_stream_obj, 1, signal_spectrogram_stream);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM_STREAM */
+#endif /* ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM */
+
+#if ULAB_SCIPY_SIGNAL_HAS_WELCH || ULAB_SCIPY_SIGNAL_HAS_CSD
+static bool signal_stft_is_complex(ndarray_obj_t *ndarray) {
+    #if ULAB_SUPPORTS_COMPLEX
+    return ndarray->dtype == NDARRAY_COMPLEX;
+    #else
+    (void)ndarray;
+    return false;
+    #endif
+}
+
+static mp_obj_t signal_welch_csd(mp_obj_t arg_x, mp_obj_t arg_y, mp_arg_val_t *args) {
+    // the arguments are fs, window, nperseg, noverlap, scaling, detrend, and plan;
+    // without y, the power spectral density of x is calculated
+    ndarray_obj_t *x = signal_stft_input(arg_x);
+    ndarray_obj_t *y = NULL;
+    bool twosided = signal_stft_is_complex(x);
+    if(arg_y != MP_OBJ_NULL) {
+        y = signal_stft_input(arg_y);
+        if(y->len != x->len) {
+            mp_raise_ValueError(translate("x and y must be of equal length"));
+        }
+        twosided = twosided || signal_stft_is_complex(y);
+    }
+
+    size_t len = x->len;
+    mp_int_t nperseg = 256;
+    if(args[2].u_obj != mp_const_none) {
+        nperseg = mp_obj_get_int(args[2].u_obj);
+    }
+    if((nperseg < 1) || (len == 0)) {
+        mp_raise_ValueError(translate("nperseg must be positive"));
+    }
+    if((size_t)nperseg > len) {
+        nperseg = (mp_int_t)len;
+    }
+    mp_obj_t noverlap = args[3].u_obj == mp_const_none ? MP_OBJ_NEW_SMALL_INT(nperseg / 2) : args[3].u_obj;
+    mp_float_t fs = mp_obj_get_float(args[0].u_obj);
+
+    signal_stft_t stft;
+    signal_stft_init(&stft, (size_t)nperseg, noverlap, fs, args[1].u_obj, args[4].u_obj, args[5].u_obj, args[6].u_obj, twosided);
+    size_t nfreq = stft.nfreq;
+
+    // the segment of y is followed by its transform in a single buffer
+    size_t seglen = twosided ? 2 * stft.nperseg : stft.nperseg;
+    mp_float_t *ybuffer = NULL;
+    uint8_t dtype = NDARRAY_FLOAT;
+    if(y != NULL) {
+        ybuffer = m_new(mp_float_t, seglen + 2 * nfreq);
+        #if ULAB_SCIPY_SIGNAL_HAS_CSD
+        dtype = NDARRAY_COMPLEX;
+        #endif
+    }
+
+    // the segments are accumulated in the output, hence, the memory
+    // does not depend on the number of segments
+    ndarray_obj_t *out = ndarray_new_linear_array(nfreq, dtype);
+    mp_float_t *acc = (mp_float_t *)out->array;
+    mp_float_t *xr = stft.real, *xi = stft.imag;
+    size_t step = stft.nperseg - stft.noverlap;
+    size_t nframes = (len - stft.nperseg) / step + 1;
+
+    for(size_t t=0; t < nframes; t++) {
+        signal_stft_fill(&stft, stft.segment, x, signal_stft_is_complex(x) ? x : NULL, t * step);
+        signal_stft_transform(&stft, stft.segment, xr, xi);
+        if(y == NULL) {
+            for(size_t k=0; k < nfreq; k++) {
+                acc[k] += (xr[k] * xr[k] + xi[k] * xi[k]) * signal_stft_weight(&stft, k);
+            }
+        } else {
+            mp_float_t *yr = ybuffer + seglen;
+            mp_float_t *yi = yr + nfreq;
+            signal_stft_fill(&stft, ybuffer, y, signal_stft_is_complex(y) ? y : NULL, t * step);
+            signal_stft_transform(&stft, ybuffer, yr, yi);
+            // conj(X) Y
+            for(size_t k=0; k < nfreq; k++) {
+                mp_float_t weight = signal_stft_weight(&stft, k);
+                acc[2 * k] += (xr[k] * yr[k] + xi[k] * yi[k]) * weight;
+                acc[2 * k + 1] += (xr[k] * yi[k] - xi[k] * yr[k]) * weight;
+            }
+        }
+    }
+
+    size_t n = y == NULL ? nfreq : 2 * nfreq;
+    for(size_t k=0; k < n; k++) {
+        acc[k] /= nframes;
+    }
+    if(ybuffer != NULL) {
+        m_del(mp_float_t, ybuffer, seglen + 2 * nfreq);
+    }
+
+    mp_obj_t tuple[2];
+    tuple[0] = signal_stft_frequencies(&stft, fs);
+    tuple[1] = MP_OBJ_FROM_PTR(out);
+    signal_stft_free(&stft);
+    return mp_obj_new_tuple(2, tuple);
+}
+#endif
+
+#if ULAB_SCIPY_SIGNAL_HAS_WELCH
+//| def welch(
+//|     x: ulab.ndarray,
+//|     *,
+//|     fs: float = 1.0,
+//|     window: Union[str, _ArrayLike] = 'hann',
+//|     nperseg: Optional[int] = None,
+//|     noverlap: Optional[int] = None,
+//|     scaling: str = 'density',
+//|     detrend: Optional[str] = 'constant',
+//|     plan: Optional[ulab.numpy.fft.plan] = None
+//| ) -> Tuple[ulab.ndarray, ulab.ndarray]:
+//|     """
+//|     :param ulab.ndarray x: A 1-dimension array of values
+//|     :param int nperseg: The length of the segments, 256 by default, but at most the length of x
+//|     :param int noverlap: The number of samples shared by consecutive segments, nperseg // 2 by default
+//|
+//|     The remaining arguments are the same as in ``spectrogram``.
+//|
+//|     Estimate the power spectral density with Welch's method, i.e., by averaging the power spectra
+//|     of the windowed, overlapping segments of x. Return the frequencies, and the power spectral
+//|     density. The spectra are summed in the output array, hence, no memory is required for
+//|     the individual segments. Segments are always averaged by their mean."""
+//|     ...
+//|
+
+mp_obj_t signal_welch(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_fs, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_INT(1) } },
+        { MP_QSTR_window, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_hann) } },
+        { MP_QSTR_nperseg, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_noverlap, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_scaling, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_density) } },
+        { MP_QSTR_detrend, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_constant) } },
+        { MP_QSTR_plan, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return signal_welch_csd(args[0].u_obj, MP_OBJ_NULL, args + 1);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_welch_obj, 1, signal_welch);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_WELCH */
+
+#if ULAB_SCIPY_SIGNAL_HAS_CSD
+//| def csd(
+//|     x: ulab.ndarray,
+//|     y: ulab.ndarray,
+//|     *,
+//|     fs: float = 1.0,
+//|     window: Union[str, _ArrayLike] = 'hann',
+//|     nperseg: Optional[int] = None,
+//|     noverlap: Optional[int] = None,
+//|     scaling: str = 'density',
+//|     detrend: Optional[str] = 'constant',
+//|     plan: Optional[ulab.numpy.fft.plan] = None
+//| ) -> Tuple[ulab.ndarray, ulab.ndarray]:
+//|     """
+//|     :param ulab.ndarray x: A 1-dimension array of values
+//|     :param ulab.ndarray y: A 1-dimension array of values of the same length as x
+//|
+//|     The remaining arguments are the same as in ``welch``.
+//|
+//|     Estimate the cross power spectral density of x, and y with Welch's method. Return the
+//|     frequencies, and the complex cross spectral density, the average of conj(X) * Y over the segments."""
+//|     ...
+//|
+
+mp_obj_t signal_csd(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_fs, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_INT(1) } },
+        { MP_QSTR_window, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_hann) } },
+        { MP_QSTR_nperseg, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_noverlap, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_scaling, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_density) } },
+        { MP_QSTR_detrend, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_constant) } },
+        { MP_QSTR_plan, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return signal_welch_csd(args[0].u_obj, args[1].u_obj, args + 2);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_csd_obj, 2, signal_csd);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_CSD */
+
+#if ULAB_SCIPY_SIGNAL_HAS_GOERTZEL || ULAB_SCIPY_SIGNAL_HAS_SLIDING_DFT
+static void signal_goertzel_kernel(uint8_t *array, int32_t stride, mp_float_t (*func)(void *), size_t len,
+                                    mp_float_t omega, mp_float_t *real, mp_float_t *imag) {
+    // calculates sum(x[i] * exp(-1j * omega * i)) of len samples by means of Goertzel's
+    // second-order recursion, which requires a single multiplication per sample
+    mp_float_t c = MICROPY_FLOAT_C_FUN(cos)(omega);
+    mp_float_t s = MICROPY_FLOAT_C_FUN(sin)(omega);
+    mp_float_t coeff = MICROPY_FLOAT_CONST(2.0) * c;
+    mp_float_t s1 = MICROPY_FLOAT_CONST(0.0), s2 = MICROPY_FLOAT_CONST(0.0);
+    for(size_t i=0; i < len; i++) {
+        mp_float_t s0 = func(array) + coeff * s1 - s2;
+        s2 = s1;
+        s1 = s0;
+        array += stride;
+    }
+    // s1 - exp(-1j * omega) * s2 is the sum multiplied by exp(1j * omega * (len - 1))
+    mp_float_t yr = s1 - c * s2;
+    mp_float_t yi = s * s2;
+    mp_float_t phase = omega * (mp_float_t)(len - 1);
+    c = MICROPY_FLOAT_C_FUN(cos)(phase);
+    s = MICROPY_FLOAT_C_FUN(sin)(phase);
+    *real = yr * c + yi * s;
+    *imag = yi * c - yr * s;
+}
+
+static size_t signal_goertzel_frequencies(mp_obj_t arg_freqs, mp_float_t fs, mp_float_t **omega) {
+    // converts the frequencies into angular frequencies in radians per sample
+    if(!ndarray_object_is_array_like(arg_freqs)) {
+        mp_raise_TypeError(translate("freqs must be an iterable"));
+    }
+    if(fs <= MICROPY_FLOAT_CONST(0.0)) {
+        mp_raise_ValueError(translate("fs must be positive"));
+    }
+    size_t nbins = (size_t)mp_obj_get_int(mp_obj_len(arg_freqs));
+    if(nbins == 0) {
+        mp_raise_ValueError(translate("freqs must not be empty"));
+    }
+    *omega = m_new(mp_float_t, nbins);
+    fill_array_iterable(*omega, arg_freqs);
+    for(size_t j=0; j < nbins; j++) {
+        (*omega)[j] *= MICROPY_FLOAT_CONST(2.0) * MP_PI / fs;
+    }
+    return nbins;
+}
+#endif
+
+#if ULAB_SCIPY_SIGNAL_HAS_GOERTZEL
+//| def goertzel(x: ulab.ndarray, freqs: _ArrayLike, fs: float = 1.0) -> Union[ulab.ndarray, Tuple[ulab.ndarray, ulab.ndarray]]:
+//|     """
+//|     :param ulab.ndarray x: A 1-dimension array of values
+//|     :param freqs: The frequencies, at which the Fourier transform is evaluated
+//|     :param float fs: The sampling frequency of x
+//|
+//|     Evaluate the discrete Fourier transform of x at the given frequencies by means of Goertzel's
+//|     algorithm. With f = k * fs / len(x), the result is the k-th bin of ``numpy.fft.fft(x)``, but
+//|     the frequencies need not fall on the bins. The cost is proportional to len(x) * len(freqs),
+//|     hence, a few frequencies are calculated faster, and with less memory than the full transform.
+//|     As with ``numpy.fft.fft``, the real, and imaginary parts are returned as a tuple for real
+//|     input, and as a complex array for complex input."""
+//|     ...
+//|
+
+mp_obj_t signal_goertzel(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_freqs, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_fs, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_INT(1) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("input must be an ndarray"));
+    }
+    ndarray_obj_t *x = MP_OBJ_TO_PTR(args[0].u_obj);
+    #if ULAB_MAX_DIMS > 1
+    if(x->ndim != 1) {
+        mp_raise_ValueError(translate("input must be one-dimensional"));
+    }
+    #endif
+    mp_float_t *omega;
+    size_t nbins = signal_goertzel_frequencies(args[1].u_obj, mp_obj_get_float(args[2].u_obj), &omega);
+
+    uint8_t *array = (uint8_t *)x->array;
+    int32_t stride = x->strides[ULAB_MAX_DIMS - 1];
+    mp_float_t (*func)(void *) = ndarray_get_float_function(x->dtype);
+    mp_obj_t result;
+
+    #if ULAB_SUPPORTS_COMPLEX
+    if(x->dtype == NDARRAY_COMPLEX) {
+        // the transform is linear, hence, the real, and imaginary parts can be transformed separately
+        ndarray_obj_t *out = ndarray_new_linear_array(nbins, NDARRAY_COMPLEX);
+        mp_float_t *data = (mp_float_t *)out->array;
+        for(size_t j=0; j < nbins; j++) {
+            mp_float_t rr, ri, ir, ii;
+            signal_goertzel_kernel(array, stride, func, x->len, omega[j], &rr, &ri);
+            signal_goertzel_kernel(array + sizeof(mp_float_t), stride, func, x->len, omega[j], &ir, &ii);
+            *data++ = rr - ii;
+            *data++ = ri + ir;
+        }
+        result = MP_OBJ_FROM_PTR(out);
+    } else {
+    #endif
+        ndarray_obj_t *out_re = ndarray_new_linear_array(nbins, NDARRAY_FLOAT);
+        ndarray_obj_t *out_im = ndarray_new_linear_array(nbins, NDARRAY_FLOAT);
+        mp_float_t *data_re = (mp_float_t *)out_re->array;
+        mp_float_t *data_im = (mp_float_t *)out_im->array;
+        for(size_t j=0; j < nbins; j++) {
+            signal_goertzel_kernel(array, stride, func, x->len, omega[j], data_re++, data_im++);
+        }
+        mp_obj_t tuple[2];
+        tuple[0] = MP_OBJ_FROM_PTR(out_re);
+        tuple[1] = MP_OBJ_FROM_PTR(out_im);
+        result = mp_obj_new_tuple(2, tuple);
+    #if ULAB_SUPPORTS_COMPLEX
+    }
+    #endif
+    m_del(mp_float_t, omega, nbins);
+    return result;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_goertzel_obj, 2, signal_goertzel);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_GOERTZEL */
+
+#if ULAB_SCIPY_SIGNAL_HAS_SLIDING_DFT
+static void signal_sliding_dft_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    (void)kind;
+    signal_sliding_dft_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "sliding_dft(n=%u, bins=%u)", (unsigned)self->n, (unsigned)self->nbins);
+}
+
+static void signal_sliding_dft_resync(signal_sliding_dft_obj_t *self) {
+    // the recursion accumulates the rounding errors of the rotations, therefore, the bins
+    // are re-calculated from the samples, whenever the buffer is in chronological order
+    mp_float_t (*func)(void *) = ndarray_get_float_function(NDARRAY_FLOAT);
+    for(size_t j=0; j < self->nbins; j++) {
+        signal_goertzel_kernel((uint8_t *)self->buffer, sizeof(mp_float_t), func, self->n, self->omega[j],
+                                &self->real[j], &self->imag[j]);
+    }
+}
+
+static mp_obj_t signal_sliding_dft_call(mp_obj_t self_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    signal_sliding_dft_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    ndarray_obj_t *ndarray = NULL;
+    uint8_t *iarray = NULL;
+    int32_t istride = 0;
+    mp_float_t (*func)(void *) = NULL;
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = MP_OBJ_NULL;
+    size_t m = 1;
+    if(mp_obj_is_type(args[0], &ulab_ndarray_type)) {
+        ndarray = MP_OBJ_TO_PTR(args[0]);
+        #if ULAB_MAX_DIMS > 1
+        if(ndarray->ndim != 1) {
+            mp_raise_ValueError(translate("input must be one-dimensional"));
+        }
+        #endif
+        #if ULAB_SUPPORTS_COMPLEX
+        if(ndarray->dtype == NDARRAY_COMPLEX) {
+            mp_raise_TypeError(translate("input must be real"));
+        }
+        #endif
+        iarray = (uint8_t *)ndarray->array;
+        istride = ndarray->strides[ULAB_MAX_DIMS - 1];
+        func = ndarray_get_float_function(ndarray->dtype);
+        m = ndarray->len;
+    } else if(ndarray_object_is_array_like(args[0])) {
+        iterable = mp_getiter(args[0], &iter_buf);
+        m = (size_t)mp_obj_get_int(mp_obj_len(args[0]));
+    }
+
+    for(size_t i=0; i < m; i++) {
+        mp_float_t value;
+        if(ndarray != NULL) {
+            value = func(iarray);
+            iarray += istride;
+        } else if(iterable != MP_OBJ_NULL) {
+            value = mp_obj_get_float(mp_iternext(iterable));
+        } else {
+            value = mp_obj_get_float(args[0]);
+        }
+        // the oldest sample leaves the window, the bins are rotated by one sample, and the new sample enters
+        mp_float_t old = self->buffer[self->pos];
+        self->buffer[self->pos] = value;
+        for(size_t j=0; j < self->nbins; j++) {
+            mp_float_t re = self->real[j] - old;
+            mp_float_t im = self->imag[j];
+            self->real[j] = self->rotation[2 * j] * re - self->rotation[2 * j + 1] * im + self->weight[2 * j] * value;
+            self->imag[j] = self->rotation[2 * j] * im + self->rotation[2 * j + 1] * re + self->weight[2 * j + 1] * value;
+        }
+        if(++self->pos == self->n) {
+            self->pos = 0;
+            signal_sliding_dft_resync(self);
+        }
+    }
+
+    ndarray_obj_t *out_re = ndarray_new_linear_array(self->nbins, NDARRAY_FLOAT);
+    ndarray_obj_t *out_im = ndarray_new_linear_array(self->nbins, NDARRAY_FLOAT);
+    memcpy(out_re->array, self->real, self->nbins * sizeof(mp_float_t));
+    memcpy(out_im->array, self->imag, self->nbins * sizeof(mp_float_t));
+    mp_obj_t tuple[2];
+    tuple[0] = MP_OBJ_FROM_PTR(out_re);
+    tuple[1] = MP_OBJ_FROM_PTR(out_im);
+    return mp_obj_new_tuple(2, tuple);
+}
+
+const mp_obj_type_t signal_sliding_dft_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_sliding_dft,
+    .print = signal_sliding_dft_print,
+    .call = signal_sliding_dft_call,
+};
+
+//| def sliding_dft(n: int, freqs: _ArrayLike, fs: float = 1.0) -> Callable[[Union[_ArrayLike, float]], Tuple[ulab.ndarray, ulab.ndarray]]:
+//|     """
+//|     :param int n: The length of the window
+//|     :param freqs: The frequencies that are tracked
+//|     :param float fs: The sampling frequency
+//|
+//|     Return a callable object, which tracks the Fourier transform of the last n samples of a
+//|     real signal at the given frequencies. Each call takes a single sample, or an array of new
+//|     samples, and returns the real, and imaginary parts of the transform of the window ending with
+//|     the last sample, i.e., the same values as ``goertzel`` of the last n samples. Before the window
+//|     is filled, the missing samples are taken to be 0. Each sample updates each frequency
+//|     in constant time. In order to avoid the accumulation of rounding errors, the transform
+//|     is re-calculated from the samples once in every n samples, which, on average, costs
+//|     another multiplication per sample, and frequency."""
+//|     ...
+//|
+
+mp_obj_t signal_sliding_dft(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_n, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0 } },
+        { MP_QSTR_freqs, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_fs, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_INT(1) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(args[0].u_int < 1) {
+        mp_raise_ValueError(translate("n must be positive"));
+    }
+    signal_sliding_dft_obj_t *self = m_new_obj(signal_sliding_dft_obj_t);
+    self->base.type = &signal_sliding_dft_type;
+    self->n = (size_t)args[0].u_int;
+    self->nbins = signal_goertzel_frequencies(args[1].u_obj, mp_obj_get_float(args[2].u_obj), &self->omega);
+    self->pos = 0;
+    self->buffer = m_new0(mp_float_t, self->n);
+    self->rotation = m_new(mp_float_t, 2 * self->nbins);
+    self->weight = m_new(mp_float_t, 2 * self->nbins);
+    self->real = m_new0(mp_float_t, self->nbins);
+    self->imag = m_new0(mp_float_t, self->nbins);
+    for(size_t j=0; j < self->nbins; j++) {
+        mp_float_t omega = self->omega[j];
+        mp_float_t phase = omega * (mp_float_t)(self->n - 1);
+        self->rotation[2 * j] = MICROPY_FLOAT_C_FUN(cos)(omega);
+        self->rotation[2 * j + 1] = MICROPY_FLOAT_C_FUN(sin)(omega);
+        // the weight of the newest sample is exp(-1j * omega * (n - 1))
+        self->weight[2 * j] = MICROPY_FLOAT_C_FUN(cos)(phase);
+        self->weight[2 * j + 1] = -MICROPY_FLOAT_C_FUN(sin)(phase);
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_sliding_dft_obj, 2, signal_sliding_dft);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_SLIDING_DFT */
+
+#if SIGNAL_HAS_FILTER_INPUT
+static size_t signal_input_length(mp_obj_t arg) {
+    // the input of the time-domain filters is a real, one-dimensional array, or an iterable
+    if(!ndarray_object_is_array_like(arg)) {
+        mp_raise_TypeError(translate("input must be an ndarray, or an iterable"));
+    }
+    if(mp_obj_is_type(arg, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(arg);
+        #if ULAB_MAX_DIMS > 1
+        if(ndarray->ndim > 1) {
+            mp_raise_ValueError(translate("input must be one-dimensional"));
+        }
+        #endif
+        #if ULAB_SUPPORTS_COMPLEX
+        if(ndarray->dtype == NDARRAY_COMPLEX) {
+            mp_raise_TypeError(translate("input must be real"));
+        }
+        #endif
+        return ndarray->len;
+    }
+    return (size_t)mp_obj_get_int(mp_obj_len_maybe(arg));
+}
+
+static void signal_input_load(mp_float_t *array, mp_obj_t arg) {
+    // copies the input into a float buffer; arrays are read with the accessor of their dtype
+    if(mp_obj_is_type(arg, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(arg);
+        uint8_t *iarray = (uint8_t *)ndarray->array;
+        mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+        for(size_t i=0; i < ndarray->len; i++) {
+            *array++ = func(iarray);
+            iarray += ndarray->strides[ULAB_MAX_DIMS - 1];
+        }
+    } else {
+        fill_array_iterable(array, arg);
+    }
+}
+#endif
+
+#if ULAB_SCIPY_SIGNAL_HAS_FILTFILT || ULAB_SCIPY_SIGNAL_HAS_SOSFILTFILT
+static size_t signal_padlen(mp_obj_t arg_padlen, size_t edge, size_t len) {
+    // returns the length of the odd extension at either end of the input
+    if(arg_padlen != mp_const_none) {
+        mp_int_t padlen = mp_obj_get_int(arg_padlen);
+        if(padlen < 0) {
+            mp_raise_ValueError(translate("padlen must be non-negative"));
+        }
+        edge = (size_t)padlen;
+    }
+    if((edge > 0) && (len <= edge)) {
+        mp_raise_ValueError(translate("the length of the input must be greater than padlen"));
+    }
+    return edge;
+}
+
+static void signal_odd_extension(mp_float_t *array, size_t len, size_t edge) {
+    // the input is at array + edge; the extension mirrors it about its end points
+    mp_float_t *x = array + edge;
+    for(size_t i=1; i <= edge; i++) {
+        x[-(int32_t)i] = MICROPY_FLOAT_CONST(2.0) * x[0] - x[i];
+        x[len - 1 + i] = MICROPY_FLOAT_CONST(2.0) * x[len - 1] - x[len - 1 - i];
+    }
+}
+
+static void signal_reverse(mp_float_t *array, size_t len) {
+    for(size_t i=0, j=len - 1; i < len / 2; i++, j--) {
+        SWAP(mp_float_t, array[i], array[j]);
+    }
+}
+#endif
+
+#if SIGNAL_HAS_SOS_KERNEL
+static void signal_sosfilt_array(mp_float_t *x, const mp_float_t *coeffs, mp_float_t *zf, const size_t len,
+                                    const size_t channels, const size_t istride, const size_t cstride) {
+    // filters len samples of each channel through a single section; consecutive samples are istride,
+    // and channels cstride elements apart, and zf holds the two delays of each channel; the channels
+    // are processed in the inner loop, so that the coefficients are loaded only once
+    const mp_float_t b0 = coeffs[0], b1 = coeffs[1], b2 = coeffs[2], a1 = coeffs[4], a2 = coeffs[5];
+    for(size_t i=0; i < len; i++) {
+        mp_float_t *xc = x;
+        mp_float_t *z = zf;
+        for(size_t c=0; c < channels; c++) {
+            mp_float_t xn = *xc;
+            mp_float_t yn = b0 * xn + z[0];
+            z[0] = z[1] + b1 * xn - a1 * yn;
+            z[1] = b2 * xn - a2 * yn;
+            *xc = yn;
+            xc += cstride;
+            z += 2;
+        }
+        x += istride;
+    }
+}
+#endif /* SIGNAL_HAS_SOS_KERNEL */
+
+#if SIGNAL_HAS_SOS_KERNEL || ULAB_SCIPY_SIGNAL_HAS_SOSFILT_FIXED
+static mp_float_t *signal_sos_coefficients(mp_obj_t arg_sos, size_t *nsections) {
+    // packs the rows of sos into a single array of 6 coefficients per section
+    if(!ndarray_object_is_array_like(arg_sos)) {
+        mp_raise_TypeError(translate("sosfilt requires iterable arguments"));
+    }
+    *nsections = (size_t)mp_obj_get_int(mp_obj_len_maybe(arg_sos));
+    mp_float_t *coeffs = m_new(mp_float_t, 6 * *nsections);
+    mp_float_t *array = coeffs;
+
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t item, iterable = mp_getiter(arg_sos, &iter_buf);
+    while((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        if(mp_obj_get_int(mp_obj_len_maybe(item)) != 6) {
+            mp_raise_ValueError(translate("sos array must be of shape (n_section, 6)"));
+        }
+        fill_array_iterable(array, item);
+        if(array[3] != MICROPY_FLOAT_CONST(1.0)) {
+            mp_raise_ValueError(translate("sos[:, 3] should be all ones"));
+        }
+        array += 6;
+    }
+    return coeffs;
+}
+#endif
+
+#if ULAB_SCIPY_SIGNAL_HAS_SOSFILT || ULAB_SCIPY_SIGNAL_HAS_SOSFILTER
+static void signal_sos_state(mp_float_t *state, mp_obj_t arg_zi, uint8_t ndim, size_t *shape) {
+    // copies zi, whose shape must be equal to the ndim-dimensional shape, into state
+    if(!mp_obj_is_type(arg_zi, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("zi must be an ndarray"));
+    }
+    ndarray_obj_t *zi = MP_OBJ_TO_PTR(arg_zi);
+    bool equal = zi->ndim == ndim;
+    for(uint8_t i = ULAB_MAX_DIMS; equal && (i > ULAB_MAX_DIMS - ndim); i--) {
+        equal = zi->shape[i - 1] == shape[i - 1];
+    }
+    if(!equal) {
+        if(ndim == 3) {
+            mp_raise_ValueError(translate("zi must be of shape (n_section, channels, 2)"));
+        } else if(shape[ULAB_MAX_DIMS - 1] != 2) {
+            mp_raise_ValueError(translate("zi must be of shape (n_section, 2 * channels)"));
+        }
+        mp_raise_ValueError(translate("zi must be of shape (n_section, 2)"));
+    }
+    if(zi->dtype != NDARRAY_FLOAT) {
+        mp_raise_ValueError(translate("zi must be of float type"));
+    }
+    // the leading axes of a two-dimensional zi are taken to be of length 1
+    size_t outer = 1, middle = 1;
+    int32_t ostride = 0, mstride = 0;
+    #if ULAB_MAX_DIMS > 2
+    if(ndim == 3) {
+        outer = zi->shape[ULAB_MAX_DIMS - 3];
+        ostride = zi->strides[ULAB_MAX_DIMS - 3];
+    }
+    #endif
+    #if ULAB_MAX_DIMS > 1
+    middle = zi->shape[ULAB_MAX_DIMS - 2];
+    mstride = zi->strides[ULAB_MAX_DIMS - 2];
+    #endif
+    uint8_t *array = (uint8_t *)zi->array;
+    for(size_t i=0; i < outer; i++) {
+        uint8_t *row = array;
+        for(size_t j=0; j < middle; j++) {
+            uint8_t *element = row;
+            for(size_t k=0; k < zi->shape[ULAB_MAX_DIMS - 1]; k++) {
+                *state++ = *((mp_float_t *)element);
+                element += zi->strides[ULAB_MAX_DIMS - 1];
+            }
+            row += mstride;
+        }
+        array += ostride;
+    }
+}
+#endif
+
+#if ULAB_SCIPY_SIGNAL_HAS_SOSFILT
+//| def sosfilt(sos: _ArrayLike, x: _ArrayLike, *, axis: int = -1, zi: Optional[ulab.ndarray] = None) -> Union[ulab.ndarray, Tuple[ulab.ndarray, ulab.ndarray]]:
+//|     """
+//|     :param ulab.ndarray sos: Array of second-order filter coefficients, must have shape (n_sections, 6)
+//|     :param ulab.ndarray x: The input signal, a one-, or two-dimensional array
+//|     :param int axis: For two-dimensional input, the axis along which the filter is applied to each channel
+//|     :param ulab.ndarray zi: Optional initial conditions for the filter
+//|
+//|     Filter x along an axis by means of a cascade of second-order sections. For one-dimensional
+//|     input, zi has shape (n_sections, 2). For two-dimensional input, the channels are filtered
+//|     simultaneously, and zi has shape (n_sections, channels, 2), or, if the firmware supports
+//|     two dimensions only, shape (n_sections, 2 * channels), whose rows hold the delays of the
+//|     channels one after the other. If zi is given, the final state is returned as the second
+//|     element of a tuple."""
+//|     ...
+//|
+
+mp_obj_t signal_sosfilt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sos, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_zi, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1 } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!ndarray_object_is_array_like(args[0].u_obj) || !ndarray_object_is_array_like(args[1].u_obj)) {
+        mp_raise_TypeError(translate("sosfilt requires iterable arguments"));
+    }
+
+    // the samples of the channels are len, istride elements apart in the dense output,
+    // and consecutive channels are cstride elements apart
+    ndarray_obj_t *y;
+    size_t len, channels = 1, istride = 1, cstride = 0;
+    if(mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type)) {
+        ndarray_obj_t *inarray = MP_OBJ_TO_PTR(args[1].u_obj);
+        #if ULAB_SUPPORTS_COMPLEX
+        if(inarray->dtype == NDARRAY_COMPLEX) {
+            mp_raise_TypeError(translate("input must be real"));
+        }
+        #endif
+        int8_t axis = args[3].u_int;
+        if(axis < 0) {
+            axis += inarray->ndim;
+        }
+        if((axis < 0) || (axis > inarray->ndim - 1)) {
+            mp_raise_ValueError(translate("axis is out of bounds"));
+        }
+        y = ndarray_new_dense_ndarray(inarray->ndim, inarray->shape, NDARRAY_FLOAT);
+        mp_float_t *yarray = (mp_float_t *)y->array;
+        mp_float_t (*func)(void *) = ndarray_get_float_function(inarray->dtype);
+        len = inarray->shape[ULAB_MAX_DIMS - 1];
+        #if ULAB_MAX_DIMS > 1
+        if(inarray->ndim == 2) {
+            size_t rows = inarray->shape[ULAB_MAX_DIMS - 2];
+            uint8_t *iarray = (uint8_t *)inarray->array;
+            for(size_t j=0; j < rows; j++) {
+                uint8_t *row = iarray;
+                for(size_t i=0; i < len; i++) {
+                    *yarray++ = func(row);
+                    row += inarray->strides[ULAB_MAX_DIMS - 1];
+                }
+                iarray += inarray->strides[ULAB_MAX_DIMS - 2];
+            }
+            channels = rows;
+            cstride = len;
+            if(axis == 0) {
+                SWAP(size_t, len, channels);
+                SWAP(size_t, istride, cstride);
+            }
+        } else if(inarray->ndim > 2) {
+            mp_raise_ValueError(translate("input must be one-, or two-dimensional"));
+        }
+        #endif
+        if(inarray->ndim == 1) {
+            uint8_t *iarray = (uint8_t *)inarray->array;
+            for(size_t i=0; i < len; i++) {
+                *yarray++ = func(iarray);
+                iarray += inarray->strides[ULAB_MAX_DIMS - 1];
+            }
+        }
+    } else {
+        len = (size_t)mp_obj_get_int(mp_obj_len_maybe(args[1].u_obj));
+        y = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+        fill_array_iterable((mp_float_t *)y->array, args[1].u_obj);
+    }
+
+    size_t lensos;
+    mp_float_t *coeffs = signal_sos_coefficients(args[0].u_obj, &lensos);
+
+    // the state holds the two delays of each channel for each section
+    uint8_t ndim = 2;
+    size_t *shape = ndarray_shape_vector(0, 0, lensos, 2 * channels);
+    #if ULAB_MAX_DIMS > 2
+    if(y->ndim == 2) {
+        ndim = 3;
+        shape[ULAB_MAX_DIMS - 3] = lensos;
+        shape[ULAB_MAX_DIMS - 2] = channels;
+        shape[ULAB_MAX_DIMS - 1] = 2;
+    }
+    #endif
+    ndarray_obj_t *zf = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+    mp_float_t *zf_array = (mp_float_t *)zf->array;
+
+    if(args[2].u_obj != mp_const_none) {
+        signal_sos_state(zf_array, args[2].u_obj, ndim, shape);
+    }
+    for(size_t i=0; i < lensos; i++) {
+        signal_sosfilt_array((mp_float_t *)y->array, coeffs + 6 * i, zf_array + 2 * channels * i, len, channels, istride, cstride);
+    }
+    m_del(mp_float_t, coeffs, 6 * lensos);
+
+    if(args[2].u_obj == mp_const_none) {
+        return MP_OBJ_FROM_PTR(y);
+    } else {
+        mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(2, NULL));
+        tuple->items[0] = MP_OBJ_FROM_PTR(y);
+        tuple->items[1] = MP_OBJ_FROM_PTR(zf);
+        return tuple;
+    }
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_sosfilt_obj, 2, signal_sosfilt);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_SOSFILT */
+
+#if ULAB_SCIPY_SIGNAL_HAS_SOSFILTER
+//| class SOSFilter:
+//|     """A cascade of second-order sections, which keeps its state between calls"""
+//|
+//|     def __init__(self, sos: _ArrayLike, *, zi: Optional[ulab.ndarray] = None) -> None:
+//|         """
+//|         :param sos: Array of second-order filter coefficients, must have shape (n_sections, 6)
+//|         :param ulab.ndarray zi: Optional initial conditions for the filter of shape (n_sections, 2)
+//|
+//|         The coefficients are parsed, and stored only once, so that processing a block
+//|         of samples allocates no memory, if the output array is supplied."""
+//|         ...
+//|
+
+static void signal_sosfilter_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    (void)kind;
+    signal_sosfilter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "SOSFilter(n_sections=%u)", (unsigned)self->nsections);
+}
+
+static mp_obj_t signal_sosfilter_make_new_core(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sos, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_zi, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    signal_sosfilter_obj_t *self = m_new_obj(signal_sosfilter_obj_t);
+    self->base.type = &signal_sosfilter_type;
+    self->coeffs = signal_sos_coefficients(args[0].u_obj, &self->nsections);
+    self->state = m_new0(mp_float_t, 2 * self->nsections);
+    if(args[1].u_obj != mp_const_none) {
+        signal_sos_state(self->state, args[1].u_obj, 2, ndarray_shape_vector(0, 0, self->nsections, 2));
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+
+#ifdef CIRCUITPY
+static mp_obj_t signal_sosfilter_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    (void)type;
+    return signal_sosfilter_make_new_core(n_args, args, kw_args);
+}
+#else
+static mp_obj_t signal_sosfilter_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    (void)type;
+    mp_map_t kw_args;
+    mp_map_init_fixed_table(&kw_args, n_kw, args + n_args);
+    return signal_sosfilter_make_new_core(n_args, args, &kw_args);
+}
+#endif
+
+//|     def process(self, x: _ArrayLike, *, out: Optional[ulab.ndarray] = None) -> ulab.ndarray:
+//|         """
+//|         :param x: The next block of the input signal
+//|         :param ulab.ndarray out: An optional dense, one-dimensional float array of the length of x
+//|
+//|         Filter the block x, and return the result. The state is carried over to the next
+//|         call, hence, filtering a signal block by block gives the same result as filtering it at once.
+//|         If out is given, the result is written into it, and out is returned. out can be x
+//|         itself, in which case the block is filtered in place."""
+//|         ...
+//|
+
+static mp_obj_t signal_sosfilter_process(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    signal_sosfilter_obj_t *self = MP_OBJ_TO_PTR(args[0].u_obj);
+    mp_obj_t x = args[1].u_obj;
+    size_t len = signal_input_length(x);
+
+    ndarray_obj_t *out;
+    if(args[2].u_obj == mp_const_none) {
+        out = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    } else {
+        if(!mp_obj_is_type(args[2].u_obj, &ulab_ndarray_type)) {
+            mp_raise_TypeError(translate("out must be an ndarray"));
+        }
+        out = MP_OBJ_TO_PTR(args[2].u_obj);
+        if((out->dtype != NDARRAY_FLOAT) || (out->ndim != 1) || (out->len != len) ||
+            (out->strides[ULAB_MAX_DIMS - 1] != (int32_t)out->itemsize)) {
+            mp_raise_ValueError(translate("out must be a dense float array of the length of the input"));
+        }
+    }
+    mp_float_t *array = (mp_float_t *)out->array;
+
+    // the input is copied into the output, which is then filtered in place; in-place filtering requires no copy
+    bool inplace = false;
+    if(mp_obj_is_type(x, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(x);
+        inplace = (ndarray->array == out->array) && (ndarray->strides[ULAB_MAX_DIMS - 1] == out->strides[ULAB_MAX_DIMS - 1]);
+    }
+    if(!inplace) {
+        signal_input_load(array, x);
+    }
+
+    for(size_t i=0; i < self->nsections; i++) {
+        signal_sosfilt_array(array, self->coeffs + 6 * i, self->state + 2 * i, len, 1, 1, 0);
+    }
+    return MP_OBJ_FROM_PTR(out);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_sosfilter_process_obj, 2, signal_sosfilter_process);
+
+//|     def reset(self) -> None:
+//|         """Set the state of the filter to 0"""
+//|         ...
+//|
+
+static mp_obj_t signal_sosfilter_reset(mp_obj_t self_in) {
+    signal_sosfilter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    memset(self->state, 0, 2 * self->nsections * sizeof(mp_float_t));
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(signal_sosfilter_reset_obj, signal_sosfilter_reset);
+
+static const mp_rom_map_elem_t signal_sosfilter_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_process), MP_ROM_PTR(&signal_sosfilter_process_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&signal_sosfilter_reset_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(signal_sosfilter_locals_dict, signal_sosfilter_locals_dict_table);
+
+const mp_obj_type_t signal_sosfilter_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_SOSFilter,
+    .print = signal_sosfilter_print,
+    .make_new = signal_sosfilter_make_new,
+    .locals_dict = (mp_obj_dict_t*)&signal_sosfilter_locals_dict,
+};
+#endif /* ULAB_SCIPY_SIGNAL_HAS_SOSFILTER */
+
+#if SIGNAL_HAS_LFILTER_KERNEL
+static mp_float_t *signal_lfilter_coefficients(mp_obj_t arg_b, mp_obj_t arg_a, size_t *order) {
+    // returns b, and a, padded with zeros to the length order + 1, and normalised by a[0]
+    if(!ndarray_object_is_array_like(arg_b) || !ndarray_object_is_array_like(arg_a)) {
+        mp_raise_TypeError(translate("b and a must be iterables"));
+    }
+    size_t lenb = (size_t)mp_obj_get_int(mp_obj_len_maybe(arg_b));
+    size_t lena = (size_t)mp_obj_get_int(mp_obj_len_maybe(arg_a));
+    if((lenb == 0) || (lena == 0)) {
+        mp_raise_ValueError(translate("b and a must not be empty"));
+    }
+    *order = MAX(lenb, lena) - 1;
+    mp_float_t *b = m_new0(mp_float_t, 2 * (*order + 1));
+    mp_float_t *a = b + *order + 1;
+    fill_array_iterable(b, arg_b);
+    fill_array_iterable(a, arg_a);
+    mp_float_t a0 = a[0];
+    if(a0 == MICROPY_FLOAT_CONST(0.0)) {
+        mp_raise_ValueError(translate("a[0] must not be 0"));
+    }
+    for(size_t i=0; i < 2 * (*order + 1); i++) {
+        b[i] /= a0;
+    }
+    return b;
+}
+
+static void signal_lfilter_array(mp_float_t *x, const size_t len, const mp_float_t *b, const mp_float_t *a, mp_float_t *z, const size_t order) {
+    // the transposed direct form II; z holds the order delays
+    for(size_t i=0; i < len; i++) {
+        mp_float_t xn = *x;
+        mp_float_t yn = b[0] * xn;
+        if(order > 0) {
+            yn += z[0];
+            for(size_t k=0; k < order - 1; k++) {
+                z[k] = z[k + 1] + b[k + 1] * xn - a[k + 1] * yn;
+            }
+            z[order - 1] = b[order] * xn - a[order] * yn;
+        }
+        *x++ = yn;
+    }
+}
+#endif /* SIGNAL_HAS_LFILTER_KERNEL */
+
+#if ULAB_SCIPY_SIGNAL_HAS_LFILTER_ZI || ULAB_SCIPY_SIGNAL_HAS_FILTFILT || ULAB_SCIPY_SIGNAL_HAS_SOSFILT_ZI || ULAB_SCIPY_SIGNAL_HAS_SOSFILTFILT
+static void signal_lfilter_zi_array(const mp_float_t *b, const mp_float_t *a, mp_float_t *zi, const size_t order) {
+    // the state of the normalised filter that belongs to the steady state of the step response,
+    // i.e., the solution of zi = A zi + B, calculated by the explicit formula given in scipy
+    if(order == 0) {
+        return;
+    }
+    mp_float_t asum = MICROPY_FLOAT_CONST(1.0), csum = MICROPY_FLOAT_CONST(0.0);
+    for(size_t k=1; k <= order; k++) {
+        asum += a[k];
+        csum += b[k] - a[k] * b[0];
+    }
+    if(asum == MICROPY_FLOAT_CONST(0.0)) {
+        mp_raise_ValueError(translate("the filter has a pole at z = 1"));
+    }
+    zi[0] = csum / asum;
+    asum = MICROPY_FLOAT_CONST(1.0);
+    csum = MICROPY_FLOAT_CONST(0.0);
+    for(size_t k=1; k < order; k++) {
+        asum += a[k];
+        csum += b[k] - a[k] * b[0];
+        zi[k] = asum * zi[0] - csum;
+    }
+}
+#endif
+
+#if ULAB_SCIPY_SIGNAL_HAS_SOSFILT_ZI || ULAB_SCIPY_SIGNAL_HAS_SOSFILTFILT
+static void signal_sosfilt_zi_array(const mp_float_t *coeffs, mp_float_t *zi, const size_t nsections) {
+    // the steady state of each section is scaled by the gain of the preceding sections at z = 1
+    mp_float_t scale = MICROPY_FLOAT_CONST(1.0);
+    for(size_t i=0; i < nsections; i++) {
+        signal_lfilter_zi_array(coeffs, coeffs + 3, zi, 2);
+        zi[0] *= scale;
+        zi[1] *= scale;
+        scale *= (coeffs[0] + coeffs[1] + coeffs[2]) / (coeffs[3] + coeffs[4] + coeffs[5]);
+        coeffs += 6;
+        zi += 2;
+    }
+}
+#endif
+
+#if ULAB_SCIPY_SIGNAL_HAS_LFILTER
+//| def lfilter(b: _ArrayLike, a: _ArrayLike, x: _ArrayLike, *, zi: Optional[_ArrayLike] = None) -> Union[ulab.ndarray, Tuple[ulab.ndarray, ulab.ndarray]]:
+//|     """
+//|     :param b: The coefficients of the numerator
+//|     :param a: The coefficients of the denominator; a[0] must not be 0
+//|     :param x: A one-dimensional array, or iterable
+//|     :param zi: Optional initial conditions of length max(len(a), len(b)) - 1
+//|
+//|     Filter x by means of the transposed direct form II implementation of the filter
+//|     defined by b, and a. If zi is given, the final state is returned as the second
+//|     element of a tuple."""
+//|     ...
+//|
+
+mp_obj_t signal_lfilter(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_b, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_a, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_zi, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t order;
+    mp_float_t *b = signal_lfilter_coefficients(args[0].u_obj, args[1].u_obj, &order);
+    size_t len = signal_input_length(args[2].u_obj);
+    ndarray_obj_t *y = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    signal_input_load((mp_float_t *)y->array, args[2].u_obj);
+
+    ndarray_obj_t *zf = ndarray_new_linear_array(order, NDARRAY_FLOAT);
+    if(args[3].u_obj != mp_const_none) {
+        if(!ndarray_object_is_array_like(args[3].u_obj) || ((size_t)mp_obj_get_int(mp_obj_len_maybe(args[3].u_obj)) != order)) {
+            mp_raise_ValueError(translate("zi must be of length max(len(a), len(b)) - 1"));
+        }
+        fill_array_iterable((mp_float_t *)zf->array, args[3].u_obj);
+    }
+    signal_lfilter_array((mp_float_t *)y->array, len, b, b + order + 1, (mp_float_t *)zf->array, order);
+    m_del(mp_float_t, b, 2 * (order + 1));
+
+    if(args[3].u_obj == mp_const_none) {
+        return MP_OBJ_FROM_PTR(y);
+    }
+    mp_obj_t tuple[2];
+    tuple[0] = MP_OBJ_FROM_PTR(y);
+    tuple[1] = MP_OBJ_FROM_PTR(zf);
+    return mp_obj_new_tuple(2, tuple);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_lfilter_obj, 3, signal_lfilter);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_LFILTER */
+
+#if ULAB_SCIPY_SIGNAL_HAS_LFILTER_ZI
+//| def lfilter_zi(b: _ArrayLike, a: _ArrayLike) -> ulab.ndarray:
+//|     """
+//|     :param b: The coefficients of the numerator
+//|     :param a: The coefficients of the denominator
+//|
+//|     Return the initial state of ``lfilter`` that corresponds to the steady state of the
+//|     step response. Multiplied by x[0], it starts the filter without a transient."""
+//|     ...
+//|
+
+mp_obj_t signal_lfilter_zi(mp_obj_t arg_b, mp_obj_t arg_a) {
+    size_t order;
+    mp_float_t *b = signal_lfilter_coefficients(arg_b, arg_a, &order);
+    ndarray_obj_t *zi = ndarray_new_linear_array(order, NDARRAY_FLOAT);
+    signal_lfilter_zi_array(b, b + order + 1, (mp_float_t *)zi->array, order);
+    m_del(mp_float_t, b, 2 * (order + 1));
+    return MP_OBJ_FROM_PTR(zi);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(signal_lfilter_zi_obj, signal_lfilter_zi);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_LFILTER_ZI */
+
+#if ULAB_SCIPY_SIGNAL_HAS_FILTFILT
+//| def filtfilt(b: _ArrayLike, a: _ArrayLike, x: _ArrayLike, *, padlen: Optional[int] = None) -> ulab.ndarray:
+//|     """
+//|     :param b: The coefficients of the numerator
+//|     :param a: The coefficients of the denominator
+//|     :param x: A one-dimensional array, or iterable
+//|     :param int padlen: The number of samples, by which x is extended at both ends, 3 * max(len(a), len(b)) by default
+//|
+//|     Apply the filter forward, and then backward, so that the result has no phase shift.
+//|     The input is extended by its odd reflection at both ends, and both passes start
+//|     from the steady state given by ``lfilter_zi``, as in scipy with padtype='odd'."""
+//|     ...
+//|
+
+mp_obj_t signal_filtfilt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_b, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_a, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_padlen, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t order;
+    mp_float_t *b = signal_lfilter_coefficients(args[0].u_obj, args[1].u_obj, &order);
+    mp_float_t *a = b + order + 1;
+    size_t len = signal_input_length(args[2].u_obj);
+    size_t edge = signal_padlen(args[3].u_obj, 3 * (order + 1), len);
+    if(len == 0) {
+        mp_raise_ValueError(translate("input must not be empty"));
+    }
+
+    size_t total = len + 2 * edge;
+    mp_float_t *ext = m_new(mp_float_t, total);
+    signal_input_load(ext + edge, args[2].u_obj);
+    signal_odd_extension(ext, len, edge);
+
+    mp_float_t *zi = m_new(mp_float_t, 2 * order);
+    mp_float_t *z = zi + order;
+    signal_lfilter_zi_array(b, a, zi, order);
+    for(uint8_t pass=0; pass < 2; pass++) {
+        // the second pass runs on the reversed output of the first one
+        for(size_t k=0; k < order; k++) {
+            z[k] = zi[k] * ext[0];
+        }
+        signal_lfilter_array(ext, total, b, a, z, order);
+        signal_reverse(ext, total);
+    }
+
+    ndarray_obj_t *y = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    memcpy(y->array, ext + edge, len * sizeof(mp_float_t));
+    m_del(mp_float_t, ext, total);
+    m_del(mp_float_t, zi, 2 * order);
+    m_del(mp_float_t, b, 2 * (order + 1));
+    return MP_OBJ_FROM_PTR(y);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_filtfilt_obj, 3, signal_filtfilt);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_FILTFILT */
+
+#if ULAB_SCIPY_SIGNAL_HAS_SOSFILT_ZI
+//| def sosfilt_zi(sos: _ArrayLike) -> ulab.ndarray:
+//|     """
+//|     :param sos: Array of second-order filter coefficients, must have shape (n_sections, 6)
+//|
+//|     Return the initial state of ``sosfilt`` of shape (n_sections, 2) that corresponds to
+//|     the steady state of the step response."""
+//|     ...
+//|
+
+mp_obj_t signal_sosfilt_zi(mp_obj_t arg_sos) {
+    size_t nsections;
+    mp_float_t *coeffs = signal_sos_coefficients(arg_sos, &nsections);
+    ndarray_obj_t *zi = ndarray_new_dense_ndarray(2, ndarray_shape_vector(0, 0, nsections, 2), NDARRAY_FLOAT);
+    signal_sosfilt_zi_array(coeffs, (mp_float_t *)zi->array, nsections);
+    m_del(mp_float_t, coeffs, 6 * nsections);
+    return MP_OBJ_FROM_PTR(zi);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(signal_sosfilt_zi_obj, signal_sosfilt_zi);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_SOSFILT_ZI */
+
+#if ULAB_SCIPY_SIGNAL_HAS_SOSFILTFILT
+//| def sosfiltfilt(sos: _ArrayLike, x: _ArrayLike, *, padlen: Optional[int] = None) -> ulab.ndarray:
+//|     """
+//|     :param sos: Array of second-order filter coefficients, must have shape (n_sections, 6)
+//|     :param x: A one-dimensional array, or iterable
+//|     :param int padlen: The number of samples, by which x is extended at both ends
+//|
+//|     The same as ``filtfilt``, but the filter is given by its second-order sections.
+//|     The default of padlen is the same as in scipy."""
+//|     ...
+//|
+
+mp_obj_t signal_sosfiltfilt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sos, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_padlen, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t nsections;
+    mp_float_t *coeffs = signal_sos_coefficients(args[0].u_obj, &nsections);
+    // as in scipy, sections with b2 = 0, and a2 = 0 are taken to be of the first order
+    size_t b2zeros = 0, a2zeros = 0;
+    for(size_t i=0; i < nsections; i++) {
+        b2zeros += coeffs[6 * i + 2] == MICROPY_FLOAT_CONST(0.0) ? 1 : 0;
+        a2zeros += coeffs[6 * i + 5] == MICROPY_FLOAT_CONST(0.0) ? 1 : 0;
+    }
+    size_t ntaps = 2 * nsections + 1 - MIN(b2zeros, a2zeros);
+    size_t len = signal_input_length(args[1].u_obj);
+    size_t edge = signal_padlen(args[2].u_obj, 3 * ntaps, len);
+    if(len == 0) {
+        mp_raise_ValueError(translate("input must not be empty"));
+    }
+
+    size_t total = len + 2 * edge;
+    mp_float_t *ext = m_new(mp_float_t, total);
+    signal_input_load(ext + edge, args[1].u_obj);
+    signal_odd_extension(ext, len, edge);
+
+    mp_float_t *zi = m_new(mp_float_t, 4 * nsections);
+    mp_float_t *z = zi + 2 * nsections;
+    signal_sosfilt_zi_array(coeffs, zi, nsections);
+    for(uint8_t pass=0; pass < 2; pass++) {
+        for(size_t k=0; k < 2 * nsections; k++) {
+            z[k] = zi[k] * ext[0];
+        }
+        for(size_t i=0; i < nsections; i++) {
+            signal_sosfilt_array(ext, coeffs + 6 * i, z + 2 * i, total, 1, 1, 0);
+        }
+        signal_reverse(ext, total);
+    }
+
+    ndarray_obj_t *y = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    memcpy(y->array, ext + edge, len * sizeof(mp_float_t));
+    m_del(mp_float_t, ext, total);
+    m_del(mp_float_t, zi, 4 * nsections);
+    m_del(mp_float_t, coeffs, 6 * nsections);
+    return MP_OBJ_FROM_PTR(y);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_sosfiltfilt_obj, 2, signal_sosfiltfilt);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_SOSFILTFILT */
+
+#if SIGNAL_HAS_FIXED_POINT
+// the fixed-point kernels work on int16 (Q15), or int32 (Q31) samples; the products are accumulated
+// in 64 bits, rounded, shifted right by the number of fractional bits of the coefficients, and
+// saturated to the range of the sample type, i.e., a shift of s allows for coefficients of up to 2**s
+
+#define SIGNAL_FIXED_SATURATE(acc, min, max) ((acc) < (min) ? (min) : ((acc) > (max) ? (max) : (acc)))
+
+static uint8_t signal_fixed_bits(ndarray_obj_t *x, mp_int_t shift) {
+    // returns the number of fractional bits of the coefficients
+    uint8_t q;
+    if(x->dtype == NDARRAY_INT16) {
+        q = 15;
+    } else if(x->dtype == NDARRAY_INT32) {
+        q = 31;
+    } else {
+        mp_raise_TypeError(translate("input must be an int16, or int32 array"));
+    }
+    if((shift < 0) || (shift >= q)) {
+        mp_raise_ValueError(translate("shift is out of range"));
+    }
+    return q - (uint8_t)shift;
+}
+
+static int32_t *signal_fixed_coefficients(const mp_float_t *coeffs, size_t len, uint8_t bits, uint8_t itemsize) {
+    // rounds the coefficients to bits fractional bits; the results must fit into the sample type
+    int32_t *fixed = m_new(int32_t, len);
+    mp_float_t scale = (mp_float_t)((int64_t)1 << bits);
+    mp_float_t limit = (mp_float_t)((int64_t)1 << (8 * itemsize - 1));
+    for(size_t i=0; i < len; i++) {
+        mp_float_t c = MICROPY_FLOAT_C_FUN(round)(coeffs[i] * scale);
+        if((c < -limit) || (c >= limit)) {
+            mp_raise_ValueError(translate("coefficients are out of the fixed-point range, increase shift"));
+        }
+        fixed[i] = (int32_t)c;
+    }
+    return fixed;
+}
+
+static ndarray_obj_t *signal_fixed_output(mp_obj_t arg_x, mp_obj_t arg_out) {
+    // returns the dense array, into which the input has been copied; if out is x, no copy is made
+    if(!mp_obj_is_type(arg_x, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("input must be an int16, or int32 array"));
+    }
+    ndarray_obj_t *x = MP_OBJ_TO_PTR(arg_x);
+    #if ULAB_MAX_DIMS > 1
+    if(x->ndim != 1) {
+        mp_raise_ValueError(translate("input must be one-dimensional"));
+    }
+    #endif
+    ndarray_obj_t *out;
+    if(arg_out == mp_const_none) {
+        out = ndarray_new_linear_array(x->len, x->dtype);
+    } else {
+        if(!mp_obj_is_type(arg_out, &ulab_ndarray_type)) {
+            mp_raise_TypeError(translate("out must be an ndarray"));
+        }
+        out = MP_OBJ_TO_PTR(arg_out);
+        if((out->dtype != x->dtype) || (out->ndim != 1) || (out->len != x->len) ||
+            (out->strides[ULAB_MAX_DIMS - 1] != (int32_t)out->itemsize)) {
+            mp_raise_ValueError(translate("out must be a dense array of the dtype and length of the input"));
+        }
+    }
+    if((out->array != x->array) || (x->strides[ULAB_MAX_DIMS - 1] != out->strides[ULAB_MAX_DIMS - 1])) {
+        uint8_t *iarray = (uint8_t *)x->array;
+        uint8_t *oarray = (uint8_t *)out->array;
+        for(size_t i=0; i < x->len; i++) {
+            memcpy(oarray, iarray, x->itemsize);
+            iarray += x->strides[ULAB_MAX_DIMS - 1];
+            oarray += out->itemsize;
+        }
+    }
+    return out;
+}
+
+static ndarray_obj_t *signal_fixed_state(int32_t *state, mp_obj_t arg_zi, ndarray_obj_t *x, uint8_t ndim, size_t *shape) {
+    // returns the array of the final state, and copies zi into state, if it is supplied
+    ndarray_obj_t *zf = ndarray_new_dense_ndarray(ndim, shape, x->dtype);
+    if(arg_zi == mp_const_none) {
+        return zf;
+    }
+    if(!mp_obj_is_type(arg_zi, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("zi must be an ndarray"));
+    }
+    ndarray_obj_t *zi = MP_OBJ_TO_PTR(arg_zi);
+    bool equal = zi->ndim == ndim;
+    for(uint8_t i = ULAB_MAX_DIMS; equal && (i > ULAB_MAX_DIMS - ndim); i--) {
+        equal = zi->shape[i - 1] == shape[i - 1];
+    }
+    if(!equal) {
+        mp_raise_ValueError(translate("zi has the wrong shape"));
+    }
+    if(zi->dtype != x->dtype) {
+        mp_raise_TypeError(translate("zi must be of the dtype of the input"));
+    }
+    size_t rows = 1;
+    int32_t rstride = 0;
+    #if ULAB_MAX_DIMS > 1
+    if(ndim == 2) {
+        rows = zi->shape[ULAB_MAX_DIMS - 2];
+        rstride = zi->strides[ULAB_MAX_DIMS - 2];
+    }
+    #endif
+    uint8_t *array = (uint8_t *)zi->array;
+    for(size_t j=0; j < rows; j++) {
+        uint8_t *element = array;
+        for(size_t k=0; k < zi->shape[ULAB_MAX_DIMS - 1]; k++) {
+            *state++ = zi->dtype == NDARRAY_INT16 ? *((int16_t *)element) : *((int32_t *)element);
+            element += zi->strides[ULAB_MAX_DIMS - 1];
+        }
+        array += rstride;
+    }
+    return zf;
+}
+
+static void signal_fixed_store(ndarray_obj_t *zf, const int32_t *state) {
+    if(zf->dtype == NDARRAY_INT16) {
+        int16_t *array = (int16_t *)zf->array;
+        for(size_t i=0; i < zf->len; i++) {
+            *array++ = (int16_t)*state++;
+        }
+    } else {
+        memcpy(zf->array, state, zf->len * sizeof(int32_t));
+    }
+}
+
+static mp_obj_t signal_fixed_result(ndarray_obj_t *y, ndarray_obj_t *zf, mp_obj_t arg_zi) {
+    if(arg_zi == mp_const_none) {
+        return MP_OBJ_FROM_PTR(y);
+    }
+    mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(2, NULL));
+    tuple->items[0] = MP_OBJ_FROM_PTR(y);
+    tuple->items[1] = MP_OBJ_FROM_PTR(zf);
+    return MP_OBJ_FROM_PTR(tuple);
+}
+#endif /* SIGNAL_HAS_FIXED_POINT */
+
+#if ULAB_SCIPY_SIGNAL_HAS_SOSFILT_FIXED
+// direct form I section, whose state, x[n-1], x[n-2], y[n-1], y[n-2], is kept in the sample type,
+// so that the saturated output is fed back
+#define SIGNAL_SOSFILT_FIXED_LOOP(type, min, max)\
+({\
+    type *x = (type *)array;\
+    for(size_t i=0; i < len; i++) {\
+        int64_t acc = round + (int64_t)b0 * x[i] + (int64_t)b1 * x1 + (int64_t)b2 * x2\
+                        - (int64_t)a1 * y1 - (int64_t)a2 * y2;\
+        acc >>= bits;\
+        acc = SIGNAL_FIXED_SATURATE(acc, (min), (max));\
+        x2 = x1;\
+        x1 = x[i];\
+        y2 = y1;\
+        y1 = (int32_t)acc;\
+        x[i] = (type)acc;\
+    }\
+})
+
+static void signal_sosfilt_fixed_array(void *array, uint8_t dtype, const size_t len, const int32_t *coeffs,
+                                        int32_t *state, const uint8_t bits) {
+    const int64_t round = (int64_t)1 << (bits - 1);
+    const int32_t b0 = coeffs[0], b1 = coeffs[1], b2 = coeffs[2], a1 = coeffs[3], a2 = coeffs[4];
+    int32_t x1 = state[0], x2 = state[1], y1 = state[2], y2 = state[3];
+    if(dtype == NDARRAY_INT16) {
+        SIGNAL_SOSFILT_FIXED_LOOP(int16_t, INT16_MIN, INT16_MAX);
+    } else {
+        SIGNAL_SOSFILT_FIXED_LOOP(int32_t, INT32_MIN, INT32_MAX);
+    }
+    state[0] = x1;
+    state[1] = x2;
+    state[2] = y1;
+    state[3] = y2;
+}
+
+//| def sosfilt_fixed(sos: _ArrayLike, x: ulab.ndarray, *, shift: int = 0, zi: Optional[ulab.ndarray] = None, out: Optional[ulab.ndarray] = None) -> Union[ulab.ndarray, Tuple[ulab.ndarray, ulab.ndarray]]:
+//|     """
+//|     :param ulab.ndarray sos: Array of second-order filter coefficients, must have shape (n_sections, 6)
+//|     :param ulab.ndarray x: The input signal, a one-dimensional array of dtype int16 (Q15), or int32 (Q31)
+//|     :param int shift: The coefficients are stored with shift fewer fractional bits, so that their magnitude can be up to 2**shift
+//|     :param ulab.ndarray zi: Optional initial conditions of shape (n_sections, 4), and of the dtype of x
+//|     :param ulab.ndarray out: Optional output array; if it is x, the input is filtered in place
+//|
+//|     Filter x by means of a cascade of second-order sections in fixed-point arithmetic. The
+//|     sections are of direct form I, and the output of each section is saturated. The state of
+//|     a section is x[n-1], x[n-2], y[n-1], y[n-2]. If zi is given, the final state is returned
+//|     as the second element of a tuple. int32 input should leave two bits of headroom, otherwise
+//|     the accumulator can overflow."""
+//|     ...
+//|
+
+mp_obj_t signal_sosfilt_fixed(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sos, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_shift, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0 } },
+        { MP_QSTR_zi, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *y = signal_fixed_output(args[1].u_obj, args[4].u_obj);
+    uint8_t bits = signal_fixed_bits(y, args[2].u_int);
+
+    size_t nsections;
+    mp_float_t *coeffs = signal_sos_coefficients(args[0].u_obj, &nsections);
+    // a0 is dropped, and b0, b1, b2, a1, a2 are packed in place
+    for(size_t i=0; i < nsections; i++) {
+        for(uint8_t j=0; j < 5; j++) {
+            coeffs[5 * i + j] = coeffs[6 * i + j + (j > 2)];
+        }
+    }
+    int32_t *fixed = signal_fixed_coefficients(coeffs, 5 * nsections, bits, y->itemsize);
+    m_del(mp_float_t, coeffs, 6 * nsections);
+
+    int32_t *state = m_new0(int32_t, 4 * nsections);
+    #if ULAB_MAX_DIMS > 1
+    ndarray_obj_t *zf = signal_fixed_state(state, args[3].u_obj, y, 2, ndarray_shape_vector(0, 0, nsections, 4));
+    #else
+    ndarray_obj_t *zf = signal_fixed_state(state, args[3].u_obj, y, 1, ndarray_shape_vector(0, 0, 0, 4 * nsections));
+    #endif
+
+    for(size_t i=0; i < nsections; i++) {
+        signal_sosfilt_fixed_array(y->array, y->dtype, y->len, fixed + 5 * i, state + 4 * i, bits);
+    }
+    signal_fixed_store(zf, state);
+    m_del(int32_t, fixed, 5 * nsections);
+    m_del(int32_t, state, 4 * nsections);
+    return signal_fixed_result(y, zf, args[3].u_obj);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_sosfilt_fixed_obj, 2, signal_sosfilt_fixed);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_SOSFILT_FIXED */
+
+#if ULAB_SCIPY_SIGNAL_HAS_FIRFILT_FIXED
+// the outputs are calculated from the last towards the first, hence y[n] can overwrite x[n],
+// which is not needed by the outputs still to be calculated; the samples preceding x[0] are
+// taken from the state, which is updated before the input is overwritten
+#define SIGNAL_FIRFILT_FIXED_LOOP(type, min, max)\
+({\
+    type *x = (type *)array;\
+    for(size_t j=0; j < ntaps - 1; j++) {\
+        size_t k = len + j;\
+        zf[j] = k < ntaps - 1 ? state[k] : x[k - ntaps + 1];\
+    }\
+    for(size_t n=len; n-- > 0;) {\
+        int64_t acc = round;\
+        size_t k = 0;\
+        for(; (k < ntaps) && (k <= n); k++) {\
+            acc += (int64_t)taps[k] * x[n - k];\
+        }\
+        for(; k < ntaps; k++) {\
+            acc += (int64_t)taps[k] * state[ntaps - 1 + n - k];\
+        }\
+        acc >>= bits;\
+        x[n] = (type)SIGNAL_FIXED_SATURATE(acc, (min), (max));\
+    }\
+})
+
+static void signal_firfilt_fixed_array(void *array, uint8_t dtype, const size_t len, const int32_t *taps, const size_t ntaps,
+                                        int32_t *state, const uint8_t bits) {
+    // state holds the ntaps - 1 samples preceding the input, the oldest first
+    const int64_t round = (int64_t)1 << (bits - 1);
+    int32_t *zf = m_new(int32_t, ntaps - 1);
+    if(dtype == NDARRAY_INT16) {
+        SIGNAL_FIRFILT_FIXED_LOOP(int16_t, INT16_MIN, INT16_MAX);
+    } else {
+        SIGNAL_FIRFILT_FIXED_LOOP(int32_t, INT32_MIN, INT32_MAX);
+    }
+    memcpy(state, zf, (ntaps - 1) * sizeof(int32_t));
+    m_del(int32_t, zf, ntaps - 1);
+}
+
+//| def firfilt_fixed(h: _ArrayLike, x: ulab.ndarray, *, shift: int = 0, zi: Optional[ulab.ndarray] = None, out: Optional[ulab.ndarray] = None) -> Union[ulab.ndarray, Tuple[ulab.ndarray, ulab.ndarray]]:
+//|     """
+//|     :param ulab.ndarray h: The taps of the FIR filter
+//|     :param ulab.ndarray x: The input signal, a one-dimensional array of dtype int16 (Q15), or int32 (Q31)
+//|     :param int shift: The taps are stored with shift fewer fractional bits, so that their magnitude can be up to 2**shift
+//|     :param ulab.ndarray zi: Optional initial conditions, the len(h) - 1 samples preceding x, of the dtype of x
+//|     :param ulab.ndarray out: Optional output array; if it is x, the input is filtered in place
+//|
+//|     Filter x with the FIR filter h in fixed-point arithmetic, with a saturated output. The result
+//|     is equal to that of lfilter(h, 1.0, x) up to rounding. If zi is given, the final state is
+//|     returned as the second element of a tuple."""
+//|     ...
+//|
+
+mp_obj_t signal_firfilt_fixed(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_h, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_shift, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0 } },
+        { MP_QSTR_zi, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!ndarray_object_is_array_like(args[0].u_obj)) {
+        mp_raise_TypeError(translate("taps must be an ndarray, or an iterable"));
+    }
+    ndarray_obj_t *y = signal_fixed_output(args[1].u_obj, args[4].u_obj);
+    uint8_t bits = signal_fixed_bits(y, args[2].u_int);
+
+    size_t ntaps = (size_t)mp_obj_get_int(mp_obj_len_maybe(args[0].u_obj));
+    if(ntaps == 0) {
+        mp_raise_ValueError(translate("taps must not be empty"));
+    }
+    mp_float_t *h = m_new(mp_float_t, ntaps);
+    fill_array_iterable(h, args[0].u_obj);
+    int32_t *taps = signal_fixed_coefficients(h, ntaps, bits, y->itemsize);
+    m_del(mp_float_t, h, ntaps);
+
+    int32_t *state = m_new0(int32_t, ntaps);
+    ndarray_obj_t *zf = signal_fixed_state(state, args[3].u_obj, y, 1, ndarray_shape_vector(0, 0, 0, ntaps - 1));
+
+    signal_firfilt_fixed_array(y->array, y->dtype, y->len, taps, ntaps, state, bits);
+    signal_fixed_store(zf, state);
+    m_del(int32_t, taps, ntaps);
+    m_del(int32_t, state, ntaps);
+    return signal_fixed_result(y, zf, args[3].u_obj);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_firfilt_fixed_obj, 2, signal_firfilt_fixed);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_FIRFILT_FIXED */
+
+#if SIGNAL_HAS_POLYPHASE
+static void signal_upfirdn_array(mp_float_t *y, const size_t ny, const mp_float_t *x, const size_t nx,
+                                    const mp_float_t *h, const size_t nh, const size_t up, const size_t down, mp_int_t n) {
+    // calculates ny outputs of the polyphase filter, i.e., y[i] = sum_k h[k] xu[n + i * down - k],
+    // where xu is x upsampled by up, with up - 1 zeros inserted after each sample; the samples
+    // that are dropped by the downsampling are never calculated, and out of the up taps, only
+    // those that meet a non-zero sample of xu are multiplied
+    for(size_t i=0; i < ny; i++) {
+        mp_float_t acc = MICROPY_FLOAT_CONST(0.0);
+        if(n >= 0) {
+            size_t k = (size_t)n % up;
+            size_t j = (size_t)n / up;
+            if(j >= nx) {
+                k += (j - nx + 1) * up;
+                j = nx - 1;
+            }
+            for(; k < nh; k += up) {
+                acc += h[k] * x[j];
+                if(j-- == 0) {
+                    break;
+                }
+            }
+        }
+        y[i] = acc;
+        n += down;
+    }
+}
+
+static mp_float_t *signal_upfirdn_taps(mp_obj_t arg_h, size_t *nh) {
+    *nh = signal_input_length(arg_h);
+    if(*nh == 0) {
+        mp_raise_ValueError(translate("h must not be empty"));
+    }
+    mp_float_t *h = m_new(mp_float_t, *nh);
+    signal_input_load(h, arg_h);
+    return h;
+}
+
+static void signal_upfirdn_rates(mp_int_t up, mp_int_t down) {
+    if((up < 1) || (down < 1)) {
+        mp_raise_ValueError(translate("up and down must be positive"));
+    }
+}
+#endif /* SIGNAL_HAS_POLYPHASE */
+
+#if SIGNAL_HAS_FIRWIN
+static void signal_firwin_taps(mp_float_t *h, const size_t ntaps, const mp_float_t *edges, const size_t nedges, const bool scale) {
+    // windowed sinc filter, as in scipy.signal.firwin: on entry, h holds the window; edges are
+    // the left and right edges of the passbands, relative to the Nyquist frequency; if scale is
+    // true, the gain is unity at the centre of the first passband, or at DC, or at Nyquist,
+    // whichever is relevant
+    mp_float_t fscale = MICROPY_FLOAT_CONST(0.5) * (edges[0] + edges[1]);
+    if(edges[0] == MICROPY_FLOAT_CONST(0.0)) {
+        fscale = MICROPY_FLOAT_CONST(0.0);
+    } else if(edges[1] == MICROPY_FLOAT_CONST(1.0)) {
+        fscale = MICROPY_FLOAT_CONST(1.0);
+    }
+    mp_float_t alpha = (mp_float_t)(ntaps - 1) / MICROPY_FLOAT_CONST(2.0);
+    mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+    for(size_t i=0; i < ntaps; i++) {
+        mp_float_t m = (mp_float_t)i - alpha;
+        mp_float_t response = MICROPY_FLOAT_CONST(0.0);
+        for(size_t j=0; j < nedges; j++) {
+            // f * sinc(f * m), added for the right edges, and subtracted for the left edges
+            mp_float_t x = MP_PI * edges[j] * m;
+            mp_float_t term = x == MICROPY_FLOAT_CONST(0.0) ? edges[j] : MICROPY_FLOAT_C_FUN(sin)(x) / (MP_PI * m);
+            response += (j & 1) ? term : -term;
+        }
+        h[i] *= response;
+        sum += h[i] * MICROPY_FLOAT_C_FUN(cos)(MP_PI * m * fscale);
+    }
+    if(scale) {
+        for(size_t i=0; i < ntaps; i++) {
+            h[i] /= sum;
+        }
+    }
+}
+#endif /* SIGNAL_HAS_FIRWIN */
+
+#if ULAB_SCIPY_SIGNAL_HAS_RESAMPLE_POLY || ULAB_SCIPY_SIGNAL_HAS_DECIMATE
+static void signal_lowpass_taps(mp_float_t *h, const size_t ntaps, const mp_float_t cutoff, const mp_float_t beta) {
+    // lowpass filter with unit gain at DC; the window is the symmetric Kaiser window for
+    // beta > 0, and the symmetric Hamming window otherwise
+    mp_float_t edges[2] = { MICROPY_FLOAT_CONST(0.0), cutoff };
+    window_fill(h, ntaps, beta > MICROPY_FLOAT_CONST(0.0) ? WINDOW_KAISER : WINDOW_HAMMING, beta, false);
+    signal_firwin_taps(h, ntaps, edges, 2, true);
+}
+
+static ndarray_obj_t *signal_resample_poly_array(mp_obj_t arg_x, size_t up, size_t down, mp_float_t *h, size_t nh) {
+    // zero-phase resampling, as in scipy.signal.resample_poly: the filter, whose gain is scaled
+    // by up, is centred on the output samples, hence the first output is the sample at the
+    // middle of the filter, and the length of the output is ceil(len(x) * up / down)
+    size_t nx = signal_input_length(arg_x);
+    mp_float_t *x = m_new(mp_float_t, nx);
+    signal_input_load(x, arg_x);
+    for(size_t i=0; i < nh; i++) {
+        h[i] *= (mp_float_t)up;
+    }
+    size_t ny = (nx * up + down - 1) / down;
+    ndarray_obj_t *y = ndarray_new_linear_array(ny, NDARRAY_FLOAT);
+    signal_upfirdn_array((mp_float_t *)y->array, ny, x, nx, h, nh, up, down, (mp_int_t)((nh - 1) / 2));
+    m_del(mp_float_t, x, nx);
+    return y;
+}
+#endif
+
+#if ULAB_SCIPY_SIGNAL_HAS_UPFIRDN
+//| def upfirdn(h: _ArrayLike, x: _ArrayLike, up: int = 1, down: int = 1) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray h: The taps of the FIR filter
+//|     :param ulab.ndarray x: The input signal
+//|     :param int up: The upsampling rate
+//|     :param int down: The downsampling rate
+//|
+//|     Upsample x by inserting up - 1 zeros after each sample, filter the result with h,
+//|     and keep every down-th sample. Only the retained samples are calculated, by means of
+//|     a polyphase decomposition of h. The length of the output is
+//|     ceil(((len(x) - 1) * up + len(h)) / down)."""
+//|     ...
+//|
+
+mp_obj_t signal_upfirdn(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_h, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_up, MP_ARG_INT, {.u_int = 1 } },
+        { MP_QSTR_down, MP_ARG_INT, {.u_int = 1 } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    signal_upfirdn_rates(args[2].u_int, args[3].u_int);
+    size_t up = (size_t)args[2].u_int, down = (size_t)args[3].u_int;
+
+    size_t nh;
+    mp_float_t *h = signal_upfirdn_taps(args[0].u_obj, &nh);
+    size_t nx = signal_input_length(args[1].u_obj);
+    mp_float_t *x = m_new(mp_float_t, nx);
+    signal_input_load(x, args[1].u_obj);
+
+    size_t ny = nx == 0 ? 0 : ((nx - 1) * up + nh + down - 1) / down;
+    ndarray_obj_t *y = ndarray_new_linear_array(ny, NDARRAY_FLOAT);
+    signal_upfirdn_array((mp_float_t *)y->array, ny, x, nx, h, nh, up, down, 0);
+
+    m_del(mp_float_t, x, nx);
+    m_del(mp_float_t, h, nh);
+    return MP_OBJ_FROM_PTR(y);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_upfirdn_obj, 2, signal_upfirdn);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_UPFIRDN */
+
+#if ULAB_SCIPY_SIGNAL_HAS_UPFIRDN_CLASS
+//| class UpFIRDn:
+//|     """A polyphase filter, which upsamples, filters, and downsamples a stream of samples"""
+//|
+//|     def __init__(self, h: _ArrayLike, up: int = 1, down: int = 1) -> None:
+//|         """
+//|         :param ulab.ndarray h: The taps of the FIR filter
+//|         :param int up: The upsampling rate
+//|         :param int down: The downsampling rate
+//|
+//|         The filter keeps the len(h) // up most recent samples of the input, and the phase
+//|         of the downsampling between calls, hence, the concatenated outputs of the blocks are
+//|         equal to the leading samples of upfirdn(h, x, up, down) of the whole signal."""
+//|         ...
+//|
+
+static void signal_upfirdn_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    (void)kind;
+    signal_upfirdn_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "UpFIRDn(n_taps=%u, up=%u, down=%u)", (unsigned)self->ntaps, (unsigned)self->up, (unsigned)self->down);
+}
+
+static mp_obj_t signal_upfirdn_make_new_core(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_h, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_up, MP_ARG_INT, {.u_int = 1 } },
+        { MP_QSTR_down, MP_ARG_INT, {.u_int = 1 } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    signal_upfirdn_rates(args[1].u_int, args[2].u_int);
+    signal_upfirdn_obj_t *self = m_new_obj(signal_upfirdn_obj_t);
+    self->base.type = &signal_upfirdn_type;
+    self->up = (size_t)args[1].u_int;
+    self->down = (size_t)args[2].u_int;
+    self->taps = signal_upfirdn_taps(args[0].u_obj, &self->ntaps);
+    self->nhistory = (self->ntaps - 1) / self->up;
+    self->history = m_new0(mp_float_t, self->nhistory);
+    self->phase = 0;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+#ifdef CIRCUITPY
+static mp_obj_t signal_upfirdn_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    (void)type;
+    return signal_upfirdn_make_new_core(n_args, args, kw_args);
+}
+#else
+static mp_obj_t signal_upfirdn_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    (void)type;
+    mp_map_t kw_args;
+    mp_map_init_fixed_table(&kw_args, n_kw, args + n_args);
+    return signal_upfirdn_make_new_core(n_args, args, &kw_args);
+}
+#endif
+
+//|     def process(self, x: _ArrayLike) -> ulab.ndarray:
+//|         """
+//|         :param x: The next block of the input signal
+//|
+//|         Return the output samples that are due with the arrival of the block x. With a
+//|         block of length n, these are either floor(n * up / down), or ceil(n * up / down) samples."""
+//|         ...
+//|
+
+static mp_obj_t signal_upfirdn_process(mp_obj_t self_in, mp_obj_t x) {
+    signal_upfirdn_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t len = signal_input_length(x);
+
+    // the history is prepended to the block, so that the kernel can reach back into the previous blocks;
+    // phase is the position of the next output in the upsampled block
+    size_t total = self->nhistory + len;
+    mp_float_t *array = m_new(mp_float_t, total);
+    memcpy(array, self->history, self->nhistory * sizeof(mp_float_t));
+    signal_input_load(array + self->nhistory, x);
+
+    size_t span = len * self->up;
+    size_t ny = self->phase < span ? (span - self->phase + self->down - 1) / self->down : 0;
+    ndarray_obj_t *y = ndarray_new_linear_array(ny, NDARRAY_FLOAT);
+    signal_upfirdn_array((mp_float_t *)y->array, ny, array, total, self->taps, self->ntaps, self->up, self->down,
+                            (mp_int_t)(self->phase + self->nhistory * self->up));
+
+    self->phase = self->phase + ny * self->down - span;
+    memcpy(self->history, array + len, self->nhistory * sizeof(mp_float_t));
+    m_del(mp_float_t, array, total);
+    return MP_OBJ_FROM_PTR(y);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(signal_upfirdn_process_obj, signal_upfirdn_process);
+
+//|     def reset(self) -> None:
+//|         """Clear the history of the filter"""
+//|         ...
+//|
+
+static mp_obj_t signal_upfirdn_reset(mp_obj_t self_in) {
+    signal_upfirdn_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    memset(self->history, 0, self->nhistory * sizeof(mp_float_t));
+    self->phase = 0;
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(signal_upfirdn_reset_obj, signal_upfirdn_reset);
+
+static const mp_rom_map_elem_t signal_upfirdn_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_process), MP_ROM_PTR(&signal_upfirdn_process_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&signal_upfirdn_reset_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(signal_upfirdn_locals_dict, signal_upfirdn_locals_dict_table);
+
+const mp_obj_type_t signal_upfirdn_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_UpFIRDn,
+    .print = signal_upfirdn_print,
+    .make_new = signal_upfirdn_make_new,
+    .locals_dict = (mp_obj_dict_t*)&signal_upfirdn_locals_dict,
+};
+#endif /* ULAB_SCIPY_SIGNAL_HAS_UPFIRDN_CLASS */
+
+#if ULAB_SCIPY_SIGNAL_HAS_RESAMPLE_POLY
+//| def resample_poly(x: _ArrayLike, up: int, down: int, *, window: Optional[_ArrayLike] = None) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray x: The input signal
+//|     :param int up: The upsampling rate
+//|     :param int down: The downsampling rate
+//|     :param ulab.ndarray window: Optional taps of the FIR filter
+//|
+//|     Resample x by up / down with a polyphase filter. If window is not given, the filter is a
+//|     Kaiser-windowed (beta = 5.0) sinc lowpass filter of 20 * max(up, down) + 1 taps with a cutoff
+//|     at the lower one of the two Nyquist frequencies, as in scipy. The delay of the filter is
+//|     compensated, and the length of the output is ceil(len(x) * up / down). If up and down are
+//|     equal, a copy of the input is returned, and window is ignored."""
+//|     ...
+//|
+
+mp_obj_t signal_resample_poly(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_up, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 1 } },
+        { MP_QSTR_down, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 1 } },
+        { MP_QSTR_window, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    signal_upfirdn_rates(args[1].u_int, args[2].u_int);
+    size_t up = (size_t)args[1].u_int, down = (size_t)args[2].u_int;
+    size_t g = up, r = down;
+    while(r) {
+        SWAP(size_t, g, r);
+        r %= g;
+    }
+    up /= g;
+    down /= g;
+
+    if(up == down) {
+        // there is nothing to do, but to copy the input, even if a window is supplied
+        size_t nx = signal_input_length(args[0].u_obj);
+        ndarray_obj_t *y = ndarray_new_linear_array(nx, NDARRAY_FLOAT);
+        signal_input_load((mp_float_t *)y->array, args[0].u_obj);
+        return MP_OBJ_FROM_PTR(y);
+    }
+
+    size_t nh;
+    mp_float_t *h;
+    if(args[3].u_obj == mp_const_none) {
+        size_t rate = MAX(up, down);
+        nh = 20 * rate + 1;
+        h = m_new(mp_float_t, nh);
+        signal_lowpass_taps(h, nh, MICROPY_FLOAT_CONST(1.0) / (mp_float_t)rate, MICROPY_FLOAT_CONST(5.0));
+    } else {
+        h = signal_upfirdn_taps(args[3].u_obj, &nh);
+    }
+    ndarray_obj_t *y = signal_resample_poly_array(args[0].u_obj, up, down, h, nh);
+    m_del(mp_float_t, h, nh);
+    return MP_OBJ_FROM_PTR(y);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_resample_poly_obj, 3, signal_resample_poly);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_RESAMPLE_POLY */
+
+#if ULAB_SCIPY_SIGNAL_HAS_DECIMATE
+//| def decimate(x: _ArrayLike, q: int, n: Optional[int] = None, *, zero_phase: bool = True) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray x: The input signal
+//|     :param int q: The downsampling factor
+//|     :param int n: The order of the filter, 20 * q by default
+//|     :param bool zero_phase: Whether the delay of the filter is compensated
+//|
+//|     Downsample x by q after applying a Hamming-windowed sinc lowpass filter of n + 1 taps,
+//|     as scipy.signal.decimate with ftype='fir'. Only every q-th output of the filter is
+//|     calculated. The length of the output is ceil(len(x) / q)."""
+//|     ...
+//|
+
+mp_obj_t signal_decimate(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_q, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 1 } },
+        { MP_QSTR_n, MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_zero_phase, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    signal_upfirdn_rates(1, args[1].u_int);
+    size_t q = (size_t)args[1].u_int;
+    mp_int_t order = args[2].u_obj == mp_const_none ? 20 * (mp_int_t)q : mp_obj_get_int(args[2].u_obj);
+    if(order < 0) {
+        mp_raise_ValueError(translate("n must be non-negative"));
+    }
+
+    size_t nh = (size_t)order + 1;
+    mp_float_t *h = m_new(mp_float_t, nh);
+    signal_lowpass_taps(h, nh, MICROPY_FLOAT_CONST(1.0) / (mp_float_t)q, MICROPY_FLOAT_CONST(0.0));
+
+    ndarray_obj_t *y;
+    if(args[3].u_bool) {
+        y = signal_resample_poly_array(args[0].u_obj, 1, q, h, nh);
+    } else {
+        size_t nx = signal_input_length(args[0].u_obj);
+        mp_float_t *x = m_new(mp_float_t, nx);
+        signal_input_load(x, args[0].u_obj);
+        size_t ny = (nx + q - 1) / q;
+        y = ndarray_new_linear_array(ny, NDARRAY_FLOAT);
+        signal_upfirdn_array((mp_float_t *)y->array, ny, x, nx, h, nh, 1, q, 0);
+        m_del(mp_float_t, x, nx);
+    }
+    m_del(mp_float_t, h, nh);
+    return MP_OBJ_FROM_PTR(y);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_decimate_obj, 2, signal_decimate);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_DECIMATE */
+
+#if ULAB_SCIPY_SIGNAL_HAS_MEDFILT
+//| def medfilt(volume: ulab.ndarray, kernel_size: Optional[Union[int, Tuple[int, ...]]] = None) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray volume: A one-, or two-dimensional array
+//|     :param kernel_size: The odd extent of the window, either the same for all axes, or one per axis; 3 by default
+//|
+//|     Return the median of the window around each element, with the input padded by zeros.
+//|     The result has the dtype of the input, and an output costs O(log k) for a window of k
+//|     elements in one dimension."""
+//|     ...
+//|
+
+mp_obj_t signal_medfilt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_volume, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_kernel_size, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_INT(3) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("input must be an ndarray"));
+    }
+    ndarray_obj_t *volume = MP_OBJ_TO_PTR(args[0].u_obj);
+    mp_obj_t kernel_size = args[1].u_obj == mp_const_none ? MP_OBJ_NEW_SMALL_INT(3) : args[1].u_obj;
+    size_t size[2];
+    ndimage_filter_size(kernel_size, volume, size);
+    if(!(size[0] & 1) || !(size[1] & 1)) {
+        mp_raise_ValueError(translate("each element of kernel_size should be odd"));
+    }
+    return MP_OBJ_FROM_PTR(ndimage_rank_filter_array(volume, size, (mp_int_t)(size[0] * size[1] / 2), NDIMAGE_MODE_CONSTANT, MICROPY_FLOAT_CONST(0.0)));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_medfilt_obj, 1, signal_medfilt);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_MEDFILT */
+
+#if ULAB_SCIPY_SIGNAL_HAS_CONVOLVE2D && (ULAB_MAX_DIMS > 1)
+//| def convolve2d(in1: ulab.ndarray, in2: ulab.ndarray, mode: str = 'full', boundary: str = 'fill', fillvalue: float = 0, *, dtype: Optional[_DType] = None) -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray in1: A two-dimensional array
+//|     :param ulab.ndarray in2: A two-dimensional kernel
+//|     :param str mode: The size of the output, 'full', 'same' as in1, or 'valid'
+//|     :param str boundary: The padding of in1, 'fill' with fillvalue, 'wrap', or 'symm' for a symmetric reflection
+//|     :param float fillvalue: The value of the padding with boundary='fill'
+//|     :param dtype: The dtype of the result; by default, float, if either input is a float, otherwise the dtype of in1
+//|
+//|     Return the two-dimensional convolution of in1, and in2. Kernels that are the outer
+//|     product of a column, and a row are applied as two one-dimensional passes, and 8-, or
+//|     16-bit integer input with an integer kernel is summed in integers. Unlike in scipy,
+//|     integer results are saturated instead of wrapped around."""
+//|     ...
+//|
+
+mp_obj_t signal_convolve2d(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_in1, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_in2, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_mode, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_full) } },
+        { MP_QSTR_boundary, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_fill) } },
+        { MP_QSTR_fillvalue, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_INT(0) } },
+        { MP_QSTR_dtype, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type) || !mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("input must be an ndarray"));
+    }
+    ndarray_obj_t *in1 = MP_OBJ_TO_PTR(args[0].u_obj);
+    ndarray_obj_t *in2 = MP_OBJ_TO_PTR(args[1].u_obj);
+    if((in1->ndim != 2) || (in2->ndim != 2)) {
+        mp_raise_ValueError(translate("inputs must be two-dimensional"));
+    }
+    if(!mp_obj_is_str(args[2].u_obj) || !mp_obj_is_str(args[3].u_obj)) {
+        mp_raise_TypeError(translate("mode, and boundary must be strings"));
+    }
+
+    uint8_t boundary;
+    qstr bqstr = mp_obj_str_get_qstr(args[3].u_obj);
+    if(bqstr == MP_QSTR_fill) {
+        boundary = NDIMAGE_MODE_CONSTANT;
+    } else if(bqstr == MP_QSTR_wrap) {
+        boundary = NDIMAGE_MODE_WRAP;
+    } else if(bqstr == MP_QSTR_symm) {
+        boundary = NDIMAGE_MODE_REFLECT;
+    } else {
+        mp_raise_ValueError(translate("boundary must be one of 'fill', 'wrap', or 'symm'"));
+    }
+
+    uint8_t dtype;
+    if(args[5].u_obj != mp_const_none) {
+        dtype = ndimage_output_dtype(args[5].u_obj);
+    } else {
+        dtype = (in2->dtype == NDARRAY_FLOAT) ? NDARRAY_FLOAT : in1->dtype;
+    }
+
+    size_t rows = in1->shape[ULAB_MAX_DIMS - 2], cols = in1->shape[ULAB_MAX_DIMS - 1];
+    size_t kr = in2->shape[ULAB_MAX_DIMS - 2], kc = in2->shape[ULAB_MAX_DIMS - 1];
+    // the full output has rows + kr - 1 rows, whose first window starts kr - 1 rows before in1
+    size_t orows, ocols;
+    int32_t rstart, cstart;
+    qstr mode = mp_obj_str_get_qstr(args[2].u_obj);
+    if(mode == MP_QSTR_full) {
+        orows = (rows && kr) ? rows + kr - 1 : 0;
+        ocols = (cols && kc) ? cols + kc - 1 : 0;
+        rstart = -(int32_t)(kr - 1);
+        cstart = -(int32_t)(kc - 1);
+    } else if(mode == MP_QSTR_same) {
+        orows = rows;
+        ocols = cols;
+        rstart = -(int32_t)(kr / 2);
+        cstart = -(int32_t)(kc / 2);
+    } else if(mode == MP_QSTR_valid) {
+        // the convolution is commutative, so that the larger array is taken as the input
+        if((kr > rows) && (kc > cols)) {
+            SWAP(ndarray_obj_t *, in1, in2);
+            SWAP(size_t, rows, kr);
+            SWAP(size_t, cols, kc);
+        } else if((kr > rows) || (kc > cols)) {
+            mp_raise_ValueError(translate("for 'valid' mode, one input must be at least as large as the other in every dimension"));
+        }
+        orows = rows - kr + 1;
+        ocols = cols - kc + 1;
+        rstart = 0;
+        cstart = 0;
+    } else {
+        mp_raise_ValueError(translate("mode must be one of 'full', 'same', or 'valid'"));
+    }
+    return MP_OBJ_FROM_PTR(ndimage_correlate_array(in1, in2, true, orows, ocols, rstart, cstart, boundary,
+                                                    mp_obj_get_float(args[4].u_obj), dtype));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_convolve2d_obj, 2, signal_convolve2d);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_CONVOLVE2D */
+
+#if ULAB_SCIPY_SIGNAL_HAS_FIND_PEAKS
+// The candidates are the local maxima, where the midpoint of a flat top stands for the plateau,
+// and each condition removes candidates in the order height, threshold, distance, and prominence,
+// as in scipy. The prominences are the heights above the higher one of the two minima between
+// a peak, and the nearest higher samples on either side. These minima are found for all peaks
+// in one pass in each direction with a stack of the samples, which are higher than all
+// later samples, hence the cost is linear in the length of the input, instead of the product
+// of the number of peaks, and the length.
+
+typedef struct _signal_peaks_t {
+    size_t n;
+    size_t *index;
+    mp_float_t *height;
+    mp_float_t *left_threshold;
+    mp_float_t *right_threshold;
+    mp_float_t *prominence;
+    size_t *left_base;
+    size_t *right_base;
+} signal_peaks_t;
+
+#define SIGNAL_PEAKS_VALUE(i) func(array + (i) * stride)
+
+static size_t signal_local_maxima(uint8_t *array, int32_t stride, mp_float_t (*func)(void *), size_t len, size_t *index) {
+    // returns the number of local maxima, and, if index is not NULL, stores their positions
+    size_t n = 0;
+    size_t i = 1;
+    while(i + 1 < len) {
+        mp_float_t value = SIGNAL_PEAKS_VALUE(i);
+        if(SIGNAL_PEAKS_VALUE(i - 1) < value) {
+            size_t ahead = i + 1;
+            while((ahead + 1 < len) && (SIGNAL_PEAKS_VALUE(ahead) == value)) {
+                ahead++;
+            }
+            if(SIGNAL_PEAKS_VALUE(ahead) < value) {
+                if(index != NULL) {
+                    index[n] = (i + ahead - 1) / 2;
+                }
+                n++;
+                i = ahead;
+            }
+        }
+        i++;
+    }
+    return n;
+}
+
+static bool signal_peaks_interval(mp_obj_t arg, mp_float_t *min, mp_float_t *max) {
+    // a condition is either None, a lower bound, or a (min, max) pair, whose members may be None
+    *min = -INFINITY;
+    *max = INFINITY;
+    if(arg == mp_const_none) {
+        return false;
+    }
+    if(mp_obj_is_type(arg, &mp_type_tuple) || mp_obj_is_type(arg, &mp_type_list)) {
+        if(mp_obj_get_int(mp_obj_len_maybe(arg)) != 2) {
+            mp_raise_ValueError(translate("interval must be a (min, max) pair"));
+        }
+        mp_obj_t iterable = mp_getiter(arg, NULL);
+        mp_obj_t item = mp_iternext(iterable);
+        if(item != mp_const_none) {
+            *min = mp_obj_get_float(item);
+        }
+        item = mp_iternext(iterable);
+        if(item != mp_const_none) {
+            *max = mp_obj_get_float(item);
+        }
+    } else {
+        *min = mp_obj_get_float(arg);
+    }
+    return true;
+}
+
+static void signal_peaks_compact(signal_peaks_t *peaks, const uint8_t *keep) {
+    // removes the peaks, whose keep flag is 0, along with their properties
+    size_t n = 0;
+    for(size_t k=0; k < peaks->n; k++) {
+        if(keep[k]) {
+            peaks->index[n] = peaks->index[k];
+            if(peaks->height != NULL) {
+                peaks->height[n] = peaks->height[k];
+            }
+            if(peaks->left_threshold != NULL) {
+                peaks->left_threshold[n] = peaks->left_threshold[k];
+                peaks->right_threshold[n] = peaks->right_threshold[k];
+            }
+            if(peaks->prominence != NULL) {
+                peaks->prominence[n] = peaks->prominence[k];
+                peaks->left_base[n] = peaks->left_base[k];
+                peaks->right_base[n] = peaks->right_base[k];
+            }
+            n++;
+        }
+    }
+    peaks->n = n;
+}
+
+static bool signal_peaks_before(mp_float_t *priority, size_t a, size_t b) {
+    // ties are broken by the position, so that the order does not depend on the sort
+    return (priority[a] < priority[b]) || ((priority[a] == priority[b]) && (a < b));
+}
+
+static void signal_peaks_sift_down(size_t *order, mp_float_t *priority, size_t root, size_t end) {
+    while(2 * root + 1 < end) {
+        size_t child = 2 * root + 1;
+        if((child + 1 < end) && signal_peaks_before(priority, order[child], order[child + 1])) {
+            child++;
+        }
+        if(!signal_peaks_before(priority, order[root], order[child])) {
+            return;
+        }
+        SWAP(size_t, order[root], order[child]);
+        root = child;
+    }
+}
+
+static void signal_peaks_sort(size_t *order, mp_float_t *priority, size_t n) {
+    // heap sort of the indices by their priority in ascending order
+    for(size_t k=0; k < n; k++) {
+        order[k] = k;
+    }
+    for(size_t start = n / 2; start-- > 0; ) {
+        signal_peaks_sift_down(order, priority, start, n);
+    }
+    for(size_t end = n; end-- > 1; ) {
+        SWAP(size_t, order[0], order[end]);
+        signal_peaks_sift_down(order, priority, 0, end);
+    }
+}
+
+static void signal_peaks_distance(signal_peaks_t *peaks, uint8_t *keep, mp_float_t *priority, size_t distance) {
+    // keeps the higher peaks, and removes all others within distance of a kept peak
+    size_t n = peaks->n;
+    size_t *order = m_new(size_t, n);
+    signal_peaks_sort(order, priority, n);
+    memset(keep, 1, n);
+    for(size_t j = n; j-- > 0; ) {
+        size_t i = order[j];
+        if(!keep[i]) {
+            continue;
+        }
+        for(size_t k = i; (k > 0) && (peaks->index[i] - peaks->index[k - 1] < distance); k--) {
+            keep[k - 1] = 0;
+        }
+        for(size_t k = i + 1; (k < n) && (peaks->index[k] - peaks->index[i] < distance); k++) {
+            keep[k] = 0;
+        }
+    }
+    m_del(size_t, order, n);
+}
+
+static void signal_peaks_prominence(uint8_t *array, int32_t stride, mp_float_t (*func)(void *), size_t len, signal_peaks_t *peaks) {
+    // the stack holds pairs of a sample, which is higher than all later ones, and the position
+    // of the minimum between it, and the previous entry; the minimum left of a peak is then
+    // the smallest of these minima, which are popped, when the peak is pushed
+    size_t *stack = m_new(size_t, 2 * len);
+    size_t top = 0;
+    size_t next = 0;
+    for(size_t i=0; (i < len) && (next < peaks->n); i++) {
+        mp_float_t value = SIGNAL_PEAKS_VALUE(i);
+        size_t argmin = i;
+        while((top > 0) && (SIGNAL_PEAKS_VALUE(stack[2 * top - 2]) <= value)) {
+            // on ties, the minimum closest to the peak is the base, as in scipy
+            if(SIGNAL_PEAKS_VALUE(stack[2 * top - 1]) < SIGNAL_PEAKS_VALUE(argmin)) {
+                argmin = stack[2 * top - 1];
+            }
+            top--;
+        }
+        stack[2 * top] = i;
+        stack[2 * top + 1] = argmin;
+        top++;
+        if(peaks->index[next] == i) {
+            peaks->left_base[next++] = argmin;
+        }
+    }
+    top = 0;
+    next = peaks->n;
+    for(size_t i = len; (i-- > 0) && (next > 0); ) {
+        mp_float_t value = SIGNAL_PEAKS_VALUE(i);
+        size_t argmin = i;
+        while((top > 0) && (SIGNAL_PEAKS_VALUE(stack[2 * top - 2]) <= value)) {
+            if(SIGNAL_PEAKS_VALUE(stack[2 * top - 1]) < SIGNAL_PEAKS_VALUE(argmin)) {
+                argmin = stack[2 * top - 1];
+            }
+            top--;
+        }
+        stack[2 * top] = i;
+        stack[2 * top + 1] = argmin;
+        top++;
+        if(peaks->index[next - 1] == i) {
+            next--;
+            peaks->right_base[next] = argmin;
+            mp_float_t base = MAX(SIGNAL_PEAKS_VALUE(peaks->left_base[next]), SIGNAL_PEAKS_VALUE(argmin));
+            peaks->prominence[next] = value - base;
+        }
+    }
+    m_del(size_t, stack, 2 * len);
+}
+
+static ndarray_obj_t *signal_peaks_index(size_t *index, size_t n, uint8_t dtype) {
+    ndarray_obj_t *ndarray = ndarray_new_linear_array(n, dtype);
+    for(size_t k=0; k < n; k++) {
+        if(dtype == NDARRAY_UINT16) {
+            ((uint16_t *)ndarray->array)[k] = (uint16_t)index[k];
+        } else {
+            ((uint32_t *)ndarray->array)[k] = (uint32_t)index[k];
+        }
+    }
+    return ndarray;
+}
+
+static ndarray_obj_t *signal_peaks_float(mp_float_t *values, size_t n) {
+    ndarray_obj_t *ndarray = ndarray_new_linear_array(n, NDARRAY_FLOAT);
+    if(n) {
+        memcpy(ndarray->array, values, n * sizeof(mp_float_t));
+    }
+    return ndarray;
+}
+
+//| def find_peaks(x: ulab.ndarray, height: Optional[Union[float, Tuple[float, float]]] = None, threshold: Optional[Union[float, Tuple[float, float]]] = None, distance: Optional[float] = None, prominence: Optional[Union[float, Tuple[float, float]]] = None) -> Tuple[ulab.ndarray, dict]:
 //|     """
-//|     :param ulab.ndarray r: A 1-dimension array of values whose size is a power of 2
+//|     :param ulab.ndarray x: A one-dimensional array, or an iterable
+//|     :param height: The minimum, or the (min, max) interval of the height of the peaks
+//|     :param threshold: The minimum, or the (min, max) interval of the vertical distance of a peak to its neighbours
+//|     :param float distance: The minimum horizontal distance between neighbouring peaks; lower peaks, and of equal peaks, the left ones are removed first
+//|     :param prominence: The minimum, or the (min, max) interval of the prominence of the peaks
 //|
-//|     Computes the spectrum of the input signal.  This is the absolute value of the (complex-valued) fft of the signal.
-//|     This function is similar to scipy's ``scipy.signal.spectrogram``."""
+//|     Return the indices of the local maxima of x, which satisfy all conditions, as a uint16
+//|     array, or a uint32 array, if x is longer than 65535, and a dictionary with the properties
+//|     of the peaks, which were computed for the conditions, under the keys of scipy:
+//|     peak_heights, left_thresholds, right_thresholds, prominences, left_bases, and right_bases.
+//|     The cost of the prominences is linear in the length of x. wlen, width, and plateau_size
+//|     are not supported."""
 //|     ...
 //|
 
-mp_obj_t signal_spectrogram(size_t n_args, const mp_obj_t *args) {
-    if(n_args == 2) {
-        return fft_fft_ifft_spectrogram(n_args, args[0], args[1], FFT_SPECTROGRAM);
+mp_obj_t signal_find_peaks(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_height, MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_threshold, MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_distance, MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_prominence, MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t len = signal_input_length(args[0].u_obj);
+    ndarray_obj_t *x;
+    if(mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
+        x = MP_OBJ_TO_PTR(args[0].u_obj);
     } else {
-        return fft_fft_ifft_spectrogram(n_args, args[0], mp_const_none, FFT_SPECTROGRAM);
+        x = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+        signal_input_load((mp_float_t *)x->array, args[0].u_obj);
+    }
+    uint8_t *array = (uint8_t *)x->array;
+    int32_t stride = x->strides[ULAB_MAX_DIMS - 1];
+    mp_float_t (*func)(void *) = ndarray_get_float_function(x->dtype);
+
+    signal_peaks_t peaks = { 0 };
+    size_t capacity = signal_local_maxima(array, stride, func, len, NULL);
+    peaks.index = m_new(size_t, capacity);
+    peaks.n = signal_local_maxima(array, stride, func, len, peaks.index);
+    uint8_t *keep = m_new(uint8_t, capacity);
+    mp_obj_t properties = mp_obj_new_dict(0);
+    mp_float_t min, max;
+
+    if(signal_peaks_interval(args[1].u_obj, &min, &max)) {
+        peaks.height = m_new(mp_float_t, capacity);
+        for(size_t k=0; k < peaks.n; k++) {
+            peaks.height[k] = SIGNAL_PEAKS_VALUE(peaks.index[k]);
+            keep[k] = (peaks.height[k] >= min) && (peaks.height[k] <= max);
+        }
+        signal_peaks_compact(&peaks, keep);
+    }
+
+    if(signal_peaks_interval(args[2].u_obj, &min, &max)) {
+        peaks.left_threshold = m_new(mp_float_t, capacity);
+        peaks.right_threshold = m_new(mp_float_t, capacity);
+        for(size_t k=0; k < peaks.n; k++) {
+            mp_float_t value = SIGNAL_PEAKS_VALUE(peaks.index[k]);
+            mp_float_t left = value - SIGNAL_PEAKS_VALUE(peaks.index[k] - 1);
+            mp_float_t right = value - SIGNAL_PEAKS_VALUE(peaks.index[k] + 1);
+            peaks.left_threshold[k] = left;
+            peaks.right_threshold[k] = right;
+            keep[k] = (MIN(left, right) >= min) && (MAX(left, right) <= max);
+        }
+        signal_peaks_compact(&peaks, keep);
+    }
+
+    if(args[3].u_obj != mp_const_none) {
+        mp_float_t distance = mp_obj_get_float(args[3].u_obj);
+        if(distance < MICROPY_FLOAT_CONST(1.0)) {
+            mp_raise_ValueError(translate("distance must be greater or equal to 1"));
+        }
+        mp_float_t *priority = m_new(mp_float_t, capacity);
+        for(size_t k=0; k < peaks.n; k++) {
+            priority[k] = SIGNAL_PEAKS_VALUE(peaks.index[k]);
+        }
+        signal_peaks_distance(&peaks, keep, priority, (size_t)MICROPY_FLOAT_C_FUN(ceil)(distance));
+        m_del(mp_float_t, priority, capacity);
+        signal_peaks_compact(&peaks, keep);
+    }
+
+    if(signal_peaks_interval(args[4].u_obj, &min, &max)) {
+        peaks.prominence = m_new(mp_float_t, capacity);
+        peaks.left_base = m_new(size_t, capacity);
+        peaks.right_base = m_new(size_t, capacity);
+        signal_peaks_prominence(array, stride, func, len, &peaks);
+        for(size_t k=0; k < peaks.n; k++) {
+            keep[k] = (peaks.prominence[k] >= min) && (peaks.prominence[k] <= max);
+        }
+        signal_peaks_compact(&peaks, keep);
+    }
+
+    uint8_t dtype = len > 65535 ? NDARRAY_UINT32 : NDARRAY_UINT16;
+    if(peaks.height != NULL) {
+        mp_obj_dict_store(properties, MP_OBJ_NEW_QSTR(MP_QSTR_peak_heights), MP_OBJ_FROM_PTR(signal_peaks_float(peaks.height, peaks.n)));
+        m_del(mp_float_t, peaks.height, capacity);
+    }
+    if(peaks.left_threshold != NULL) {
+        mp_obj_dict_store(properties, MP_OBJ_NEW_QSTR(MP_QSTR_left_thresholds), MP_OBJ_FROM_PTR(signal_peaks_float(peaks.left_threshold, peaks.n)));
+        mp_obj_dict_store(properties, MP_OBJ_NEW_QSTR(MP_QSTR_right_thresholds), MP_OBJ_FROM_PTR(signal_peaks_float(peaks.right_threshold, peaks.n)));
+        m_del(mp_float_t, peaks.left_threshold, capacity);
+        m_del(mp_float_t, peaks.right_threshold, capacity);
     }
+    if(peaks.prominence != NULL) {
+        mp_obj_dict_store(properties, MP_OBJ_NEW_QSTR(MP_QSTR_prominences), MP_OBJ_FROM_PTR(signal_peaks_float(peaks.prominence, peaks.n)));
+        mp_obj_dict_store(properties, MP_OBJ_NEW_QSTR(MP_QSTR_left_bases), MP_OBJ_FROM_PTR(signal_peaks_index(peaks.left_base, peaks.n, dtype)));
+        mp_obj_dict_store(properties, MP_OBJ_NEW_QSTR(MP_QSTR_right_bases), MP_OBJ_FROM_PTR(signal_peaks_index(peaks.right_base, peaks.n, dtype)));
+        m_del(mp_float_t, peaks.prominence, capacity);
+        m_del(size_t, peaks.left_base, capacity);
+        m_del(size_t, peaks.right_base, capacity);
+    }
+
+    mp_obj_t tuple[2];
+    tuple[0] = MP_OBJ_FROM_PTR(signal_peaks_index(peaks.index, peaks.n, dtype));
+    tuple[1] = properties;
+    m_del(size_t, peaks.index, capacity);
+    m_del(uint8_t, keep, capacity);
+    return mp_obj_new_tuple(2, tuple);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(signal_spectrogram_obj, 1, 2, signal_spectrogram);
-#endif /* ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM */
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_find_peaks_obj, 1, signal_find_peaks);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_FIND_PEAKS */
 
-#if ULAB_SCIPY_SIGNAL_HAS_SOSFILT
-static void signal_sosfilt_array(mp_float_t *x, const mp_float_t *coeffs, mp_float_t *zf, const size_t len) {
-    for(size_t i=0; i < len; i++) {
-        mp_float_t xn = *x;
-        *x = coeffs[0] * xn + zf[0];
-        zf[0] = zf[1] + coeffs[1] * xn - coeffs[4] * *x;
-        zf[1] = coeffs[2] * xn - coeffs[5] * *x;
-        x++;
+#if ULAB_SCIPY_SIGNAL_HAS_GET_WINDOW
+//| def get_window(window: Union[str, Tuple[str, float]], Nx: int, fftbins: bool = True) -> ulab.ndarray:
+//|     """
+//|     :param window: The name of the window, 'boxcar', 'hann', 'hamming', 'blackman', or a ('kaiser', beta) tuple
+//|     :param int Nx: The number of points
+//|     :param bool fftbins: If True, the window is periodic, as needed for spectral analysis, otherwise symmetric
+//|
+//|     Return the window. The windows are memoised in a small cache, so that repeated calls
+//|     return a copy of the array without computation."""
+//|     ...
+//|
+
+mp_obj_t signal_get_window(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_window, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_Nx, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0 } },
+        { MP_QSTR_fftbins, MP_ARG_OBJ, {.u_rom_obj = mp_const_true } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(args[1].u_int < 1) {
+        mp_raise_ValueError(translate("Nx must be a positive integer"));
     }
-    x -= len;
+    return MP_OBJ_FROM_PTR(window_copy(window_get(args[0].u_obj, (size_t)args[1].u_int, mp_obj_is_true(args[2].u_obj))));
 }
 
-mp_obj_t signal_sosfilt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_get_window_obj, 2, signal_get_window);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_GET_WINDOW */
+
+#if SIGNAL_HAS_DESIGN
+static mp_float_t *signal_design_frequencies(mp_obj_t arg, mp_obj_t arg_fs, size_t *len) {
+    // the critical frequencies of the filters, relative to the Nyquist frequency
+    mp_float_t nyquist = arg_fs == mp_const_none ? MICROPY_FLOAT_CONST(1.0) : MICROPY_FLOAT_CONST(0.5) * mp_obj_get_float(arg_fs);
+    mp_float_t *freqs;
+    if(mp_obj_is_int(arg) || mp_obj_is_float(arg)) {
+        *len = 1;
+        freqs = m_new(mp_float_t, 1);
+        freqs[0] = mp_obj_get_float(arg);
+    } else {
+        *len = signal_input_length(arg);
+        freqs = m_new(mp_float_t, *len);
+        signal_input_load(freqs, arg);
+    }
+    if(*len == 0) {
+        mp_raise_ValueError(translate("at least one cutoff frequency must be given"));
+    }
+    for(size_t i=0; i < *len; i++) {
+        freqs[i] /= nyquist;
+        if(!(freqs[i] > MICROPY_FLOAT_CONST(0.0)) || !(freqs[i] < MICROPY_FLOAT_CONST(1.0))) {
+            mp_raise_ValueError(translate("frequencies must be between 0 and fs/2"));
+        }
+        if((i > 0) && (freqs[i] <= freqs[i-1])) {
+            mp_raise_ValueError(translate("frequencies must be strictly increasing"));
+        }
+    }
+    return freqs;
+}
+
+static uint8_t signal_band_type(mp_obj_t arg) {
+    if(mp_obj_is_str(arg)) {
+        qstr name = mp_obj_str_get_qstr(arg);
+        if(name == MP_QSTR_lowpass) {
+            return SIGNAL_LOWPASS;
+        } else if(name == MP_QSTR_highpass) {
+            return SIGNAL_HIGHPASS;
+        } else if(name == MP_QSTR_bandpass) {
+            return SIGNAL_BANDPASS;
+        } else if(name == MP_QSTR_bandstop) {
+            return SIGNAL_BANDSTOP;
+        }
+    }
+    mp_raise_ValueError(translate("filter type must be 'lowpass', 'highpass', 'bandpass', or 'bandstop'"));
+}
+#endif /* SIGNAL_HAS_DESIGN */
+
+#if ULAB_SCIPY_SIGNAL_HAS_FIRWIN
+//| def firwin(numtaps: int, cutoff: Union[float, _ArrayLike], *, width: Optional[float] = None, window: Union[str, Tuple[str, float]] = 'hamming',
+//|            pass_zero: Union[bool, str] = True, scale: bool = True, fs: Optional[float] = None) -> ulab.ndarray:
+//|     """
+//|     :param int numtaps: The number of taps of the filter
+//|     :param cutoff: The edges of the passbands, in the units of fs, or relative to the Nyquist frequency, if fs is not given
+//|     :param float width: The width of the transition region; if given, the Kaiser window is designed from it, and window is ignored
+//|     :param window: The window, as in get_window
+//|     :param pass_zero: Whether DC is in the passband, or one of 'lowpass', 'highpass', 'bandpass', 'bandstop'
+//|     :param bool scale: Whether the gain is unity at the centre of the first passband
+//|     :param float fs: The sampling frequency
+//|
+//|     Design an FIR filter with the windowed sinc method, as scipy.signal.firwin. The
+//|     taps can be passed to lfilter, upfirdn, or to firfilt_fixed after quantisation."""
+//|     ...
+//|
+
+mp_obj_t signal_firwin(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_sos, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
-        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
-        { MP_QSTR_zi, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_numtaps, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0 } },
+        { MP_QSTR_cutoff, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_width, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_window, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_hamming) } },
+        { MP_QSTR_pass_zero, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_true } },
+        { MP_QSTR_scale, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true } },
+        { MP_QSTR_fs, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    if(!ndarray_object_is_array_like(args[0].u_obj) || !ndarray_object_is_array_like(args[1].u_obj)) {
-        mp_raise_TypeError(translate("sosfilt requires iterable arguments"));
+    if(args[0].u_int < 1) {
+        mp_raise_ValueError(translate("numtaps must be a positive integer"));
     }
-    size_t lenx = (size_t)mp_obj_get_int(mp_obj_len_maybe(args[1].u_obj));
-    ndarray_obj_t *y = ndarray_new_linear_array(lenx, NDARRAY_FLOAT);
-    mp_float_t *yarray = (mp_float_t *)y->array;
-    mp_float_t coeffs[6];
-    if(mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type)) {
-        ndarray_obj_t *inarray = MP_OBJ_TO_PTR(args[1].u_obj);
-        #if ULAB_MAX_DIMS > 1
-        if(inarray->ndim > 1) {
-            mp_raise_ValueError(translate("input must be one-dimensional"));
+    size_t ntaps = (size_t)args[0].u_int;
+    size_t ncutoff;
+    mp_float_t *cutoff = signal_design_frequencies(args[1].u_obj, args[6].u_obj, &ncutoff);
+
+    bool pass_zero;
+    if(mp_obj_is_bool(args[4].u_obj)) {
+        pass_zero = mp_obj_is_true(args[4].u_obj);
+    } else {
+        uint8_t btype = signal_band_type(args[4].u_obj);
+        if((btype == SIGNAL_LOWPASS) || (btype == SIGNAL_HIGHPASS)) {
+            if(ncutoff != 1) {
+                mp_raise_ValueError(translate("cutoff must have one element"));
+            }
+        } else if(ncutoff < 2) {
+            mp_raise_ValueError(translate("cutoff must have at least two elements"));
         }
-        #endif
-        uint8_t *iarray = (uint8_t *)inarray->array;
-        for(size_t i=0; i < lenx; i++) {
-            *yarray++ = ndarray_get_float_value(iarray, inarray->dtype);
-            iarray += inarray->strides[ULAB_MAX_DIMS - 1];
+        pass_zero = (btype == SIGNAL_LOWPASS) || (btype == SIGNAL_BANDSTOP);
+    }
+    bool pass_nyquist = ((ncutoff & 1) == 0) == pass_zero;
+    if(pass_nyquist && ((ntaps & 1) == 0)) {
+        mp_raise_ValueError(translate("even number of taps requires zero response at Nyquist"));
+    }
+
+    // 0 and 1 are added to the cutoffs, so that they come in (left, right) pairs
+    size_t nedges = ncutoff + pass_zero + pass_nyquist;
+    mp_float_t *edges = m_new(mp_float_t, nedges);
+    edges[0] = MICROPY_FLOAT_CONST(0.0);
+    memcpy(edges + pass_zero, cutoff, ncutoff * sizeof(mp_float_t));
+    if(pass_nyquist) {
+        edges[nedges - 1] = MICROPY_FLOAT_CONST(1.0);
+    }
+    m_del(mp_float_t, cutoff, ncutoff);
+
+    ndarray_obj_t *ndarray = ndarray_new_linear_array(ntaps, NDARRAY_FLOAT);
+    mp_float_t *h = (mp_float_t *)ndarray->array;
+    if(args[2].u_obj != mp_const_none) {
+        // the Kaiser window, whose attenuation gives the requested transition width
+        mp_float_t width = mp_obj_get_float(args[2].u_obj);
+        if(args[6].u_obj != mp_const_none) {
+            width /= MICROPY_FLOAT_CONST(0.5) * mp_obj_get_float(args[6].u_obj);
+        }
+        mp_float_t atten = MICROPY_FLOAT_CONST(2.285) * (mp_float_t)(ntaps - 1) * MP_PI * width + MICROPY_FLOAT_CONST(7.95);
+        mp_float_t beta = MICROPY_FLOAT_CONST(0.0);
+        if(atten > MICROPY_FLOAT_CONST(50.0)) {
+            beta = MICROPY_FLOAT_CONST(0.1102) * (atten - MICROPY_FLOAT_CONST(8.7));
+        } else if(atten > MICROPY_FLOAT_CONST(21.0)) {
+            atten -= MICROPY_FLOAT_CONST(21.0);
+            beta = MICROPY_FLOAT_CONST(0.5842) * MICROPY_FLOAT_C_FUN(pow)(atten, MICROPY_FLOAT_CONST(0.4)) + MICROPY_FLOAT_CONST(0.07886) * atten;
         }
-        yarray -= lenx;
+        window_fill(h, ntaps, WINDOW_KAISER, beta, false);
     } else {
-        fill_array_iterable(yarray, args[1].u_obj);
+        // the window may come from the cache, hence it is only read
+        ndarray_obj_t *window = window_get(args[3].u_obj, ntaps, false);
+        memcpy(h, window->array, ntaps * sizeof(mp_float_t));
     }
+    signal_firwin_taps(h, ntaps, edges, nedges, args[5].u_bool);
+    m_del(mp_float_t, edges, nedges);
+    return MP_OBJ_FROM_PTR(ndarray);
+}
 
-    mp_obj_iter_buf_t iter_buf;
-    mp_obj_t item, iterable = mp_getiter(args[0].u_obj, &iter_buf);
-    size_t lensos = (size_t)mp_obj_get_int(mp_obj_len_maybe(args[0].u_obj));
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_firwin_obj, 2, signal_firwin);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_FIRWIN */
 
-    size_t *shape = ndarray_shape_vector(0, 0, lensos, 2);
-    ndarray_obj_t *zf = ndarray_new_dense_ndarray(2, shape, NDARRAY_FLOAT);
-    mp_float_t *zf_array = (mp_float_t *)zf->array;
+#if ULAB_SCIPY_SIGNAL_HAS_BUTTER && (ULAB_MAX_DIMS > 1)
+static signal_complex_t signal_complex_mul(signal_complex_t a, signal_complex_t b) {
+    signal_complex_t c = { a.real * b.real - a.imag * b.imag, a.real * b.imag + a.imag * b.real };
+    return c;
+}
 
-    if(args[2].u_obj != mp_const_none) {
-        if(!mp_obj_is_type(args[2].u_obj, &ulab_ndarray_type)) {
-            mp_raise_TypeError(translate("zi must be an ndarray"));
+static signal_complex_t signal_complex_div(signal_complex_t a, signal_complex_t b) {
+    mp_float_t norm = b.real * b.real + b.imag * b.imag;
+    signal_complex_t c = { (a.real * b.real + a.imag * b.imag) / norm, (a.imag * b.real - a.real * b.imag) / norm };
+    return c;
+}
+
+static signal_complex_t signal_complex_sqrt(signal_complex_t a) {
+    // the principal value of the square root
+    mp_float_t r = MICROPY_FLOAT_C_FUN(sqrt)(a.real * a.real + a.imag * a.imag);
+    signal_complex_t c;
+    c.real = MICROPY_FLOAT_C_FUN(sqrt)(MICROPY_FLOAT_CONST(0.5) * (r + a.real));
+    c.imag = MICROPY_FLOAT_C_FUN(sqrt)(MICROPY_FLOAT_CONST(0.5) * (r - a.real));
+    if(a.imag < MICROPY_FLOAT_CONST(0.0)) {
+        c.imag = -c.imag;
+    }
+    return c;
+}
+
+static mp_float_t signal_complex_abs(signal_complex_t a) {
+    return MICROPY_FLOAT_C_FUN(sqrt)(a.real * a.real + a.imag * a.imag);
+}
+
+static signal_complex_t signal_bilinear(signal_complex_t s, signal_complex_t *gain, bool zero) {
+    // maps s onto the z-plane with the bilinear transform at fs = 2, and updates the gain
+    signal_complex_t plus = { MICROPY_FLOAT_CONST(4.0) + s.real, s.imag };
+    signal_complex_t minus = { MICROPY_FLOAT_CONST(4.0) - s.real, -s.imag };
+    *gain = zero ? signal_complex_mul(*gain, minus) : signal_complex_div(*gain, minus);
+    return signal_complex_div(plus, minus);
+}
+
+static mp_float_t signal_butter_zpk(signal_complex_t *z, signal_complex_t *p, size_t order, uint8_t btype, mp_float_t *freqs) {
+    // the zeros and poles of the digital Butterworth filter: the poles of the analogue prototype
+    // are transformed into the requested band at the pre-warped frequencies, and then mapped onto
+    // the z-plane; the gain is accumulated pole by pole, so that it can not overflow
+    mp_float_t w0 = MICROPY_FLOAT_CONST(4.0) * MICROPY_FLOAT_C_FUN(tan)(MP_PI * freqs[0] / MICROPY_FLOAT_CONST(2.0));
+    mp_float_t w1 = MICROPY_FLOAT_CONST(4.0) * MICROPY_FLOAT_C_FUN(tan)(MP_PI * freqs[1] / MICROPY_FLOAT_CONST(2.0));
+    mp_float_t bw = w1 - w0;
+    mp_float_t wo2 = w0 * w1;
+    signal_complex_t gain = { MICROPY_FLOAT_CONST(1.0), MICROPY_FLOAT_CONST(0.0) };
+    signal_complex_t wo = { MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_C_FUN(sqrt)(wo2) };
+    signal_complex_t origin = { MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(0.0) };
+    size_t nz = 0, np = 0;
+
+    for(size_t i=0; i < order; i++) {
+        // the poles of the prototype are on the left half of the unit circle; the middle one is real
+        mp_float_t theta = MP_PI * (mp_float_t)(2 * (mp_int_t)i - (mp_int_t)order + 1) / (mp_float_t)(2 * order);
+        signal_complex_t proto = { -MICROPY_FLOAT_C_FUN(cos)(theta), -MICROPY_FLOAT_C_FUN(sin)(theta) };
+        signal_complex_t minus_proto = { -proto.real, -proto.imag };
+        if(btype == SIGNAL_LOWPASS) {
+            signal_complex_t pole = { w0 * proto.real, w0 * proto.imag };
+            gain.real *= w0;
+            gain.imag *= w0;
+            p[np++] = signal_bilinear(pole, &gain, false);
+        } else if(btype == SIGNAL_HIGHPASS) {
+            signal_complex_t w = { w0, MICROPY_FLOAT_CONST(0.0) };
+            gain = signal_complex_div(gain, minus_proto);
+            z[nz++] = signal_bilinear(origin, &gain, true);
+            p[np++] = signal_bilinear(signal_complex_div(w, proto), &gain, false);
         } else {
-            ndarray_obj_t *zi = MP_OBJ_TO_PTR(args[2].u_obj);
-            if((zi->shape[ULAB_MAX_DIMS - 1] != lensos) || (zi->shape[ULAB_MAX_DIMS - 1] != 2)) {
-                mp_raise_ValueError(translate("zi must be of shape (n_section, 2)"));
+            signal_complex_t q;
+            if(btype == SIGNAL_BANDPASS) {
+                q.real = MICROPY_FLOAT_CONST(0.5) * bw * proto.real;
+                q.imag = MICROPY_FLOAT_CONST(0.5) * bw * proto.imag;
+                gain.real *= bw;
+                gain.imag *= bw;
+                z[nz++] = signal_bilinear(origin, &gain, true);
+            } else {
+                signal_complex_t half = { MICROPY_FLOAT_CONST(0.5) * bw, MICROPY_FLOAT_CONST(0.0) };
+                q = signal_complex_div(half, proto);
+                gain = signal_complex_div(gain, minus_proto);
+                signal_complex_t conj = { MICROPY_FLOAT_CONST(0.0), -wo.imag };
+                z[nz++] = signal_bilinear(wo, &gain, true);
+                z[nz++] = signal_bilinear(conj, &gain, true);
+            }
+            signal_complex_t d = signal_complex_mul(q, q);
+            d.real -= wo2;
+            d = signal_complex_sqrt(d);
+            signal_complex_t pole = { q.real + d.real, q.imag + d.imag };
+            p[np++] = signal_bilinear(pole, &gain, false);
+            pole.real = q.real - d.real;
+            pole.imag = q.imag - d.imag;
+            p[np++] = signal_bilinear(pole, &gain, false);
+        }
+    }
+    // the zeros at infinity are mapped onto Nyquist
+    while(nz < np) {
+        z[nz].real = MICROPY_FLOAT_CONST(-1.0);
+        z[nz++].imag = MICROPY_FLOAT_CONST(0.0);
+    }
+    return gain.real;
+}
+
+static size_t signal_cplxreal(signal_complex_t *roots, size_t n) {
+    // sorts the roots by their real part, and keeps only one of the complex conjugate pairs,
+    // as scipy.signal's _cplxreal: the complex roots with positive imaginary part come first,
+    // followed by the real roots; returns the new number of roots
+    for(size_t i=0; i < n; i++) {
+        if(MICROPY_FLOAT_C_FUN(fabs)(roots[i].imag) <= MICROPY_FLOAT_CONST(100.0) * WINDOW_EPSILON * signal_complex_abs(roots[i])) {
+            roots[i].imag = MICROPY_FLOAT_CONST(0.0);
+        }
+    }
+    // insertion sort, so that the order of equal roots is kept
+    for(size_t i=1; i < n; i++) {
+        signal_complex_t root = roots[i];
+        size_t j = i;
+        while((j > 0) && ((roots[j-1].real > root.real) ||
+            ((roots[j-1].real == root.real) && (MICROPY_FLOAT_C_FUN(fabs)(roots[j-1].imag) > MICROPY_FLOAT_C_FUN(fabs)(root.imag))))) {
+            roots[j] = roots[j-1];
+            j--;
+        }
+        roots[j] = root;
+    }
+    signal_complex_t *tmp = m_new(signal_complex_t, n);
+    size_t count = 0;
+    for(size_t i=0; i < n; i++) {
+        if(roots[i].imag > MICROPY_FLOAT_CONST(0.0)) {
+            tmp[count++] = roots[i];
+        }
+    }
+    for(size_t i=0; i < n; i++) {
+        if(roots[i].imag == MICROPY_FLOAT_CONST(0.0)) {
+            tmp[count++] = roots[i];
+        }
+    }
+    memcpy(roots, tmp, count * sizeof(signal_complex_t));
+    m_del(signal_complex_t, tmp, n);
+    return count;
+}
+
+static size_t signal_zpk_count_real(signal_complex_t *roots, size_t n) {
+    size_t count = 0;
+    for(size_t i=0; i < n; i++) {
+        count += roots[i].imag == MICROPY_FLOAT_CONST(0.0);
+    }
+    return count;
+}
+
+static signal_complex_t signal_zpk_take(signal_complex_t *roots, size_t *n, size_t index) {
+    signal_complex_t root = roots[index];
+    (*n)--;
+    memmove(roots + index, roots + index + 1, (*n - index) * sizeof(signal_complex_t));
+    return root;
+}
+
+static size_t signal_zpk_worst(signal_complex_t *roots, size_t n, bool real) {
+    // the index of the root closest to the unit circle; if real is true, only the real roots are considered
+    size_t index = 0;
+    mp_float_t min = MICROPY_FLOAT_CONST(0.0);
+    bool found = false;
+    for(size_t i=0; i < n; i++) {
+        if(real && (roots[i].imag != MICROPY_FLOAT_CONST(0.0))) {
+            continue;
+        }
+        mp_float_t distance = MICROPY_FLOAT_C_FUN(fabs)(MICROPY_FLOAT_CONST(1.0) - signal_complex_abs(roots[i]));
+        if(!found || (distance < min)) {
+            index = i;
+            min = distance;
+            found = true;
+        }
+    }
+    return index;
+}
+
+#define SIGNAL_ZPK_ANY      0
+#define SIGNAL_ZPK_REAL     1
+#define SIGNAL_ZPK_COMPLEX  2
+
+static size_t signal_zpk_nearest(signal_complex_t *roots, size_t n, signal_complex_t to, uint8_t which) {
+    // the index of the root of the requested kind closest to to; if there is no such root,
+    // the closest root of any kind is returned
+    size_t index = n;
+    mp_float_t min = MICROPY_FLOAT_CONST(0.0);
+    for(uint8_t pass=0; (pass < 2) && (index == n); pass++) {
+        for(size_t i=0; i < n; i++) {
+            bool real = roots[i].imag == MICROPY_FLOAT_CONST(0.0);
+            if((pass == 0) && (((which == SIGNAL_ZPK_REAL) && !real) || ((which == SIGNAL_ZPK_COMPLEX) && real))) {
+                continue;
             }
-            if(zi->dtype != NDARRAY_FLOAT) {
-                mp_raise_ValueError(translate("zi must be of float type"));
+            signal_complex_t delta = { roots[i].real - to.real, roots[i].imag - to.imag };
+            mp_float_t distance = signal_complex_abs(delta);
+            if((index == n) || (distance < min)) {
+                index = i;
+                min = distance;
             }
-            // TODO: this won't work with sparse arrays
-            memcpy(zf_array, zi->array, 2*lensos*sizeof(mp_float_t));
         }
     }
-    while((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
-        if(mp_obj_get_int(mp_obj_len_maybe(item)) != 6) {
-            mp_raise_ValueError(translate("sos array must be of shape (n_section, 6)"));
+    return index;
+}
+
+static void signal_zpk_poly(mp_float_t *coeffs, signal_complex_t *roots, size_t n) {
+    // the real coefficients of the monic polynomial of up to two roots, aligned to the right
+    coeffs[0] = coeffs[1] = MICROPY_FLOAT_CONST(0.0);
+    coeffs[2] = MICROPY_FLOAT_CONST(1.0);
+    if(n == 1) {
+        coeffs[1] = MICROPY_FLOAT_CONST(1.0);
+        coeffs[2] = -roots[0].real;
+    } else if(n == 2) {
+        coeffs[0] = MICROPY_FLOAT_CONST(1.0);
+        coeffs[1] = -(roots[0].real + roots[1].real);
+        coeffs[2] = signal_complex_mul(roots[0], roots[1]).real;
+    }
+}
+
+static void signal_zpk_section(mp_float_t *section, signal_complex_t z1, signal_complex_t z2, size_t nz,
+                                signal_complex_t p1, signal_complex_t p2) {
+    signal_complex_t zeros[2] = { z1, z2 };
+    signal_complex_t poles[2] = { p1, p2 };
+    signal_zpk_poly(section, zeros, nz);
+    signal_zpk_poly(section + 3, poles, 2);
+}
+
+static void signal_zpk2sos(mp_float_t *sos, signal_complex_t *z, signal_complex_t *p, size_t n, mp_float_t k) {
+    // pairs the poles and zeros into second-order sections, as scipy.signal.zpk2sos with
+    // pairing='nearest': the poles closest to the unit circle are paired with the nearest
+    // zeros first, and they are placed into the last sections; z and p must have space for n + 1 roots
+    size_t nsections = (n + 1) / 2;
+    if(n & 1) {
+        // an odd number of roots is padded by a pole and a zero at the origin
+        z[n].real = z[n].imag = p[n].real = p[n].imag = MICROPY_FLOAT_CONST(0.0);
+        n++;
+    }
+    size_t nz = signal_cplxreal(z, n);
+    size_t np = signal_cplxreal(p, n);
+    signal_complex_t origin = { MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(0.0) };
+
+    for(size_t s=nsections; s-- > 0;) {
+        mp_float_t *section = sos + 6 * s;
+        signal_complex_t p1 = signal_zpk_take(p, &np, signal_zpk_worst(p, np, false));
+        signal_complex_t p1conj = { p1.real, -p1.imag };
+        bool real = p1.imag == MICROPY_FLOAT_CONST(0.0);
+        size_t nrealp = signal_zpk_count_real(p, np);
+
+        if(real && (nrealp == 0)) {
+            // the last real pole
+            signal_complex_t z1 = signal_zpk_take(z, &nz, signal_zpk_nearest(z, nz, p1, SIGNAL_ZPK_REAL));
+            signal_zpk_section(section, z1, origin, 2, p1, origin);
+        } else if((np + 1 == nz) && !real && (nrealp == 1) && (signal_zpk_count_real(z, nz) == 1)) {
+            // one real pole and one real zero are left, so the complex pole must take a complex zero
+            signal_complex_t z1 = signal_zpk_take(z, &nz, signal_zpk_nearest(z, nz, p1, SIGNAL_ZPK_COMPLEX));
+            signal_complex_t z1conj = { z1.real, -z1.imag };
+            signal_zpk_section(section, z1, z1conj, 2, p1, p1conj);
         } else {
-            fill_array_iterable(coeffs, item);
-            if(coeffs[3] != MICROPY_FLOAT_CONST(1.0)) {
-                mp_raise_ValueError(translate("sos[:, 3] should be all ones"));
+            signal_complex_t p2 = p1conj;
+            if(real) {
+                p2 = signal_zpk_take(p, &np, signal_zpk_worst(p, np, true));
+            }
+            if(nz == 0) {
+                signal_zpk_section(section, origin, origin, 0, p1, p2);
+            } else {
+                signal_complex_t z1 = signal_zpk_take(z, &nz, signal_zpk_nearest(z, nz, p1, SIGNAL_ZPK_ANY));
+                if(z1.imag != MICROPY_FLOAT_CONST(0.0)) {
+                    signal_complex_t z1conj = { z1.real, -z1.imag };
+                    signal_zpk_section(section, z1, z1conj, 2, p1, p2);
+                } else if(nz > 0) {
+                    signal_complex_t z2 = signal_zpk_take(z, &nz, signal_zpk_nearest(z, nz, p1, SIGNAL_ZPK_REAL));
+                    signal_zpk_section(section, z1, z2, 2, p1, p2);
+                } else {
+                    signal_zpk_section(section, z1, origin, 1, p1, p2);
+                }
             }
-            signal_sosfilt_array(yarray, coeffs, zf_array, lenx);
-            zf_array += 2;
         }
     }
-    if(args[2].u_obj == mp_const_none) {
-        return MP_OBJ_FROM_PTR(y);
+    for(uint8_t i=0; i < 3; i++) {
+        sos[i] *= k;
+    }
+}
+
+static ndarray_obj_t *signal_zpk2tf(signal_complex_t *roots, size_t n, mp_float_t k) {
+    // the coefficients of k * prod(x - root), built from the conjugate pairs, and the real roots
+    ndarray_obj_t *ndarray = ndarray_new_linear_array(n + 1, NDARRAY_FLOAT);
+    mp_float_t *coeffs = (mp_float_t *)ndarray->array;
+    size_t count = signal_cplxreal(roots, n);
+    size_t degree = 0;
+    coeffs[0] = MICROPY_FLOAT_CONST(1.0);
+    for(size_t i=0; i < count; i++) {
+        mp_float_t c1 = -roots[i].real, c2 = MICROPY_FLOAT_CONST(0.0);
+        size_t step = 1;
+        if(roots[i].imag != MICROPY_FLOAT_CONST(0.0)) {
+            c1 *= MICROPY_FLOAT_CONST(2.0);
+            c2 = roots[i].real * roots[i].real + roots[i].imag * roots[i].imag;
+            step = 2;
+        }
+        // multiplies by x^2 + c1 x + c2, or x + c1, going from the highest power
+        for(size_t j=degree + step; j > 0; j--) {
+            mp_float_t c = j <= degree ? coeffs[j] : MICROPY_FLOAT_CONST(0.0);
+            if(j - 1 <= degree) {
+                c += c1 * coeffs[j-1];
+            }
+            if((step == 2) && (j > 1)) {
+                c += c2 * coeffs[j-2];
+            }
+            coeffs[j] = c;
+        }
+        degree += step;
+    }
+    for(size_t i=0; i <= n; i++) {
+        coeffs[i] *= k;
+    }
+    return ndarray;
+}
+
+//| def butter(N: int, Wn: Union[float, _ArrayLike], btype: str = 'lowpass', analog: bool = False, output: str = 'ba',
+//|            fs: Optional[float] = None) -> Union[ulab.ndarray, Tuple[ulab.ndarray, ulab.ndarray]]:
+//|     """
+//|     :param int N: The order of the filter
+//|     :param Wn: The critical frequency, or, for band filters, the two critical frequencies, in the units of fs, or relative to the Nyquist frequency, if fs is not given
+//|     :param str btype: One of 'lowpass', 'highpass', 'bandpass', 'bandstop'
+//|     :param bool analog: Only digital filters are supported, hence, this must be False
+//|     :param str output: 'ba' for the coefficients of the transfer function, or 'sos' for second-order sections
+//|     :param float fs: The sampling frequency
+//|
+//|     Design a digital Butterworth filter with the bilinear transform, as scipy.signal.butter.
+//|     The second-order sections are paired as in scipy.signal.zpk2sos, and can be passed to
+//|     sosfilt, sosfiltfilt, or SOSFilter directly."""
+//|     ...
+//|
+
+mp_obj_t signal_butter(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_N, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0 } },
+        { MP_QSTR_Wn, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+        { MP_QSTR_btype, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_lowpass) } },
+        { MP_QSTR_analog, MP_ARG_OBJ, {.u_rom_obj = mp_const_false } },
+        { MP_QSTR_output, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_ba) } },
+        { MP_QSTR_fs, MP_ARG_OBJ, {.u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(args[0].u_int < 1) {
+        mp_raise_ValueError(translate("N must be a positive integer"));
+    }
+    if(mp_obj_is_true(args[3].u_obj)) {
+        mp_raise_NotImplementedError(translate("analog filters are not supported"));
+    }
+    bool sos = false;
+    if(mp_obj_is_str(args[4].u_obj) && (mp_obj_str_get_qstr(args[4].u_obj) == MP_QSTR_sos)) {
+        sos = true;
+    } else if(!mp_obj_is_str(args[4].u_obj) || (mp_obj_str_get_qstr(args[4].u_obj) != MP_QSTR_ba)) {
+        mp_raise_ValueError(translate("output must be 'ba', or 'sos'"));
+    }
+    uint8_t btype = signal_band_type(args[2].u_obj);
+    size_t nfreqs;
+    mp_float_t *freqs = signal_design_frequencies(args[1].u_obj, args[5].u_obj, &nfreqs);
+    if(nfreqs != ((btype == SIGNAL_BANDPASS) || (btype == SIGNAL_BANDSTOP) ? 2 : 1)) {
+        mp_raise_ValueError(translate("Wn must have two elements for band filters, and one otherwise"));
+    }
+    mp_float_t band[2] = { freqs[0], freqs[nfreqs - 1] };
+    m_del(mp_float_t, freqs, nfreqs);
+
+    size_t order = (size_t)args[0].u_int;
+    size_t n = (btype == SIGNAL_BANDPASS) || (btype == SIGNAL_BANDSTOP) ? 2 * order : order;
+    signal_complex_t *z = m_new(signal_complex_t, n + 1);
+    signal_complex_t *p = m_new(signal_complex_t, n + 1);
+    mp_float_t k = signal_butter_zpk(z, p, order, btype, band);
+
+    mp_obj_t result;
+    if(sos) {
+        size_t *shape = ndarray_shape_vector(0, 0, (n + 1) / 2, 6);
+        ndarray_obj_t *ndarray = ndarray_new_dense_ndarray(2, shape, NDARRAY_FLOAT);
+        signal_zpk2sos((mp_float_t *)ndarray->array, z, p, n, k);
+        result = MP_OBJ_FROM_PTR(ndarray);
     } else {
-        mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(2, NULL));
-        tuple->items[0] = MP_OBJ_FROM_PTR(y);
-        tuple->items[1] = MP_OBJ_FROM_PTR(zf);
-        return tuple;
+        mp_obj_t tuple[2];
+        tuple[0] = MP_OBJ_FROM_PTR(signal_zpk2tf(z, n, k));
+        tuple[1] = MP_OBJ_FROM_PTR(signal_zpk2tf(p, n, MICROPY_FLOAT_CONST(1.0)));
+        result = mp_obj_new_tuple(2, tuple);
     }
+    m_del(signal_complex_t, z, n + 1);
+    m_del(signal_complex_t, p, n + 1);
+    return result;
 }
 
-MP_DEFINE_CONST_FUN_OBJ_KW(signal_sosfilt_obj, 2, signal_sosfilt);
-#endif /* ULAB_SCIPY_SIGNAL_HAS_SOSFILT */
+MP_DEFINE_CONST_FUN_OBJ_KW(signal_butter_obj, 2, signal_butter);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_BUTTER */
 
 static const mp_rom_map_elem_t ulab_scipy_signal_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_signal) },
     #if ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM
         { MP_OBJ_NEW_QSTR(MP_QSTR_spectrogram), (mp_obj_t)&signal_spectrogram_obj },
+        #if ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM_STREAM && (ULAB_MAX_DIMS > 1)
+        { MP_OBJ_NEW_QSTR(MP_QSTR_spectrogram_stream), (mp_obj_t)&signal_spectrogram_stream_obj },
+        #endif
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_WELCH
+        { MP_OBJ_NEW_QSTR(MP_QSTR_welch), (mp_obj_t)&signal_welch_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_CSD
+        { MP_OBJ_NEW_QSTR(MP_QSTR_csd), (mp_obj_t)&signal_csd_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_GOERTZEL
+        { MP_OBJ_NEW_QSTR(MP_QSTR_goertzel), (mp_obj_t)&signal_goertzel_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_SLIDING_DFT
+        { MP_OBJ_NEW_QSTR(MP_QSTR_sliding_dft), (mp_obj_t)&signal_sliding_dft_obj },
     #endif
     #if ULAB_SCIPY_SIGNAL_HAS_SOSFILT
         { MP_OBJ_NEW_QSTR(MP_QSTR_sosfilt), (mp_obj_t)&signal_sosfilt_obj },
     #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_SOSFILTER
+        { MP_OBJ_NEW_QSTR(MP_QSTR_SOSFilter), (mp_obj_t)&signal_sosfilter_type },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_SOSFILT_ZI
+        { MP_OBJ_NEW_QSTR(MP_QSTR_sosfilt_zi), (mp_obj_t)&signal_sosfilt_zi_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_SOSFILTFILT
+        { MP_OBJ_NEW_QSTR(MP_QSTR_sosfiltfilt), (mp_obj_t)&signal_sosfiltfilt_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_LFILTER
+        { MP_OBJ_NEW_QSTR(MP_QSTR_lfilter), (mp_obj_t)&signal_lfilter_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_LFILTER_ZI
+        { MP_OBJ_NEW_QSTR(MP_QSTR_lfilter_zi), (mp_obj_t)&signal_lfilter_zi_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_FILTFILT
+        { MP_OBJ_NEW_QSTR(MP_QSTR_filtfilt), (mp_obj_t)&signal_filtfilt_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_SOSFILT_FIXED
+        { MP_OBJ_NEW_QSTR(MP_QSTR_sosfilt_fixed), (mp_obj_t)&signal_sosfilt_fixed_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_FIRFILT_FIXED
+        { MP_OBJ_NEW_QSTR(MP_QSTR_firfilt_fixed), (mp_obj_t)&signal_firfilt_fixed_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_UPFIRDN
+        { MP_OBJ_NEW_QSTR(MP_QSTR_upfirdn), (mp_obj_t)&signal_upfirdn_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_UPFIRDN_CLASS
+        { MP_OBJ_NEW_QSTR(MP_QSTR_UpFIRDn), (mp_obj_t)&signal_upfirdn_type },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_RESAMPLE_POLY
+        { MP_OBJ_NEW_QSTR(MP_QSTR_resample_poly), (mp_obj_t)&signal_resample_poly_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_DECIMATE
+        { MP_OBJ_NEW_QSTR(MP_QSTR_decimate), (mp_obj_t)&signal_decimate_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_MEDFILT
+        { MP_OBJ_NEW_QSTR(MP_QSTR_medfilt), (mp_obj_t)&signal_medfilt_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_CONVOLVE2D && (ULAB_MAX_DIMS > 1)
+        { MP_OBJ_NEW_QSTR(MP_QSTR_convolve2d), (mp_obj_t)&signal_convolve2d_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_FIND_PEAKS
+        { MP_OBJ_NEW_QSTR(MP_QSTR_find_peaks), (mp_obj_t)&signal_find_peaks_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_GET_WINDOW
+        { MP_OBJ_NEW_QSTR(MP_QSTR_get_window), (mp_obj_t)&signal_get_window_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_FIRWIN
+        { MP_OBJ_NEW_QSTR(MP_QSTR_firwin), (mp_obj_t)&signal_firwin_obj },
+    #endif
+    #if ULAB_SCIPY_SIGNAL_HAS_BUTTER && (ULAB_MAX_DIMS > 1)
+        { MP_OBJ_NEW_QSTR(MP_QSTR_butter), (mp_obj_t)&signal_butter_obj },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_ulab_scipy_signal_globals, ulab_scipy_signal_globals_table);
@@ -15,10 +15,154 @@
 
 #include "../../ulab.h"
 #include "../../ndarray.h"
+#include "../../numpy/fft/fft_tools.h"
 
 extern mp_obj_module_t ulab_scipy_signal_module;
 
-MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(signal_spectrogram_obj);
+#if ULAB_SCIPY_SIGNAL_HAS_CSD && !ULAB_SUPPORTS_COMPLEX
+#error "csd requires ULAB_SUPPORTS_COMPLEX"
+#endif
+
+// the short-time Fourier transform is shared by spectrogram, welch, and csd
+#define SIGNAL_HAS_STFT (ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM || ULAB_SCIPY_SIGNAL_HAS_WELCH || ULAB_SCIPY_SIGNAL_HAS_CSD)
+
+// the helpers of the time-domain filters are shared by several functions
+#define SIGNAL_HAS_SOS_KERNEL (ULAB_SCIPY_SIGNAL_HAS_SOSFILT || ULAB_SCIPY_SIGNAL_HAS_SOSFILTER ||\
+                                ULAB_SCIPY_SIGNAL_HAS_SOSFILT_ZI || ULAB_SCIPY_SIGNAL_HAS_SOSFILTFILT)
+#define SIGNAL_HAS_LFILTER_KERNEL (ULAB_SCIPY_SIGNAL_HAS_LFILTER || ULAB_SCIPY_SIGNAL_HAS_LFILTER_ZI ||\
+                                ULAB_SCIPY_SIGNAL_HAS_FILTFILT)
+#define SIGNAL_HAS_POLYPHASE (ULAB_SCIPY_SIGNAL_HAS_UPFIRDN || ULAB_SCIPY_SIGNAL_HAS_UPFIRDN_CLASS ||\
+                                ULAB_SCIPY_SIGNAL_HAS_RESAMPLE_POLY || ULAB_SCIPY_SIGNAL_HAS_DECIMATE)
+#define SIGNAL_HAS_FILTER_INPUT (ULAB_SCIPY_SIGNAL_HAS_SOSFILTER || ULAB_SCIPY_SIGNAL_HAS_LFILTER ||\
+                                ULAB_SCIPY_SIGNAL_HAS_FILTFILT || ULAB_SCIPY_SIGNAL_HAS_SOSFILTFILT || SIGNAL_HAS_POLYPHASE ||\
+                                ULAB_SCIPY_SIGNAL_HAS_FIND_PEAKS || SIGNAL_HAS_DESIGN)
+#define SIGNAL_HAS_FIXED_POINT (ULAB_SCIPY_SIGNAL_HAS_SOSFILT_FIXED || ULAB_SCIPY_SIGNAL_HAS_FIRFILT_FIXED)
+// the windowed sinc filters of firwin are also the anti-aliasing filters of resample_poly and decimate
+#define SIGNAL_HAS_FIRWIN (ULAB_SCIPY_SIGNAL_HAS_FIRWIN || ULAB_SCIPY_SIGNAL_HAS_RESAMPLE_POLY || ULAB_SCIPY_SIGNAL_HAS_DECIMATE)
+#define SIGNAL_HAS_DESIGN (ULAB_SCIPY_SIGNAL_HAS_FIRWIN || (ULAB_SCIPY_SIGNAL_HAS_BUTTER && (ULAB_MAX_DIMS > 1)))
+
+#if SIGNAL_HAS_STFT
+// The state of a short-time Fourier transform. Everything that depends on the
+// segment length only, i.e., the window, the plan, and the buffers, is set up
+// once, and is then shared by all segments.
+typedef struct _signal_stft_t {
+    size_t nperseg;
+    size_t noverlap;
+    // the number of frequency bins in the output
+    size_t nfreq;
+    bool twosided;
+    bool detrend;
+    mp_float_t scale;
+    mp_float_t *window;
+    fft_plan_obj_t *plan;
+    bool own_plan;
+    // the samples of the current segment; complex segments hold the real
+    // parts first, followed by the imaginary parts
+    mp_float_t *segment;
+    mp_float_t *real;
+    mp_float_t *imag;
+} signal_stft_t;
+
+#if ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM && ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM_STREAM && (ULAB_MAX_DIMS > 1)
+typedef struct _signal_spectrogram_stream_obj_t {
+    mp_obj_base_t base;
+    signal_stft_t stft;
+    // the number of samples waiting in the segment buffer
+    size_t count;
+} signal_spectrogram_stream_obj_t;
+
+extern const mp_obj_type_t signal_spectrogram_stream_type;
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_spectrogram_stream_obj);
+#endif /* ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM_STREAM */
+#endif
+
+#if ULAB_SCIPY_SIGNAL_HAS_SLIDING_DFT
+// The state of a sliding DFT. The samples of the window are kept in a ring buffer, whose
+// oldest sample is at pos, and each bin has its own rotation, and weight of the newest sample.
+typedef struct _signal_sliding_dft_obj_t {
+    mp_obj_base_t base;
+    size_t n;
+    size_t nbins;
+    size_t pos;
+    mp_float_t *buffer;
+    mp_float_t *omega;
+    mp_float_t *rotation;
+    mp_float_t *weight;
+    mp_float_t *real;
+    mp_float_t *imag;
+} signal_sliding_dft_obj_t;
+
+extern const mp_obj_type_t signal_sliding_dft_type;
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_sliding_dft_obj);
+#endif
+
+#if ULAB_SCIPY_SIGNAL_HAS_SOSFILTER
+// the coefficients of the sections are packed into an array of 6 per section,
+// and the state holds the two delays of each section
+typedef struct _signal_sosfilter_obj_t {
+    mp_obj_base_t base;
+    size_t nsections;
+    mp_float_t *coeffs;
+    mp_float_t *state;
+} signal_sosfilter_obj_t;
+
+extern const mp_obj_type_t signal_sosfilter_type;
+#endif
+
+#if ULAB_SCIPY_SIGNAL_HAS_UPFIRDN_CLASS
+// the history holds the (ntaps - 1) / up most recent input samples, and phase is the
+// position of the next output in the upsampled input, relative to the next block
+typedef struct _signal_upfirdn_obj_t {
+    mp_obj_base_t base;
+    size_t ntaps;
+    size_t up;
+    size_t down;
+    size_t nhistory;
+    size_t phase;
+    mp_float_t *taps;
+    mp_float_t *history;
+} signal_upfirdn_obj_t;
+
+extern const mp_obj_type_t signal_upfirdn_type;
+#endif
+
+#if ULAB_SCIPY_SIGNAL_HAS_BUTTER
+// a zero, or a pole of a filter in the z-plane
+typedef struct _signal_complex_t {
+    mp_float_t real;
+    mp_float_t imag;
+} signal_complex_t;
+#endif
+
+#if SIGNAL_HAS_DESIGN
+enum SIGNAL_BAND_TYPE {
+    SIGNAL_LOWPASS,
+    SIGNAL_HIGHPASS,
+    SIGNAL_BANDPASS,
+    SIGNAL_BANDSTOP,
+};
+#endif
+
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_spectrogram_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(signal_sosfilt_obj);
+MP_DECLARE_CONST_FUN_OBJ_1(signal_sosfilt_zi_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_sosfiltfilt_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_lfilter_obj);
+MP_DECLARE_CONST_FUN_OBJ_2(signal_lfilter_zi_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_filtfilt_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_sosfilt_fixed_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_firfilt_fixed_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_upfirdn_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_resample_poly_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_decimate_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_medfilt_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_convolve2d_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_find_peaks_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_get_window_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_firwin_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_butter_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_welch_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_csd_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(signal_goertzel_obj);
 
 #endif /* _SCIPY_SIGNAL_ */
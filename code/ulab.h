@@ -56,6 +56,14 @@
 // This provides better competability with formal Numpy, where a single element taken from an ndarray keeps the type of the ndarray.
 #define NUMPY_HAS_DTYPE_SCALAR			          (1)
 
+// Determines, whether the complex dtype is supported. Complex arrays hold the real and
+// imaginary parts of each element next to each other, i.e., an element takes two mp_float_t
+// values. By default, the dtype is available, if the firmware is compiled with
+// MICROPY_PY_BUILTINS_COMPLEX, which is also required, when the constant is set explicitly
+#ifndef ULAB_SUPPORTS_COMPLEX
+#define ULAB_SUPPORTS_COMPLEX               (MICROPY_PY_BUILTINS_COMPLEX)
+#endif
+
 
 // By setting this constant to 1, iteration over array dimensions will be implemented
 // as a function (ndarray_rewind_array), instead of writing out the loops in macros
@@ -321,6 +329,19 @@
 #define ULAB_NUMPY_HAS_ZEROS            (1)
 #endif
 
+// functions that operate on complex arrays; these are included only, if ULAB_SUPPORTS_COMPLEX is set
+#ifndef ULAB_NUMPY_HAS_CONJUGATE
+#define ULAB_NUMPY_HAS_CONJUGATE        (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_IMAG
+#define ULAB_NUMPY_HAS_IMAG             (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_REAL
+#define ULAB_NUMPY_HAS_REAL             (1)
+#endif
+
 // functions that compare arrays
 #ifndef ULAB_NUMPY_HAS_CLIP
 #define ULAB_NUMPY_HAS_CLIP             (1)
@@ -394,6 +415,31 @@
 #define ULAB_FFT_HAS_IFFT               (1)
 #endif
 
+#ifndef ULAB_FFT_HAS_IRFFT
+#define ULAB_FFT_HAS_IRFFT              (1)
+#endif
+
+// if set, transforms of arbitrary length are supported: lengths with the prime
+// factors 2, 3, and 5 are calculated by a mixed-radix kernel, and all other
+// lengths by Bluestein's algorithm; otherwise, the length must be a power of 2
+#ifndef ULAB_FFT_HAS_MIXED_RADIX
+#define ULAB_FFT_HAS_MIXED_RADIX        (1)
+#endif
+
+#ifndef ULAB_FFT_HAS_PLAN
+#define ULAB_FFT_HAS_PLAN               (1)
+#endif
+
+#ifndef ULAB_FFT_HAS_RFFT
+#define ULAB_FFT_HAS_RFFT               (1)
+#endif
+
+// if set, the twiddle factors of transforms of length up to 1024 are read
+// from a table in read-only memory, instead of being calculated
+#ifndef ULAB_FFT_HAS_TWIDDLE_TABLE
+#define ULAB_FFT_HAS_TWIDDLE_TABLE      (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_ALL
 #define ULAB_NUMPY_HAS_ALL              (1)
 #endif
@@ -410,14 +456,46 @@
 #define ULAB_NUMPY_HAS_ARGSORT          (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_BINCOUNT
+#define ULAB_NUMPY_HAS_BINCOUNT         (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_CONVOLVE
 #define ULAB_NUMPY_HAS_CONVOLVE         (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_CORRELATE
+#define ULAB_NUMPY_HAS_CORRELATE        (1)
+#endif
+
+// convolutions and correlations are calculated by means of the overlap-add FFT method,
+// if the product of the lengths of the arguments is above ULAB_NUMPY_CONVOLVE_FFT_THRESHOLD,
+// and the shorter argument has at least ULAB_NUMPY_CONVOLVE_FFT_MIN_LENGTH elements;
+// a threshold of 0 switches the FFT method off
+#ifndef ULAB_NUMPY_CONVOLVE_FFT_THRESHOLD
+#define ULAB_NUMPY_CONVOLVE_FFT_THRESHOLD   (8192)
+#endif
+
+#ifndef ULAB_NUMPY_CONVOLVE_FFT_MIN_LENGTH
+#define ULAB_NUMPY_CONVOLVE_FFT_MIN_LENGTH  (32)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_CROSS
 #define ULAB_NUMPY_HAS_CROSS            (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_CUMMINMAX
+#define ULAB_NUMPY_HAS_CUMMINMAX        (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_CUMPROD
+#define ULAB_NUMPY_HAS_CUMPROD          (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_CUMSUM
+#define ULAB_NUMPY_HAS_CUMSUM           (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_DIFF
 #define ULAB_NUMPY_HAS_DIFF             (1)
 #endif
@@ -430,6 +508,10 @@
 #define ULAB_NUMPY_HAS_FLIP             (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_HISTOGRAM
+#define ULAB_NUMPY_HAS_HISTOGRAM        (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_INTERP
 #define ULAB_NUMPY_HAS_INTERP           (1)
 #endif
@@ -454,6 +536,10 @@
 #define ULAB_NUMPY_HAS_POLYVAL          (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_PTP
+#define ULAB_NUMPY_HAS_PTP              (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_ROLL
 #define ULAB_NUMPY_HAS_ROLL             (1)
 #endif
@@ -580,6 +666,34 @@
 #define ULAB_NUMPY_HAS_VECTORIZE        (1)
 #endif
 
+// functions that create windows
+#ifndef ULAB_NUMPY_HAS_BLACKMAN
+#define ULAB_NUMPY_HAS_BLACKMAN         (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_HAMMING
+#define ULAB_NUMPY_HAS_HAMMING          (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_HANNING
+#define ULAB_NUMPY_HAS_HANNING          (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_KAISER
+#define ULAB_NUMPY_HAS_KAISER           (1)
+#endif
+
+// the windows of numpy, and scipy.signal are memoised in a static cache of
+// ULAB_WINDOW_CACHE_SIZE windows with ULAB_WINDOW_CACHE_LENGTH values in total;
+// the cache costs ULAB_WINDOW_CACHE_LENGTH floats of RAM, and is disabled by 0
+#ifndef ULAB_WINDOW_CACHE_SIZE
+#define ULAB_WINDOW_CACHE_SIZE          (4)
+#endif
+
+#ifndef ULAB_WINDOW_CACHE_LENGTH
+#define ULAB_WINDOW_CACHE_LENGTH        (512)
+#endif
+
 #ifndef ULAB_SCIPY_HAS_LINALG_MODULE
 #define ULAB_SCIPY_HAS_LINALG_MODULE        (0)
 #endif
@@ -592,6 +706,29 @@
 #define ULAB_SCIPY_LINALG_HAS_SOLVE_TRIANGULAR  (1)
 #endif
 
+#ifndef ULAB_SCIPY_HAS_NDIMAGE_MODULE
+#define ULAB_SCIPY_HAS_NDIMAGE_MODULE       (1)
+#endif
+
+// convolve, and correlate filter separable weights by rows, and columns, and accumulate
+// 8-, and 16-bit integer input in integers
+#ifndef ULAB_SCIPY_NDIMAGE_HAS_CONVOLVE
+#define ULAB_SCIPY_NDIMAGE_HAS_CONVOLVE     (1)
+#endif
+
+#ifndef ULAB_SCIPY_NDIMAGE_HAS_CORRELATE
+#define ULAB_SCIPY_NDIMAGE_HAS_CORRELATE    (1)
+#endif
+
+// the median, and rank filters update a sorted window incrementally
+#ifndef ULAB_SCIPY_NDIMAGE_HAS_MEDIAN_FILTER
+#define ULAB_SCIPY_NDIMAGE_HAS_MEDIAN_FILTER    (1)
+#endif
+
+#ifndef ULAB_SCIPY_NDIMAGE_HAS_RANK_FILTER
+#define ULAB_SCIPY_NDIMAGE_HAS_RANK_FILTER  (1)
+#endif
+
 #ifndef ULAB_SCIPY_HAS_SIGNAL_MODULE
 #define ULAB_SCIPY_HAS_SIGNAL_MODULE        (1)
 #endif
@@ -600,10 +737,113 @@
 #define ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM   (1)
 #endif
 
+// the streaming spectrogram keeps the state of the short-time Fourier transform
+// between calls; it requires ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM
+#ifndef ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM_STREAM
+#define ULAB_SCIPY_SIGNAL_HAS_SPECTROGRAM_STREAM    (1)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_WELCH
+#define ULAB_SCIPY_SIGNAL_HAS_WELCH         (1)
+#endif
+
+// the cross spectral density is returned as a complex array
+#ifndef ULAB_SCIPY_SIGNAL_HAS_CSD
+#define ULAB_SCIPY_SIGNAL_HAS_CSD           (ULAB_SUPPORTS_COMPLEX)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_GOERTZEL
+#define ULAB_SCIPY_SIGNAL_HAS_GOERTZEL      (1)
+#endif
+
+// the sliding DFT is a callable object that tracks a few frequencies of a stream of samples
+#ifndef ULAB_SCIPY_SIGNAL_HAS_SLIDING_DFT
+#define ULAB_SCIPY_SIGNAL_HAS_SLIDING_DFT   (1)
+#endif
+
 #ifndef ULAB_SCIPY_SIGNAL_HAS_SOSFILT
 #define ULAB_SCIPY_SIGNAL_HAS_SOSFILT       (1)
 #endif
 
+// the SOSFilter class keeps the coefficients, and the state of the filter between calls
+#ifndef ULAB_SCIPY_SIGNAL_HAS_SOSFILTER
+#define ULAB_SCIPY_SIGNAL_HAS_SOSFILTER     (1)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_SOSFILT_ZI
+#define ULAB_SCIPY_SIGNAL_HAS_SOSFILT_ZI    (1)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_SOSFILTFILT
+#define ULAB_SCIPY_SIGNAL_HAS_SOSFILTFILT   (1)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_LFILTER
+#define ULAB_SCIPY_SIGNAL_HAS_LFILTER       (1)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_LFILTER_ZI
+#define ULAB_SCIPY_SIGNAL_HAS_LFILTER_ZI    (1)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_FILTFILT
+#define ULAB_SCIPY_SIGNAL_HAS_FILTFILT      (1)
+#endif
+
+// fixed-point filters of int16 (Q15), and int32 (Q31) arrays, which can be filtered in place
+#ifndef ULAB_SCIPY_SIGNAL_HAS_SOSFILT_FIXED
+#define ULAB_SCIPY_SIGNAL_HAS_SOSFILT_FIXED (1)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_FIRFILT_FIXED
+#define ULAB_SCIPY_SIGNAL_HAS_FIRFILT_FIXED (1)
+#endif
+
+// polyphase resampling; UpFIRDn is the streaming version of upfirdn
+#ifndef ULAB_SCIPY_SIGNAL_HAS_UPFIRDN
+#define ULAB_SCIPY_SIGNAL_HAS_UPFIRDN       (1)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_UPFIRDN_CLASS
+#define ULAB_SCIPY_SIGNAL_HAS_UPFIRDN_CLASS (1)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_RESAMPLE_POLY
+#define ULAB_SCIPY_SIGNAL_HAS_RESAMPLE_POLY (1)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_DECIMATE
+#define ULAB_SCIPY_SIGNAL_HAS_DECIMATE      (1)
+#endif
+
+// medfilt calls the rank filter of scipy/ndimage with zero padding
+#ifndef ULAB_SCIPY_SIGNAL_HAS_MEDFILT
+#define ULAB_SCIPY_SIGNAL_HAS_MEDFILT       (1)
+#endif
+
+// convolve2d calls the correlation of scipy/ndimage
+#ifndef ULAB_SCIPY_SIGNAL_HAS_CONVOLVE2D
+#define ULAB_SCIPY_SIGNAL_HAS_CONVOLVE2D    (1)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_GET_WINDOW
+#define ULAB_SCIPY_SIGNAL_HAS_GET_WINDOW    (1)
+#endif
+
+#ifndef ULAB_SCIPY_SIGNAL_HAS_FIRWIN
+#define ULAB_SCIPY_SIGNAL_HAS_FIRWIN        (1)
+#endif
+
+// the second-order sections of butter are returned as a two-dimensional array
+#ifndef ULAB_SCIPY_SIGNAL_HAS_BUTTER
+#define ULAB_SCIPY_SIGNAL_HAS_BUTTER        (1)
+#endif
+
+// the prominences of find_peaks are computed with a stack in linear time
+#ifndef ULAB_SCIPY_SIGNAL_HAS_FIND_PEAKS
+#define ULAB_SCIPY_SIGNAL_HAS_FIND_PEAKS    (1)
+#endif
+
 #ifndef ULAB_SCIPY_HAS_OPTIMIZE_MODULE
 #define ULAB_SCIPY_HAS_OPTIMIZE_MODULE      (1)
 #endif
@@ -670,4 +910,12 @@
 #define ULAB_UTILS_HAS_FROM_UINT32_BUFFER   (1)
 #endif
 
+#ifndef ULAB_UTILS_HAS_MINMAX
+#define ULAB_UTILS_HAS_MINMAX               (1)
+#endif
+
+#ifndef ULAB_UTILS_HAS_REDUCEAT
+#define ULAB_UTILS_HAS_REDUCEAT             (1)
+#endif
+
 #endif
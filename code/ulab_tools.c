@@ -61,6 +61,7 @@ mp_float_t ndarray_get_float_float(void *data) {
 
 // returns a single function pointer, depending on the dtype
 void *ndarray_get_float_function(uint8_t dtype) {
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(dtype)
     if(dtype == NDARRAY_UINT8) {
         return ndarray_get_float_uint8;
     } else if(dtype == NDARRAY_INT8) {
@@ -82,6 +83,7 @@ void *ndarray_get_float_function(uint8_t dtype) {
 
 mp_float_t ndarray_get_float_index(void *data, uint8_t dtype, size_t index) {
     // returns a single float value from an array located at index
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(dtype)
     if(dtype == NDARRAY_UINT8) {
         return (mp_float_t)((uint8_t *)data)[index];
     } else if(dtype == NDARRAY_INT8) {
@@ -104,6 +106,7 @@ mp_float_t ndarray_get_float_index(void *data, uint8_t dtype, size_t index) {
 mp_float_t ndarray_get_float_value(void *data, uint8_t dtype) {
     // Returns a float value from an arbitrary data type
     // The value in question is supposed to be located at the head of the pointer
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(dtype)
     if(dtype == NDARRAY_UINT8) {
         return (mp_float_t)(*(uint8_t *)data);
     } else if(dtype == NDARRAY_INT8) {
@@ -249,6 +252,31 @@ shape_strides tools_reduce_axes(ndarray_obj_t *ndarray, mp_obj_t axis) {
 }
 
 
+ndarray_obj_t *tools_output_array(mp_obj_t out, uint8_t ndim, size_t *shape, uint8_t dtype) {
+    // Returns a new dense array of the given shape and dtype, if out is None,
+    // otherwise, checks, whether out can hold the results, and returns it.
+    // out need not be dense, so that views can be filled in place
+    if(out == mp_const_none) {
+        return ndarray_new_dense_ndarray(ndim, shape, dtype);
+    }
+    if(!mp_obj_is_type(out, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("out must be an ndarray"));
+    }
+    ndarray_obj_t *results = MP_OBJ_TO_PTR(out);
+    if(results->dtype != dtype) {
+        mp_raise_ValueError(translate("wrong output type"));
+    }
+    if(results->ndim != ndim) {
+        mp_raise_ValueError(translate("input and output shapes are not compatible"));
+    }
+    for(uint8_t i = ULAB_MAX_DIMS - ndim; i < ULAB_MAX_DIMS; i++) {
+        if(results->shape[i] != shape[i]) {
+            mp_raise_ValueError(translate("input and output shapes are not compatible"));
+        }
+    }
+    return results;
+}
+
 #if ULAB_MAX_DIMS > 1
 ndarray_obj_t *tools_object_is_square(mp_obj_t obj) {
     // Returns an ndarray, if the object is a square ndarray,
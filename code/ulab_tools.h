@@ -16,6 +16,15 @@
 
 #define SWAP(t, a, b) { t tmp = a; a = b; b = tmp; }
 
+// functions that would silently drop the imaginary part bail out on complex arrays
+#if ULAB_SUPPORTS_COMPLEX
+#define COMPLEX_DTYPE_NOT_IMPLEMENTED(dtype) if((dtype) == NDARRAY_COMPLEX) {\
+    mp_raise_TypeError(translate("function is not implemented for complex dtype"));\
+}
+#else
+#define COMPLEX_DTYPE_NOT_IMPLEMENTED(dtype)
+#endif
+
 typedef struct _shape_strides_t {
     uint8_t increment;
     uint8_t ndim;
@@ -34,6 +43,7 @@ uint8_t ndarray_upcast_dtype(uint8_t , uint8_t );
 void *ndarray_set_float_function(uint8_t );
 
 shape_strides tools_reduce_axes(ndarray_obj_t *, mp_obj_t );
+ndarray_obj_t *tools_output_array(mp_obj_t , uint8_t , size_t *, uint8_t );
 ndarray_obj_t *tools_object_is_square(mp_obj_t );
 int python_type_to_index(char ch, int* w);
 mp_obj_t numpy_operators_main(int* p1, int* p2, uint8_t* array8, mp_binary_op_t op, uint8_t temp_type, int n, mp_obj_t results);
@@ -14,7 +14,10 @@
 #include "py/obj.h"
 #include "py/runtime.h"
 #include "py/misc.h"
+#include "py/objstr.h"
+#include "../ulab_tools.h"
 #include "utils.h"
+#include "../numpy/numerical/numerical.h"
 
 #if ULAB_HAS_UTILS_MODULE
 
@@ -187,6 +190,185 @@ static mp_obj_t utils_from_uint32_buffer(size_t n_args, const mp_obj_t *pos_args
 MP_DEFINE_CONST_FUN_OBJ_KW(utils_from_uint32_buffer_obj, 1, utils_from_uint32_buffer);
 #endif
 
+#if ULAB_UTILS_HAS_MINMAX
+static mp_obj_t utils_minmax(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } } ,
+        { MP_QSTR_axis, MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+        { MP_QSTR_indices, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = false } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *ndarray = ndarray_from_mp_obj(args[0].u_obj);
+    return numerical_minmax_ndarray(ndarray, args[1].u_obj, false, args[2].u_bool);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(utils_minmax_obj, 1, utils_minmax);
+#endif
+
+#if ULAB_UTILS_HAS_REDUCEAT
+//| def reduceat(a: ulab.ndarray, indices: _ArrayLike, *, op: str = "sum") -> ulab.ndarray:
+//|     """
+//|     :param ulab.ndarray a: one-dimensional input array
+//|     :param indices: the start indices of the segments in increasing order; they must be integers
+//|     :param str op: the reduction, one of 'sum', 'min', 'max', or 'mean'
+//|
+//|     Reduce the segments of a in a single pass, similar to numpy's ufunc.reduceat.
+//|     The i-th segment is a[indices[i]:indices[i+1]], or the single element a[indices[i]],
+//|     if indices[i+1] is not larger than indices[i]; the last segment extends to the end of a.
+//|     The sums of 8- and 16-bit integers are returned as int32, the means as float, while the
+//|     extrema retain the type of a."""
+//|     ...
+//|
+
+enum UTILS_REDUCEAT_TYPE {
+    UTILS_REDUCEAT_SUM,
+    UTILS_REDUCEAT_MIN,
+    UTILS_REDUCEAT_MAX,
+    UTILS_REDUCEAT_MEAN,
+};
+
+#define UTILS_REDUCEAT(dtype, atype, array, astride, len, starts, nseg, rarray, op)\
+{\
+    if((dtype) == NDARRAY_UINT8) {\
+        UTILS_REDUCEAT_LOOP(uint8_t, atype, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else if((dtype) == NDARRAY_INT8) {\
+        UTILS_REDUCEAT_LOOP(int8_t, atype, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else if((dtype) == NDARRAY_UINT16) {\
+        UTILS_REDUCEAT_LOOP(uint16_t, atype, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else if((dtype) == NDARRAY_INT16) {\
+        UTILS_REDUCEAT_LOOP(int16_t, atype, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else if((dtype) == NDARRAY_UINT32) {\
+        UTILS_REDUCEAT_LOOP(uint32_t, atype, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else if((dtype) == NDARRAY_INT32) {\
+        UTILS_REDUCEAT_LOOP(int32_t, atype, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else if((dtype) == NDARRAY_INT64) {\
+        UTILS_REDUCEAT_LOOP(int64_t, atype, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else {\
+        UTILS_REDUCEAT_LOOP(mp_float_t, atype, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    }\
+}
+
+// the extrema are stored in the type of the input
+#define UTILS_REDUCEAT_SAME_TYPE(dtype, array, astride, len, starts, nseg, rarray, op)\
+{\
+    if((dtype) == NDARRAY_UINT8) {\
+        UTILS_REDUCEAT_LOOP(uint8_t, uint8_t, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else if((dtype) == NDARRAY_INT8) {\
+        UTILS_REDUCEAT_LOOP(int8_t, int8_t, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else if((dtype) == NDARRAY_UINT16) {\
+        UTILS_REDUCEAT_LOOP(uint16_t, uint16_t, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else if((dtype) == NDARRAY_INT16) {\
+        UTILS_REDUCEAT_LOOP(int16_t, int16_t, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else if((dtype) == NDARRAY_UINT32) {\
+        UTILS_REDUCEAT_LOOP(uint32_t, uint32_t, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else if((dtype) == NDARRAY_INT32) {\
+        UTILS_REDUCEAT_LOOP(int32_t, int32_t, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else if((dtype) == NDARRAY_INT64) {\
+        UTILS_REDUCEAT_LOOP(int64_t, int64_t, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    } else {\
+        UTILS_REDUCEAT_LOOP(mp_float_t, mp_float_t, (array), (astride), (len), (starts), (nseg), (rarray), op);\
+    }\
+}
+
+static mp_obj_t utils_reduceat(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } } ,
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } } ,
+        { MP_QSTR_op, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_QSTR(MP_QSTR_sum) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *ndarray = ndarray_from_mp_obj(args[0].u_obj);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    if(ndarray->ndim != 1) {
+        mp_raise_ValueError(translate("input must be a 1D ndarray"));
+    }
+
+    if(!mp_obj_is_str(args[2].u_obj)) {
+        mp_raise_TypeError(translate("op must be a string"));
+    }
+    qstr op = mp_obj_str_get_qstr(args[2].u_obj);
+    uint8_t optype;
+    if(op == MP_QSTR_sum) {
+        optype = UTILS_REDUCEAT_SUM;
+    } else if(op == MP_QSTR_min) {
+        optype = UTILS_REDUCEAT_MIN;
+    } else if(op == MP_QSTR_max) {
+        optype = UTILS_REDUCEAT_MAX;
+    } else if(op == MP_QSTR_mean) {
+        optype = UTILS_REDUCEAT_MEAN;
+    } else {
+        mp_raise_ValueError(translate("op must be one of 'sum', 'min', 'max', or 'mean'"));
+    }
+
+    ndarray_obj_t *indices = ndarray_from_mp_obj(args[1].u_obj);
+    if(indices->ndim > 1) {
+        mp_raise_ValueError(translate("indices must be a 1D array"));
+    }
+    size_t nseg = indices->len;
+    size_t len = ndarray->len;
+
+    // the start indices are validated before the reduction, so that the kernel is free of checks
+    size_t *starts = m_new(size_t, nseg);
+    uint8_t *iarray = (uint8_t *)indices->array;
+    mp_float_t (*func)(void *) = ndarray_get_float_function(indices->dtype);
+    for(size_t i=0; i < nseg; i++) {
+        mp_float_t index = func(iarray);
+        iarray += indices->strides[ULAB_MAX_DIMS - 1];
+        // this also rejects nan
+        if(MICROPY_FLOAT_C_FUN(floor)(index) != index) {
+            m_del(size_t, starts, nseg);
+            mp_raise_TypeError(translate("indices must be integers"));
+        }
+        if((index < MICROPY_FLOAT_CONST(0.0)) || (index >= (mp_float_t)len)) {
+            m_del(size_t, starts, nseg);
+            mp_raise_ValueError(translate("index out of range"));
+        }
+        starts[i] = (size_t)index;
+    }
+
+    uint8_t dtype = ndarray->dtype;
+    if(optype == UTILS_REDUCEAT_MEAN) {
+        dtype = NDARRAY_FLOAT;
+    } else if((optype == UTILS_REDUCEAT_SUM) && (ndarray->itemsize < 4)) {
+        dtype = NDARRAY_INT32;
+    }
+    ndarray_obj_t *results = ndarray_new_linear_array(nseg, dtype);
+    uint8_t *array = (uint8_t *)ndarray->array;
+    int32_t astride = ndarray->strides[ULAB_MAX_DIMS - 1];
+
+    if(nseg != 0) {
+        if(optype == UTILS_REDUCEAT_MIN) {
+            UTILS_REDUCEAT_SAME_TYPE(ndarray->dtype, array, astride, len, starts, nseg, results->array, NUMERICAL_CUMMIN_OP);
+        } else if(optype == UTILS_REDUCEAT_MAX) {
+            UTILS_REDUCEAT_SAME_TYPE(ndarray->dtype, array, astride, len, starts, nseg, results->array, NUMERICAL_CUMMAX_OP);
+        } else if(optype == UTILS_REDUCEAT_MEAN) {
+            UTILS_REDUCEAT(ndarray->dtype, mp_float_t, array, astride, len, starts, nseg, results->array, NUMERICAL_CUMSUM_OP);
+            mp_float_t *rarray = (mp_float_t *)results->array;
+            for(size_t s=0; s < nseg; s++) {
+                size_t end = s < nseg - 1 ? starts[s + 1] : len;
+                if(end > starts[s]) {
+                    rarray[s] /= (mp_float_t)(end - starts[s]);
+                }
+            }
+        } else if(dtype == NDARRAY_INT32) {
+            UTILS_REDUCEAT(ndarray->dtype, int32_t, array, astride, len, starts, nseg, results->array, NUMERICAL_CUMSUM_OP);
+        } else {
+            UTILS_REDUCEAT_SAME_TYPE(ndarray->dtype, array, astride, len, starts, nseg, results->array, NUMERICAL_CUMSUM_OP);
+        }
+    }
+    m_del(size_t, starts, nseg);
+    return MP_OBJ_FROM_PTR(results);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(utils_reduceat_obj, 2, utils_reduceat);
+#endif
+
 #endif
 
 static const mp_rom_map_elem_t ulab_utils_globals_table[] = {
@@ -203,6 +385,12 @@ static const mp_rom_map_elem_t ulab_utils_globals_table[] = {
     #if ULAB_UTILS_HAS_FROM_UINT32_BUFFER
         { MP_OBJ_NEW_QSTR(MP_QSTR_from_uint32_buffer), (mp_obj_t)&utils_from_uint32_buffer_obj },
     #endif
+    #if ULAB_UTILS_HAS_MINMAX
+        { MP_OBJ_NEW_QSTR(MP_QSTR_minmax), (mp_obj_t)&utils_minmax_obj },
+    #endif
+    #if ULAB_UTILS_HAS_REDUCEAT
+        { MP_OBJ_NEW_QSTR(MP_QSTR_reduceat), (mp_obj_t)&utils_reduceat_obj },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_ulab_utils_globals, ulab_utils_globals_table);
@@ -14,6 +14,28 @@
 #include "../ulab.h"
 #include "../ndarray.h"
 
+// Reduces the segments [starts[i], starts[i+1]) of a one-dimensional array in a single
+// linear pass; an empty, or backward segment consists of the single element at starts[i],
+// as in numpy's reduceat
+#define UTILS_REDUCEAT_LOOP(type, atype, array, astride, len, starts, nseg, rarray, op)\
+{\
+    atype *_rarray = (atype *)(rarray);\
+    for(size_t s=0; s < (nseg); s++) {\
+        size_t start = (starts)[s];\
+        size_t end = s < (nseg) - 1 ? (starts)[s + 1] : (len);\
+        if(end <= start) {\
+            end = start + 1;\
+        }\
+        uint8_t *_array = (array) + (int32_t)start * (astride);\
+        atype acc = (atype)(*((type *)_array));\
+        for(size_t i=start+1; i < end; i++) {\
+            _array += (astride);\
+            acc = op(acc, (atype)(*((type *)_array)));\
+        }\
+        *_rarray++ = acc;\
+    }\
+}
+
 extern mp_obj_module_t ulab_utils_module;
 
 #endif
@@ -0,0 +1,50 @@
+import math
+from ulab import numpy as np
+
+def close(p, q):
+    return math.isclose(p.real, q.real, abs_tol=1e-6) and math.isclose(p.imag, q.imag, abs_tol=1e-6)
+
+a = np.array([1+2j, 3-4j, 1j])
+b = np.array([2, 1+1j, -1+0.5j], dtype=np.complex)
+f = np.array([1, 2, 3], dtype=np.float)
+
+print(a.dtype == np.complex, len(a), a[1])
+print([close(p, q) for p, q in zip(a + b, [3+2j, 4-3j, -1+1.5j])])
+print([close(p, q) for p, q in zip(a - b, [-1+2j, 2-5j, 1+0.5j])])
+print([close(p, q) for p, q in zip(a * b, [2+4j, 7-1j, -0.5-1j])])
+print([close(p, q) for p, q in zip(a / b, [0.5+1j, -0.5-3.5j, 0.4-0.8j])])
+print([close(p, q) for p, q in zip(a * f, [1+2j, 6-8j, 3j])])
+print([close(p, q) for p, q in zip(f - a, [-2j, -1+4j, 3-1j])])
+print([close(p, q) for p, q in zip(a * 1j, [-2+1j, 4+3j, -1])])
+print(list(a == a), list(a != b))
+print([math.isclose(p, q, abs_tol=1e-6) for p, q in zip(abs(a), [math.sqrt(5), 5, 1])])
+print([close(p, q) for p, q in zip(-a, [-1-2j, -3+4j, -1j])])
+
+print(list(np.real(a)), list(np.imag(a)))
+print([close(p, q) for p, q in zip(np.conjugate(a), [1-2j, 3+4j, -1j])])
+print(list(np.real(f)), list(np.imag(f)))
+
+m = np.zeros((2, 3), dtype=np.complex)
+m[0] = a
+m[1, 1:] = 5j
+print([close(p, q) for p, q in zip(m[0], a)], [close(p, q) for p, q in zip(m[1], [0, 5j, 5j])])
+
+x = np.array([1+1j, 2-1j, -1+0.5j, 0.25j, 3, -2-2j, 1j, 0.5])
+X = np.fft.fft(x)
+print(X.dtype == np.complex)
+n = len(x)
+ref = []
+for k in range(n):
+    s = 0j
+    for j in range(n):
+        t = -2 * math.pi * k * j / n
+        s += x[j] * complex(math.cos(t), math.sin(t))
+    ref.append(s)
+print([close(p, q) for p, q in zip(X, ref)])
+print([close(p, q) for p, q in zip(np.fft.ifft(X), x)])
+
+for f in (np.sum, np.max, np.cumsum, np.sort):
+    try:
+        f(x)
+    except TypeError:
+        print('TypeError')
@@ -13,3 +13,18 @@ cmp_result = []
 for p,q in zip(list(result), list(ref_result)):
     cmp_result.append(math.isclose(p, q, rel_tol=1e-06, abs_tol=1e-06))
 print(cmp_result)
+
+for mode in ('full', 'same', 'valid'):
+    print(mode, list(np.convolve(x, y, mode=mode)), list(np.convolve(y, x, mode=mode)))
+
+try:
+    np.convolve(x, y, mode='none')
+except ValueError:
+    print("ValueError")
+
+# long arguments are convolved by means of the FFT
+a = np.array([math.sin(0.1 * i) for i in range(1000)])
+b = np.array([math.exp(-0.05 * i) for i in range(100)])
+c = np.convolve(a, b)
+ref = [sum([a[k - i] * b[i] for i in range(max(0, k - 999), min(k, 99) + 1)]) for k in range(1099)]
+print(len(c), all([math.isclose(p, q, rel_tol=1e-04, abs_tol=1e-04) for p, q in zip(list(c), ref)]))
@@ -0,0 +1,21 @@
+import math
+
+try:
+    from ulab import numpy as np
+except ImportError:
+    import numpy as np
+
+x = np.array([1, 2, 3])
+y = np.array([0, 1, 0.5, 2])
+
+for mode in ('full', 'same', 'valid'):
+    print(mode, list(np.correlate(x, y, mode=mode)), list(np.correlate(y, x, mode=mode)))
+
+print(list(np.correlate(x, np.array([0, 1, 0.5]))))
+
+# long arguments are correlated by means of the FFT
+a = np.array([math.sin(0.1 * i) for i in range(1000)])
+b = np.array([math.exp(-0.05 * i) for i in range(100)])
+c = np.correlate(a, b)
+ref = [sum([a[k + i] * b[i] for i in range(100)]) for k in range(901)]
+print(len(c), all([math.isclose(p, q, rel_tol=1e-04, abs_tol=1e-04) for p, q in zip(list(c), ref)]))
@@ -0,0 +1,63 @@
+try:
+    from ulab import numpy as np
+except ImportError:
+    import numpy as np
+
+print("Testing np.cumsum:")
+a = np.array([1, 2, 3, 4], dtype=np.uint8)
+print(list(np.cumsum(a)))
+# 8-, and 16-bit integers are accumulated in int32
+a = np.array([200, 200, 200], dtype=np.uint8)
+print(list(np.cumsum(a)))
+a = np.array([30000, 30000], dtype=np.int16)
+print(list(np.cumsum(a)))
+a = np.array([[1, 2, 3], [4, 5, 6]], dtype=np.int16)
+print(list(np.cumsum(a)))
+print([list(row) for row in np.cumsum(a, axis=0)])
+print([list(row) for row in np.cumsum(a, axis=1)])
+print([list(row) for row in np.cumsum(a, axis=-1)])
+a = np.array([0.5, 0.5, 1.0, 2.0])
+print(list(np.cumsum(a)))
+
+print("Testing np.cumprod:")
+a = np.array([1, 2, 3, 4], dtype=np.int8)
+print(list(np.cumprod(a)))
+a = np.array([[1, 2], [3, 4]], dtype=np.uint16)
+print([list(row) for row in np.cumprod(a, axis=0)])
+print([list(row) for row in np.cumprod(a, axis=1)])
+a = np.array([1.0, 2.0, 0.5, 4.0])
+print(list(np.cumprod(a)))
+
+print("Testing np.cummax, and np.cummin:")
+a = np.array([3, 1, 4, 1, 5, 9, 2, 6], dtype=np.float)
+print(list(np.cummax(a)))
+print(list(np.cummin(a)))
+a = np.array([[1, 5], [3, 2], [0, 7]], dtype=np.uint8)
+print([list(row) for row in np.cummax(a, axis=0)])
+print([list(row) for row in np.cummin(a, axis=0)])
+print([list(row) for row in np.cummax(a, axis=1)])
+a = np.array([-1, -3, 2, -5], dtype=np.int8)
+print(list(np.cummin(a)))
+
+print("Testing the out keyword:")
+a = np.array([0.5, 0.5, 1.0, 2.0])
+b = np.zeros(4)
+np.cumsum(a, out=b)
+print(list(b))
+np.cumprod(a, out=a)
+print(list(a))
+a = np.array([[1, 2], [3, 4]], dtype=np.int16)
+b = np.zeros((2, 2), dtype=np.int16)
+np.cummax(a, axis=1, out=b)
+print([list(row) for row in b])
+try:
+    np.cumsum(np.array([1, 2, 3], dtype=np.uint8), out=np.zeros(3))
+except ValueError:
+    print("ValueError")
+try:
+    np.cumsum(np.array([1.0, 2.0, 3.0]), out=np.zeros(4))
+except ValueError:
+    print("ValueError")
+# a view with a reversed inner axis is not contiguous
+a = np.array([[0, 1, 2], [3, 4, 5]], dtype=np.float)
+print(list(np.cumsum(a[:, ::-1])))
@@ -0,0 +1,42 @@
+import math
+from ulab import numpy as np
+
+def isclose(a, b):
+    return all([math.isclose(p, q, rel_tol=1e-05, abs_tol=1e-05) for p, q in zip(list(a), list(b))])
+
+rows = [[math.sin(0.3 * i + j) + 0.1 * j * i for i in range(8)] for j in range(3)]
+x = np.array(rows)
+
+# every row is transformed
+a, b = np.fft.fft(x)
+print(a.shape, b.shape)
+for j in range(3):
+    c, d = np.fft.fft(np.array(rows[j]))
+    print(isclose(a[j], c), isclose(b[j], d))
+
+c, d = np.fft.ifft(a, b, axis=1)
+print([isclose(c[j], x[j]) for j in range(3)], [isclose(d[j], np.zeros(8)) for j in range(3)])
+
+# every column is transformed
+a, b = np.fft.fft(x, axis=0)
+print(a.shape)
+for i in range(8):
+    c, d = np.fft.fft(np.array([rows[j][i] for j in range(3)]))
+    print(isclose(a[:, i], c), isclose(b[:, i], d))
+
+# a shared plan, and in-place transform of the rows
+p = np.fft.plan(8)
+y = x.copy()
+a, b = np.fft.fft(y, plan=p, overwrite_x=True)
+c, d = np.fft.fft(x)
+print(a is y, [isclose(a[j], c[j]) for j in range(3)], [isclose(b[j], d[j]) for j in range(3)])
+
+try:
+    np.fft.fft(x, axis=2)
+except ValueError:
+    print('ValueError')
+
+try:
+    np.fft.fft(x, plan=p, axis=0)
+except ValueError:
+    print('ValueError')
@@ -0,0 +1,44 @@
+import math
+from ulab import numpy as np
+
+def isclose(a, b, tol):
+    return [math.isclose(p, q, rel_tol=tol, abs_tol=tol) for p, q in zip(list(a), list(b))]
+
+def dft(x, bins):
+    n = len(x)
+    re = [sum([x[i] * math.cos(2 * math.pi * k * i / n) for i in range(n)]) for k in bins]
+    im = [-sum([x[i] * math.sin(2 * math.pi * k * i / n) for i in range(n)]) for k in bins]
+    return re, im
+
+# 3, 5, 6, 12, 15, 1000 are calculated by the mixed-radix kernel, 7, 14, 97 by Bluestein's algorithm
+for n in (3, 5, 6, 7, 12, 14, 15, 97, 1000):
+    x = [math.sin(0.37 * i) + 0.2 * math.cos(1.3 * i * i) for i in range(n)]
+    y = np.array(x)
+    bins = range(0, n, 1 + n // 16)
+    tol = 1e-5 * n
+    re, im = dft(x, bins)
+    a, b = np.fft.fft(y)
+    print(n, all(isclose([a[k] for k in bins], re, tol)), all(isclose([b[k] for k in bins], im, tol)))
+    c, d = np.fft.ifft(a, b)
+    print(all(isclose(c, y, 1e-5)), all(isclose(d, np.zeros(n), 1e-5)))
+    c, d = np.fft.rfft(y)
+    print(len(c), all(isclose(c, a[:n//2+1], tol)), all(isclose(d, b[:n//2+1], tol)))
+    if n % 2 == 0:
+        print(all(isclose(np.fft.irfft(c, d), y, 1e-5)))
+
+p = np.fft.plan(12)
+print(p)
+y = np.array(range(12))
+a, b = np.fft.fft(y, plan=p)
+print(all(isclose(a, [66.0] + [-6.0] * 11, 1e-5)))
+c, d = np.fft.ifft(a, b, plan=p)
+print(all(isclose(c, y, 1e-5)))
+
+p = np.fft.plan(11)
+a, b = np.fft.fft(np.ones(11), plan=p)
+print(all(isclose(a, [11.0] + [0.0] * 10, 1e-5)), all(isclose(b, np.zeros(11), 1e-5)))
+
+try:
+    np.fft.fft(np.array([]))
+except ValueError as e:
+    print('ValueError')
@@ -0,0 +1,28 @@
+import math
+from ulab import numpy as np
+
+def isclose(a, b):
+    return [math.isclose(p, q, rel_tol=1e-05, abs_tol=1e-05) for p, q in zip(list(a), list(b))]
+
+for n in (2, 8, 32, 64, 12):
+    x = np.array([math.sin(0.3 * i) + 0.5 * math.cos(0.9 * i) for i in range(n)])
+    a, b = np.fft.fft(x)
+    y = x.copy()
+    c, d = np.fft.fft(y, overwrite_x=True)
+    print(n, c is y, all(isclose(a, y)), all(isclose(b, d)))
+    # both parts are transformed in place
+    e, f = np.fft.ifft(c, d, overwrite_x=True)
+    print(e is c, f is d, all(isclose(e, x)), all(isclose(f, np.zeros(n))))
+
+# integer arrays, strided views, and overlapping parts are not overwritten
+x = np.array(range(8), dtype=np.uint8)
+a, b = np.fft.fft(x, overwrite_x=True)
+print(a is x, list(x))
+
+x = np.array(range(16))
+a, b = np.fft.fft(x[::2], overwrite_x=True)
+print(list(x[::2]), all(isclose(a, np.fft.fft(x[::2])[0])))
+
+x = np.ones(8)
+a, b = np.fft.fft(x, x, overwrite_x=True)
+print(a is x, b is x, all(isclose(a, [8.0] + [0.0] * 7)), all(isclose(b, [8.0] + [0.0] * 7)))
@@ -0,0 +1,30 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+def isclose(a, b):
+    return [math.isclose(p, q, rel_tol=1e-05, abs_tol=1e-05) for p, q in zip(list(a), list(b))]
+
+for n in (8, 2048):
+    x = np.linspace(0, 10, num=n)
+    y = np.sin(x) + 0.5 * np.cos(3 * x)
+    p = np.fft.plan(n)
+    a, b = np.fft.fft(y)
+    c, d = np.fft.fft(y, plan=p)
+    print(p, all(isclose(a, c)), all(isclose(b, d)))
+    e, f = np.fft.ifft(c, d, plan=p)
+    print(all(isclose(e, y)))
+    print(all(isclose(spy.signal.spectrogram(y, plan=p), np.sqrt(a * a + b * b))))
+
+# compare with the direct evaluation of the DFT
+y = np.array([1.0, 2.0, 0.0, -1.0, 3.0, 0.5, 0.0, 2.0])
+a, b = np.fft.fft(y, plan=np.fft.plan(8))
+re = [sum([y[i] * math.cos(2 * math.pi * k * i / 8) for i in range(8)]) for k in range(8)]
+im = [-sum([y[i] * math.sin(2 * math.pi * k * i / 8) for i in range(8)]) for k in range(8)]
+print(isclose(a, re))
+print(isclose(b, im))
+
+try:
+    np.fft.fft(y, plan=np.fft.plan(16))
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,38 @@
+try:
+    from ulab import numpy as np
+except ImportError:
+    import numpy as np
+
+a = np.array([0, 1, 1, 3, 2, 1, 7], dtype=np.uint8)
+print(list(np.bincount(a)))
+print(list(np.bincount(a, minlength=10)))
+w = np.array([0.5, 1.0, 1.0, 0.25, 2.0, 1.0, 0.5])
+print(list(np.bincount(a, weights=w)))
+
+a = np.array([1, 2, 1, 4, 4, 4, 0, 3], dtype=np.uint8)
+counts, edges = np.histogram(a, bins=4)
+print(list(counts))
+print(list(edges))
+a = np.array([1, 2, 1, 4, 4, 4, 0, 3], dtype=np.int16)
+counts, edges = np.histogram(a, bins=4)
+print(list(counts))
+counts, edges = np.histogram(a, bins=2, range=(1, 3))
+print(list(counts))
+print(list(edges))
+
+a = np.array([0.5, 1.5, 2.5, 2.75, 3.0, 9.0])
+counts, edges = np.histogram(a, bins=np.array([0.0, 1.0, 2.0, 3.0]))
+print(list(counts))
+counts, edges = np.histogram(a, bins=np.array([0.0, 1.0, 2.0, 3.0]), weights=np.array([1.0, 2.0, 3.0, 4.0, 5.0, 6.0]))
+print(list(counts))
+
+try:
+    np.bincount(np.array([1, -1, 2], dtype=np.int8))
+except ValueError:
+    print("ValueError")
+
+# views with a reversed inner axis are not contiguous
+a = np.array([[0.5, 1.5, 2.5], [0.5, 1.5, 2.5]])
+w = np.array([[1.0, 2.0, 4.0], [8.0, 16.0, 32.0]])
+counts, edges = np.histogram(a, bins=np.array([0.0, 1.0, 2.0, 3.0]), weights=w[:, ::-1])
+print(list(counts))
@@ -0,0 +1,27 @@
+try:
+    from ulab import numpy as np
+except ImportError:
+    import numpy as np
+
+a = np.array([3, 1, 4, 1, 5, 9, 2, 6], dtype=np.uint8)
+print(np.ptp(a))
+a = np.array([3, -1, 4, 1, -5, 9, 2, 6], dtype=np.int16)
+print(np.ptp(a))
+a = np.array([0.5, -1.5, 2.0])
+print(np.ptp(a))
+print(np.ptp([1, 2, 10]))
+
+a = np.array([[1, 7, 3], [4, 5, 0]], dtype=np.uint16)
+print(list(np.ptp(a, axis=0)))
+print(list(np.ptp(a, axis=1)))
+print(np.ptp(a))
+# strided views
+print(np.ptp(a[:, ::2]))
+print(np.ptp(a[::-1, 1]))
+# a reversed inner axis is not contiguous
+print(np.ptp(a[:, 1::-1]))
+
+try:
+    np.ptp(np.array([]))
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,21 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+def isclose(a, b):
+    return [math.isclose(p, q, rel_tol=1e-05, abs_tol=1e-05) for p, q in zip(list(a), list(b))]
+
+for n in (1, 2, 8, 64):
+    y = np.array([math.sin(0.3 * i) + 0.5 * math.cos(0.9 * i) + 0.25 for i in range(n)])
+    a, b = np.fft.fft(y)
+    c, d = np.fft.rfft(y)
+    print(len(c), all(isclose(a[:n//2+1], c)), all(isclose(b[:n//2+1], d)))
+    if n > 1:
+        print(all(isclose(np.fft.irfft(c, d), y)))
+    print(all(isclose(spy.signal.spectrogram(y), spy.signal.spectrogram(y, np.zeros(n)))))
+
+p = np.fft.plan(16)
+y = np.array(range(16), dtype=np.uint8)
+c, d = np.fft.rfft(y, plan=p)
+print(all(isclose(c, [120.0, -8.0, -8.0, -8.0, -8.0, -8.0, -8.0, -8.0, -8.0])))
+print(all(isclose(np.fft.irfft(c, d, plan=p), y)))
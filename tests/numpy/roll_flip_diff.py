@@ -0,0 +1,47 @@
+try:
+    from ulab import numpy as np
+except ImportError:
+    import numpy as np
+
+a = np.array(range(8), dtype=np.int16)
+print(np.roll(a, 3, inplace=True))
+print(list(a))
+np.roll(a, -5, inplace=True)
+print(list(a))
+
+a = np.array([[0, 1, 2, 3], [4, 5, 6, 7], [8, 9, 10, 11]], dtype=np.uint8)
+np.roll(a, 1, axis=1, inplace=True)
+print(list(a.flatten()))
+np.roll(a, -1, axis=0, inplace=True)
+print(list(a.flatten()))
+np.roll(a, 2, inplace=True)
+print(list(a.flatten()))
+b = a[:, ::2]
+np.roll(b, 1, inplace=True)
+print(list(a.flatten()))
+
+# a view with a reversed middle axis is not contiguous; this requires ULAB_MAX_DIMS > 2
+from ulab import __version__
+if int(__version__.split('-')[1][:-1]) > 2:
+    a = np.array(range(12), dtype=np.int16).reshape((2, 2, 3))
+    b = a[:, ::-1, :]
+    np.roll(b, 1, inplace=True)
+    print(list(a.flatten()) == [5, 0, 1, 8, 3, 4, 11, 6, 7, 2, 9, 10])
+else:
+    print(True)
+
+a = np.array([[1, 2, 3], [4, 5, 6]], dtype=np.int8)
+b = np.flip(a)
+print(b.shape, list(b.flatten()))
+b[0, 0] = 60
+print(list(a.flatten()))
+print(list(np.flip(a, axis=1).flatten()))
+
+a = np.array([1, 2, 4, 7, 11, 16])
+print(list(np.diff(a)))
+print(list(np.diff(a, n=2)))
+print(list(np.diff(a, n=3)))
+a = np.array([[1, 2, 4], [8, 16, 32], [0, 3, 9]], dtype=np.int16)
+print(list(np.diff(a, axis=0).flatten()))
+print(list(np.diff(a, n=2, axis=1).flatten()))
+print(list(np.diff(a[::-1, :], axis=0).flatten()))
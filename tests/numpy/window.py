@@ -0,0 +1,18 @@
+import math
+from ulab import numpy as np
+
+def isclose(a, b):
+    return (len(a) == len(b)) and all([math.isclose(p, q, rel_tol=1e-04, abs_tol=1e-04) for p, q in zip(list(a), list(b))])
+
+# reference values calculated with numpy
+print(isclose(np.hanning(8), [0.000000, 0.188255, 0.611260, 0.950484, 0.950484, 0.611260, 0.188255, 0.000000]))
+print(isclose(np.hamming(7), [0.080000, 0.310000, 0.770000, 1.000000, 0.770000, 0.310000, 0.080000]))
+print(isclose(np.blackman(9), [-0.000000, 0.066447, 0.340000, 0.773553, 1.000000, 0.773553, 0.340000, 0.066447, -0.000000]))
+print(isclose(np.kaiser(8, 8.6), [0.001333, 0.091137, 0.459644, 0.920462, 0.920462, 0.459644, 0.091137, 0.001333]))
+print(list(np.hanning(1)), len(np.hanning(0)))
+
+# the windows are memoised, but the caller receives a copy, which can be modified
+w = np.hanning(8)
+print(w is np.hanning(8))
+w *= 2
+print(isclose(np.hanning(8), [0.000000, 0.188255, 0.611260, 0.950484, 0.950484, 0.611260, 0.188255, 0.000000]))
@@ -0,0 +1,31 @@
+from ulab import numpy as np
+from ulab import scipy as spy
+
+x = np.array([[1.0, 2.0, 0.0, 4.0, 1.0], [0.0, 3.0, 1.0, -2.0, 2.0], [5.0, 1.0, 2.0, 0.0, -1.0], [2.0, 0.0, 1.0, 3.0, 1.0]])
+xi = np.array([[10, 20, 30, 40], [50, 60, 70, 80], [90, 100, 110, 120]], dtype=np.uint8)
+k = np.array([[1.0, 0.0], [2.0, -1.0]])
+sobel = np.array([[1, 0, -1], [2, 0, -2], [1, 0, -1]], dtype=np.int16)
+
+# reference values calculated with scipy
+print([list(row) for row in spy.signal.convolve2d(x, k)])
+print([list(row) for row in spy.signal.convolve2d(x, k, mode='same', boundary='wrap')])
+print([list(row) for row in spy.signal.convolve2d(x, k, mode='valid')])
+print([list(row) for row in spy.signal.convolve2d(x, sobel, mode='same', boundary='symm')])
+print([list(row) for row in spy.signal.convolve2d(x, k, boundary='fill', fillvalue=1)])
+
+# the separable sobel kernel is applied by rows, and columns
+print([list(row) for row in spy.ndimage.correlate(x, sobel)])
+print([list(row) for row in spy.ndimage.convolve(x, sobel, mode='constant', cval=1.0)])
+print([list(row) for row in spy.ndimage.convolve(x, k, mode='nearest')])
+
+# integer input is summed in integers, and saturated in integer outputs
+y = spy.ndimage.correlate(xi, sobel, mode='mirror', output=np.int16)
+print(y.dtype == np.int16, [list(row) for row in y])
+y = spy.ndimage.correlate(xi, sobel, mode='wrap')
+print(y.dtype == np.uint8, [list(row) for row in y])
+print(list(spy.ndimage.convolve(np.array([1.0, 2.0, 3.0, 4.0, 5.0]), np.array([1.0, -1.0]))))
+
+try:
+    spy.signal.convolve2d(x, np.zeros((5, 2)), mode='valid')
+except ValueError:
+    print('ValueError')
@@ -0,0 +1,35 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+def isclose(a, b):
+    return (len(a) == len(b)) and all([math.isclose(p, q, rel_tol=1e-04, abs_tol=1e-04) for p, q in zip(list(a), list(b))])
+
+# reference values calculated with scipy
+print(isclose(spy.signal.firwin(9, 0.3), [-0.004086, 0.007689, 0.089260, 0.243331, 0.327612, 0.243331, 0.089260, 0.007689, -0.004086]))
+print(isclose(spy.signal.firwin(8, [100, 200], pass_zero=False, fs=1000), [-0.033807, -0.085107, 0.051115, 0.447173, 0.447173, 0.051115, -0.085107, -0.033807]))
+print(isclose(spy.signal.firwin(11, 0.4, pass_zero='highpass', window='blackman'), [0.0, 0.003044, 0.012523, -0.047698, -0.257129, 0.600096, -0.257129, -0.047698, 0.012523, 0.003044, 0.0]))
+print(isclose(spy.signal.firwin(9, 0.5, width=0.2), [0.0, -0.114779, 0.0, 0.344337, 0.540884, 0.344337, 0.0, -0.114779, 0.0]))
+
+sos = spy.signal.butter(4, 0.2, output='sos')
+print(sos.shape)
+print(isclose(sos.flatten(), [0.004824, 0.009649, 0.004824, 1.0, -1.048600, 0.296140, 1.0, 2.0, 1.0, 1.0, -1.320913, 0.632739]))
+sos = spy.signal.butter(3, [0.2, 0.5], btype='bandstop', output='sos')
+print(isclose(sos.flatten(), [0.374453, -0.381586, 0.374453, 1.0, -0.675080, 0.324920, 1.0, -1.019051, 1.0, 1.0, -0.084058, 0.585919, 1.0, -1.019051, 1.0, 1.0, -1.361465, 0.723625]))
+b, a = spy.signal.butter(3, 100, btype='highpass', fs=1000)
+print(isclose(b, [0.527624, -1.582873, 1.582873, -0.527624]), isclose(a, [1.0, -1.760042, 1.182893, -0.278060]))
+
+# the sections can be passed to sosfilt
+x = np.array([math.sin(i) for i in range(16)])
+y = spy.signal.sosfilt(spy.signal.butter(4, 0.2, output='sos'), x)
+print(isclose(y, [0.0, 0.004060, 0.030244, 0.104855, 0.224384, 0.326644, 0.325037, 0.187428, -0.018357, -0.165524, -0.167669, -0.049886, 0.073739, 0.098559, 0.017144, -0.081087]))
+
+try:
+    spy.signal.firwin(8, 0.3, pass_zero=False)
+except ValueError:
+    print('ValueError')
+
+try:
+    spy.signal.butter(2, 1.2)
+except ValueError:
+    print('ValueError')
@@ -0,0 +1,33 @@
+from ulab import numpy as np
+from ulab import scipy as spy
+
+x = np.array([0.0, 2.0, 1.0, 3.0, 3.0, 3.0, 0.5, 4.0, -1.0, 1.5, 1.0, 5.0, 2.0, 2.5, 0.0, 1.0, 0.0])
+xi = np.array([0, 10, 3, 8, 2, 2, 7, 1, 9, 0], dtype=np.int16)
+
+# reference values calculated with scipy
+peaks, properties = spy.signal.find_peaks(x)
+print(peaks.dtype == np.uint16, list(peaks))
+
+peaks, properties = spy.signal.find_peaks(x, height=2.0)
+print(list(peaks), list(properties['peak_heights']))
+
+peaks, properties = spy.signal.find_peaks(x, height=(None, 3.5), threshold=0.5)
+print(list(peaks), list(properties['left_thresholds']), list(properties['right_thresholds']))
+
+peaks, properties = spy.signal.find_peaks(x, distance=3)
+print(list(peaks))
+
+peaks, properties = spy.signal.find_peaks(x, prominence=1.0)
+print(list(peaks), list(properties['prominences']))
+print(list(properties['left_bases']), list(properties['right_bases']))
+
+peaks, properties = spy.signal.find_peaks(xi, distance=2.5, prominence=(5, None))
+print(list(peaks), list(properties['prominences']))
+
+peaks, properties = spy.signal.find_peaks([1.0, 3.0, 1.0, 3.0, 1.0])
+print(list(peaks))
+
+try:
+    spy.signal.find_peaks(x, distance=0.5)
+except ValueError:
+    print('ValueError')
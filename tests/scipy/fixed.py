@@ -0,0 +1,39 @@
+from ulab import numpy as np
+from ulab import scipy as spy
+
+x = np.array([0, 1000, 3000, -2000, 500, 4000, 1000, -1000, 2000, 0, -3000, 1500, 2500, 0, -500, 1000], dtype=np.int16)
+sos = [[0.0675, 0.1349, 0.0675, 1.0, -1.1430, 0.4128], [1.0, 2.0, 1.0, 1.0, -1.2, 0.5]]
+h = [0.25, 0.5, 0.25]
+
+# the second section has a coefficient of 2.0, which requires a shift of 2 in Q15
+y = spy.signal.sosfilt_fixed(sos, x, shift=2)
+print(y.dtype == np.int16, list(y))
+try:
+    spy.signal.sosfilt_fixed(sos, x)
+except ValueError:
+    print('ValueError')
+
+# filtering block by block gives the same result
+zi = np.zeros((2, 4), dtype=np.int16)
+y1, z = spy.signal.sosfilt_fixed(sos, x[:7], shift=2, zi=zi)
+y2, z = spy.signal.sosfilt_fixed(sos, x[7:], shift=2, zi=z)
+print(list(y1) + list(y2) == list(y), [list(row) for row in z])
+
+print(list(spy.signal.firfilt_fixed(h, x)))
+print(list(spy.signal.firfilt_fixed(h, np.array(x, dtype=np.int32) * 100000)))
+y1, z = spy.signal.firfilt_fixed(h, x[:2], zi=np.zeros(2, dtype=np.int16))
+y2, z = spy.signal.firfilt_fixed(h, x[2:], zi=z)
+print(list(y1) + list(y2), list(z))
+
+# the output saturates
+print(list(spy.signal.firfilt_fixed([1.5, 1.5], np.array([20000, -20000, 30000, 30000], dtype=np.int16), shift=1)))
+
+# in-place filtering
+buffer = np.array(x, dtype=np.int16)
+spy.signal.sosfilt_fixed(sos, buffer, shift=2, out=buffer)
+print(list(buffer) == list(y))
+
+try:
+    spy.signal.firfilt_fixed(h, np.array([1.0, 2.0]))
+except TypeError:
+    print('TypeError')
@@ -0,0 +1,30 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+def isclose(a, b):
+    return (len(a) == len(b)) and all([math.isclose(p, q, rel_tol=1e-04, abs_tol=1e-04) for p, q in zip(list(a), list(b))])
+
+# the windows are memoised, but the caller receives a copy, which can be modified
+w = spy.signal.get_window('hann', 16)
+print(w is spy.signal.get_window('hann', 16))
+w *= 0
+print(spy.signal.get_window('hann', 16)[4])
+
+# reference values calculated with scipy
+print(isclose(spy.signal.get_window('hann', 8), [0.000000, 0.146447, 0.500000, 0.853553, 1.000000, 0.853553, 0.500000, 0.146447]))
+print(isclose(spy.signal.get_window('hann', 8, fftbins=False), [0.000000, 0.188255, 0.611260, 0.950484, 0.950484, 0.611260, 0.188255, 0.000000]))
+print(isclose(spy.signal.get_window('blackman', 10), [-0.000000, 0.040213, 0.200770, 0.509787, 0.849230, 1.000000, 0.849230, 0.509787, 0.200770, 0.040213]))
+print(isclose(spy.signal.get_window('hamming', 5), [0.080000, 0.397852, 0.912148, 0.912148, 0.397852]))
+print(isclose(spy.signal.get_window(('kaiser', 5.0), 9), [0.036711, 0.201279, 0.475527, 0.775322, 0.972731, 0.972731, 0.775322, 0.475527, 0.201279]))
+print(list(spy.signal.get_window('boxcar', 4)))
+
+try:
+    spy.signal.get_window('kaiser', 8)
+except ValueError:
+    print('ValueError')
+
+try:
+    spy.signal.get_window('triangle', 8)
+except ValueError:
+    print('ValueError')
@@ -0,0 +1,48 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+def isclose(a, b):
+    return all([math.isclose(p, q, rel_tol=1e-04, abs_tol=1e-02) for p, q in zip(list(a), list(b))])
+
+def dft(x, freqs, fs):
+    re = [sum([x[i] * math.cos(2 * math.pi * f * i / fs) for i in range(len(x))]) for f in freqs]
+    im = [-sum([x[i] * math.sin(2 * math.pi * f * i / fs) for i in range(len(x))]) for f in freqs]
+    return re, im
+
+x = [math.sin(0.3 * i) + 0.5 * math.cos(1.7 * i) for i in range(64)]
+y = np.array(x)
+
+# on the bins, the results are those of the FFT
+a, b = spy.signal.goertzel(y, [0, 3, 5, 32])
+c, d = np.fft.fft(y)
+print(isclose(a, [c[0], c[3], c[5], c[32]]), isclose(b, [d[0], d[3], d[5], d[32]]))
+
+# the frequencies need not fall on the bins
+freqs = [10.0, 95.5, 400.0]
+a, b = spy.signal.goertzel(y, freqs, fs=1000)
+re, im = dft(x, freqs, 1000)
+print(isclose(a, re), isclose(b, im))
+
+# integer inputs
+a, b = spy.signal.goertzel(np.array(range(10), dtype=np.int16), [1], 10)
+re, im = dft(list(range(10)), [1], 10)
+print(isclose(a, re), isclose(b, im))
+
+# the sliding DFT tracks the last n samples
+sdft = spy.signal.sliding_dft(16, [1.0, 2.5], fs=16)
+print(sdft)
+# before the window is filled, the missing samples are 0
+a, b = sdft(y[:5])
+re, im = dft([0] * 11 + x[:5], [1.0, 2.5], 16)
+print(isclose(a, re), isclose(b, im))
+# arrays, iterables, and single samples can be fed
+a, b = sdft(y[5:30])
+a, b = sdft(x[30:35])
+for v in x[35:50]:
+    a, b = sdft(v)
+re, im = dft(x[34:50], [1.0, 2.5], 16)
+print(isclose(a, re), isclose(b, im))
+a, b = sdft(x[50:])
+re, im = dft(x[48:], [1.0, 2.5], 16)
+print(isclose(a, re), isclose(b, im))
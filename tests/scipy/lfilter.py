@@ -0,0 +1,36 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+def isclose(a, b):
+    return all([math.isclose(p, q, rel_tol=1e-04, abs_tol=1e-04) for p, q in zip(list(a), list(b))])
+
+x = np.array([0.0, 1.0, 3.0, -2.0, 0.5, 4.0, 1.0, -1.0, 2.0, 0.0, -3.0, 1.5, 2.5, 0.0, -0.5, 1.0, 0.0, 2.0, -1.0, 0.5])
+b = [0.0675, 0.1349, 0.0675]
+a = [1.0, -1.1430, 0.4128]
+sos = np.array([[0.0675, 0.1349, 0.0675, 1.0, -1.1430, 0.4128], [1.0, 2.0, 1.0, 1.0, -1.2, 0.5]])
+
+# reference values calculated with scipy
+print(isclose(spy.signal.lfilter(b, a, x), [0.000000, 0.067500, 0.414552, 0.783170, 0.690485, 0.668383, 1.119779, 1.341399, 1.138574, 0.949961, 0.548302, -0.068885, -0.136474, 0.310945, 0.546747, 0.496624, 0.443094, 0.503950, 0.595406, 0.506368]))
+y, zf = spy.signal.lfilter(b, a, x, zi=[0.5, -0.25])
+print(isclose(y, [0.500000, 0.389000, 0.575627, 0.834562, 0.682736, 0.638310, 1.088605, 1.318181, 1.124905, 0.943921, 0.547041, -0.067833, -0.134751, 0.312481, 0.547791, 0.497183, 0.443302, 0.503957, 0.595328, 0.506276]))
+print(isclose(zf, [0.332872, -0.175241]))
+print(isclose(spy.signal.lfilter([1, 1, 1], [3], x), [0.000000, 0.333333, 1.333333, 0.666667, 0.500000, 0.833333, 1.833333, 1.333333, 0.666667, 0.333333, -0.333333, -0.500000, 0.333333, 1.333333, 0.666667, 0.166667, 0.166667, 1.000000, 0.333333, 0.500000]))
+
+# filtering block by block gives the same result
+y1, z = spy.signal.lfilter(b, a, x[:7], zi=[0, 0])
+y2, z = spy.signal.lfilter(b, a, x[7:], zi=z)
+print(isclose(list(y1) + list(y2), spy.signal.lfilter(b, a, x)))
+
+print(isclose(spy.signal.lfilter_zi(b, a), [0.932871, -0.345453]))
+print(isclose(spy.signal.filtfilt(b, a, x), [0.008029, 0.423947, 0.738660, 0.950649, 1.097068, 1.130494, 0.985467, 0.710601, 0.418280, 0.207461, 0.162289, 0.277132, 0.421010, 0.488696, 0.500379, 0.510833, 0.525338, 0.524911, 0.515044, 0.514258]))
+print(isclose(spy.signal.filtfilt(b, a, x, padlen=5), [0.138391, 0.522143, 0.797089, 0.976898, 1.102948, 1.126365, 0.978291, 0.704056, 0.413701, 0.204878, 0.161229, 0.277119, 0.421792, 0.490272, 0.502858, 0.514150, 0.528817, 0.526747, 0.511844, 0.501016]))
+
+zi = spy.signal.sosfilt_zi(sos)
+print(zi.shape, isclose(zi[0], [0.932871, -0.345453]), isclose(zi[1], [12.337905, -5.668767]))
+print(isclose(spy.signal.sosfiltfilt(sos, x), [-0.009233, 80.463148, 149.127909, 196.504569, 216.783489, 208.807709, 176.972290, 131.196752, 84.722119, 49.896386, 33.821364, 36.227449, 50.868580, 69.474034, 85.550980, 95.953569, 100.342546, 99.920975, 96.397818, 91.360545]))
+
+try:
+    spy.signal.filtfilt(b, a, x[:9])
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,25 @@
+from ulab import numpy as np
+from ulab import scipy as spy
+
+x = np.array([0.0, 1.0, 3.0, -2.0, 0.5, 40.0, 1.0, -1.0, 2.0, 0.0, -3.0, 1.5, 2.5, 0.0, -0.5, 1.0])
+xi = np.array([[1, 2, 3, 4, 5], [6, 100, 8, 9, 10], [11, 12, 13, -50, 15], [16, 17, 18, 19, 20]], dtype=np.int16)
+
+# reference values calculated with scipy
+print(list(spy.signal.medfilt(x)))
+print(list(spy.signal.medfilt(x, 5)))
+y = spy.signal.medfilt(xi, [3, 3])
+print(y.dtype == np.int16, [list(row) for row in y])
+
+print(list(spy.ndimage.median_filter(x, 4)))
+print(list(spy.ndimage.median_filter(x, 3, mode='nearest')))
+print(list(spy.ndimage.median_filter(x, 5, mode='wrap')))
+print(list(spy.ndimage.median_filter(x, 5, mode='mirror')))
+print([list(row) for row in spy.ndimage.median_filter(xi, (3, 2))])
+
+print(list(spy.ndimage.rank_filter(x, 0, 3)))
+print(list(spy.ndimage.rank_filter(x, -1, 3, mode='constant', cval=10)))
+
+try:
+    spy.signal.medfilt(x, 4)
+except ValueError:
+    print('ValueError')
@@ -0,0 +1,35 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+def isclose(a, b):
+    return (len(a) == len(b)) and all([math.isclose(p, q, rel_tol=1e-04, abs_tol=1e-04) for p, q in zip(list(a), list(b))])
+
+x = np.array([0.0, 1.0, 3.0, -2.0, 0.5, 4.0, 1.0, -1.0, 2.0, 0.0, -3.0, 1.5, 2.5, 0.0, -0.5, 1.0, 0.0, 2.0, -1.0, 0.5])
+h = [0.25, 0.5, 0.25, -0.125]
+
+# reference values calculated with scipy
+y = spy.signal.upfirdn(h, x, 3, 2)
+print(isclose(y, [0.000000, 0.000000, 0.500000, 0.625000, 0.750000, -1.000000, 0.375000, 0.125000, 2.000000, -0.250000, 0.250000, -0.500000, 0.625000, 0.500000, 0.000000, -0.750000, -0.750000, 0.750000, 0.437500, 0.625000, 0.000000, -0.125000, -0.125000, 0.500000, -0.125000, 0.000000, 1.000000, -0.500000, -0.250000, 0.250000, -0.062500]))
+print(isclose(spy.signal.upfirdn(h, x, down=3), [0.000000, 1.250000, 2.625000, 0.625000, 0.625000, -0.312500, 0.625000, 0.250000]))
+print(isclose(spy.signal.resample_poly(x, 3, 2), [0.000000, 0.097627, 2.259828, 3.001819, -0.386228, -2.388428, 0.500303, 3.675266, 3.473757, 1.000606, -0.998831, -0.239256, 2.001212, 1.571610, -1.772695, -3.001819, -0.161398, 2.545322, 2.501515, 0.928336, -0.724369, -0.500303, 0.977902, 0.452237, 0.000000, 1.725837, 1.282632, -1.000606, -0.369827, 0.865134]))
+print(isclose(spy.signal.resample_poly(x, 1, 4), [0.307849, 1.302686, 0.292778, 0.359502, 0.599550]))
+print(isclose(spy.signal.resample_poly(x, 2, 1, window=h), [0.000000, 0.500000, 1.000000, 2.000000, 2.750000, 0.500000, -2.750000, -0.750000, 1.000000, 2.250000, 3.875000, 2.500000, 0.000000, 0.000000, -1.250000, 0.500000, 2.250000, 1.000000, -0.500000, -1.500000, -3.000000, -0.750000, 2.250000, 2.000000, 2.125000, 1.250000, -0.625000, -0.250000, -0.500000, 0.250000, 1.125000, 0.500000, -0.250000, 1.000000, 2.000000, 0.500000, -1.500000, -0.250000, 0.750000, 0.250000]))
+# equal rates return a copy of the input, even if a window is given
+print(isclose(spy.signal.resample_poly(x, 2, 2, window=h), x))
+print(isclose(spy.signal.decimate(x, 2), [0.752637, 0.758848, 0.833315, 1.789523, -0.012589, -0.617295, 1.470734, -0.102992, 0.886210, 0.197168]))
+print(isclose(spy.signal.decimate(x, 3, 8, zero_phase=False), [0.000000, 0.090123, 0.836497, 1.542182, 0.277094, 0.401532, 0.295275]))
+
+# the streaming filter returns the leading samples of upfirdn block by block
+f = spy.signal.UpFIRDn(h, 3, 2)
+print(f)
+y1 = f.process(x[:7])
+y2 = f.process(x[7:])
+print(len(y1), len(y2), isclose(list(y1) + list(y2), y[:30]))
+f.reset()
+print(isclose(f.process(x), y[:30]))
+
+try:
+    spy.signal.upfirdn(h, x, 0, 1)
+except ValueError:
+    print('ValueError')
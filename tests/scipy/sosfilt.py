@@ -0,0 +1,33 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+def isclose(a, b):
+    return all([math.isclose(p, q, rel_tol=1e-05, abs_tol=1e-05) for p, q in zip(list(a), list(b))])
+
+sos = np.array([[0.2, 0.4, 0.2, 1.0, -0.5, 0.2], [1.0, -1.2, 1.0, 1.0, -1.1, 0.6]])
+x = np.array([[math.sin(0.2 * i + c) for i in range(20)] for c in range(3)])
+
+# each row is a channel
+y = spy.signal.sosfilt(sos, x)
+print(y.shape, all([isclose(y[c], spy.signal.sosfilt(sos, x[c])) for c in range(3)]))
+
+# each column is a channel
+xt = x.transpose()
+y = spy.signal.sosfilt(sos, xt, axis=0)
+print(y.shape, all([isclose(y[:, c], spy.signal.sosfilt(sos, x[c])) for c in range(3)]))
+
+# the delays of the channels follow each other in the rows of the state
+zi = np.array([[0.1, 0.2, 0.3, 0.4, 0.5, 0.6], [0.0, -0.1, 0.2, 0.0, 0.1, 0.3]])
+y, zf = spy.signal.sosfilt(sos, x, zi=zi)
+print(zf.shape)
+ok = True
+for c in range(3):
+    yc, zc = spy.signal.sosfilt(sos, x[c], zi=np.array([zi[0][2 * c:2 * c + 2], zi[1][2 * c:2 * c + 2]]))
+    ok = ok and isclose(y[c], yc) and isclose(zf[0][2 * c:2 * c + 2], zc[0]) and isclose(zf[1][2 * c:2 * c + 2], zc[1])
+print(ok)
+
+try:
+    spy.signal.sosfilt(sos, x, zi=np.zeros((2, 2)))
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,40 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+def isclose(a, b):
+    return all([math.isclose(p, q, rel_tol=1e-05, abs_tol=1e-05) for p, q in zip(list(a), list(b))])
+
+sos = np.array([[0.2, 0.4, 0.2, 1.0, -0.5, 0.2], [1.0, -1.2, 1.0, 1.0, -1.1, 0.6]])
+x = np.array([math.sin(0.2 * i) + 0.5 * math.cos(1.3 * i) for i in range(96)])
+zi = np.array([[0.1, 0.2], [0.3, 0.4]])
+y, zf = spy.signal.sosfilt(sos, x, zi=zi)
+
+f = spy.signal.SOSFilter(sos, zi=zi)
+print(f)
+
+# the state is carried over between blocks
+out = np.zeros(32)
+blocks = []
+for i in range(3):
+    r = f.process(x[32 * i:32 * (i + 1)], out=out)
+    print(r is out)
+    blocks += list(out)
+print(isclose(blocks, y))
+
+# in-place filtering, and the reset of the state
+f.reset()
+b = x[:32] * 1.0
+f.process(b, out=b)
+print(isclose(b, spy.signal.sosfilt(sos, x[:32])))
+
+# integer input, and iterables
+f.reset()
+print(isclose(f.process(np.array(range(10), dtype=np.int8)), spy.signal.sosfilt(sos, np.array(range(10)))))
+f.reset()
+print(isclose(f.process(range(10)), spy.signal.sosfilt(sos, np.array(range(10)))))
+
+try:
+    f.process(x[:10], out=np.zeros(8))
+except ValueError:
+    print("ValueError")
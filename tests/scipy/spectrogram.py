@@ -0,0 +1,75 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+def reference(x, nperseg, noverlap, window, fs, scaling):
+    # a direct implementation of the one-sided power spectrogram with constant detrending
+    w = [window(i, nperseg) for i in range(nperseg)]
+    if scaling == 'density':
+        scale = 1 / (fs * sum([v * v for v in w]))
+    else:
+        scale = 1 / sum(w) ** 2
+    step = nperseg - noverlap
+    columns = []
+    for start in range(0, len(x) - nperseg + 1, step):
+        segment = x[start:start + nperseg]
+        mean = sum(segment) / nperseg
+        column = []
+        for k in range(nperseg // 2 + 1):
+            re = im = 0
+            for i in range(nperseg):
+                v = (segment[i] - mean) * w[i]
+                re += v * math.cos(2 * math.pi * k * i / nperseg)
+                im -= v * math.sin(2 * math.pi * k * i / nperseg)
+            p = (re * re + im * im) * scale
+            if k > 0 and 2 * k != nperseg:
+                p *= 2
+            column.append(p)
+        columns.append(column)
+    return columns
+
+def hann(i, n):
+    return 0.5 - 0.5 * math.cos(2 * math.pi * i / n)
+
+def boxcar(i, n):
+    return 1.0
+
+def compare(result, columns):
+    ok = result.shape == (len(columns[0]), len(columns))
+    for t in range(len(columns)):
+        for k in range(len(columns[0])):
+            ok = ok and math.isclose(result[k, t], columns[t][k], rel_tol=1e-4, abs_tol=1e-6)
+    return ok
+
+x = [math.sin(0.37 * i) + 0.3 * math.cos(1.9 * i) + 0.01 * i for i in range(64)]
+a = np.array(x)
+
+result = spy.signal.spectrogram(a, nperseg=16)
+print(compare(result, reference(x, 16, 2, hann, 1.0, 'density')))
+
+result = spy.signal.spectrogram(a, fs=8, nperseg=15, noverlap=5, window='boxcar', scaling='spectrum')
+print(compare(result, reference(x, 15, 5, boxcar, 8.0, 'spectrum')))
+
+w = [hann(i, 12) for i in range(12)]
+result = spy.signal.spectrogram(a, nperseg=12, noverlap=6, window=w)
+print(compare(result, reference(x, 12, 6, hann, 1.0, 'density')))
+
+# a sine of amplitude 2 in the fourth bin has the power 2 ** 2 / 2
+b = np.array([2 * math.sin(2 * math.pi * 4 * i / 32) for i in range(32)])
+result = spy.signal.spectrogram(b, nperseg=32, window='boxcar', scaling='spectrum')
+print(result.shape, math.isclose(result[4, 0], 2.0, rel_tol=1e-6))
+
+# the stream returns the same columns, irrespective of the chunks
+stream = spy.signal.spectrogram_stream(16, noverlap=4)
+full = spy.signal.spectrogram(a, nperseg=16, noverlap=4)
+start = 0
+column = 0
+ok = True
+for size in (5, 1, 20, 7, 31):
+    result = stream(a[start:start + size])
+    for t in range(result.shape[1]):
+        for k in range(result.shape[0]):
+            ok = ok and math.isclose(result[k, t], full[k, column], rel_tol=1e-6, abs_tol=1e-9)
+        column += 1
+    start += size
+print(ok, column == full.shape[1])
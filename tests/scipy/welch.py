@@ -0,0 +1,60 @@
+import math
+from ulab import numpy as np
+from ulab import scipy as spy
+
+def hann(n):
+    return [0.5 - 0.5 * math.cos(2 * math.pi * i / n) for i in range(n)]
+
+def reference(x, nperseg, noverlap, fs):
+    # the average of the one-sided power spectral densities of the segments
+    w = hann(nperseg)
+    scale = 1 / (fs * sum([v * v for v in w]))
+    step = nperseg - noverlap
+    starts = range(0, len(x) - nperseg + 1, step)
+    psd = [0] * (nperseg // 2 + 1)
+    for start in starts:
+        segment = x[start:start + nperseg]
+        mean = sum(segment) / nperseg
+        for k in range(len(psd)):
+            re = im = 0
+            for i in range(nperseg):
+                v = (segment[i] - mean) * w[i]
+                re += v * math.cos(2 * math.pi * k * i / nperseg)
+                im -= v * math.sin(2 * math.pi * k * i / nperseg)
+            p = (re * re + im * im) * scale
+            if k > 0 and 2 * k != nperseg:
+                p *= 2
+            psd[k] += p / len(starts)
+    return psd
+
+x = [math.sin(0.3 * i) + 0.1 * math.cos(2.1 * i * i) for i in range(100)]
+y = [math.cos(0.3 * i + 0.4) + 0.05 * i for i in range(100)]
+a = np.array(x)
+b = np.array(y)
+
+f, pxx = spy.signal.welch(a, fs=4, nperseg=32)
+print(len(f), f[1], f[-1])
+print(all([math.isclose(p, q, rel_tol=1e-4, abs_tol=1e-9) for p, q in zip(pxx, reference(x, 32, 16, 4))]))
+
+# nperseg is shortened to the length of the input
+f, pxx = spy.signal.welch(a, nperseg=256)
+print(len(f), all([math.isclose(p, q, rel_tol=1e-4, abs_tol=1e-9) for p, q in zip(pxx, reference(x, 100, 50, 1))]))
+
+# the cross spectral density of a signal with itself is its power spectral density
+f, pxx = spy.signal.welch(a, nperseg=20, noverlap=5)
+f, pxy = spy.signal.csd(a, a, nperseg=20, noverlap=5)
+print(all([math.isclose(p, q.real, rel_tol=1e-4, abs_tol=1e-9) and abs(q.imag) < 1e-6 for p, q in zip(pxx, pxy)]))
+
+f, pxy = spy.signal.csd(a, b, nperseg=20, noverlap=5)
+f, pyx = spy.signal.csd(b, a, nperseg=20, noverlap=5)
+print(all([math.isclose(p.real, q.real, rel_tol=1e-4, abs_tol=1e-9) and math.isclose(p.imag, -q.imag, rel_tol=1e-4, abs_tol=1e-9) for p, q in zip(pxy, pyx)]))
+
+# a sine of amplitude 2 in the fourth bin has the power 2 ** 2 / 2
+c = np.array([2 * math.sin(2 * math.pi * 4 * i / 32) for i in range(96)])
+f, pxx = spy.signal.welch(c, nperseg=32, window='boxcar', scaling='spectrum')
+print(math.isclose(pxx[4], 2.0, rel_tol=1e-6), pxx[3] < 1e-9)
+
+# a window with a parameter is the same as the explicit periodic window
+f, pxx = spy.signal.welch(a, nperseg=32, window=('kaiser', 8.0))
+f, pww = spy.signal.welch(a, nperseg=32, window=spy.signal.get_window(('kaiser', 8.0), 32))
+print(len(pxx), all([math.isclose(p, q, rel_tol=1e-6, abs_tol=1e-12) for p, q in zip(pxx, pww)]))
@@ -0,0 +1,17 @@
+from ulab import numpy as np
+from ulab import utils
+
+a = np.array([3, 1, 4, 1, 5, 9, 2, 6], dtype=np.uint8)
+print(utils.minmax(a))
+print(utils.minmax(a, indices=True))
+a = np.array([3.0, -1.0, 4.0, 1.0, -5.0, 9.0, 9.0, 6.0])
+print(utils.minmax(a))
+print(utils.minmax(a, indices=True))
+a = np.array([[1, 7, 3], [4, 5, 0]], dtype=np.int8)
+print(utils.minmax(a))
+print(utils.minmax(a, indices=True))
+mn, mx = utils.minmax(a, axis=0)
+print(list(mn), list(mx))
+mn, mx, imn, imx = utils.minmax(a, axis=1, indices=True)
+print(list(mn), list(mx), list(imn), list(imx))
+print(utils.minmax(a[1, :], axis=0, indices=True))
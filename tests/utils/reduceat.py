@@ -0,0 +1,36 @@
+from ulab import numpy as np
+from ulab import utils
+
+a = np.array([1, 2, 3, 4, 5, 6, 7, 8], dtype=np.uint8)
+idx = np.array([0, 3, 3, 5], dtype=np.uint8)
+print(list(utils.reduceat(a, idx)))
+print(list(utils.reduceat(a, idx, op='min')))
+print(list(utils.reduceat(a, idx, op='max')))
+print(list(utils.reduceat(a, idx, op='mean')))
+print(list(utils.reduceat(a, [4, 1])))
+
+a = np.array([0.5, -1.0, 2.0, 4.0, -3.0, 1.5])
+print(list(utils.reduceat(a, [0, 2, 4], op='mean')))
+print(list(utils.reduceat(a[::-1], [0, 2], op='max')))
+print(list(utils.reduceat(np.array([200, 100], dtype=np.uint8), [0])))
+
+try:
+    utils.reduceat(a, [0, 6])
+except ValueError:
+    print("ValueError")
+try:
+    utils.reduceat(a, [0], op='prod')
+except ValueError:
+    print("ValueError")
+try:
+    utils.reduceat(a, [0], op=5)
+except TypeError:
+    print("TypeError")
+try:
+    utils.reduceat(a, [0, 2.7])
+except TypeError:
+    print("TypeError")
+try:
+    utils.reduceat(a, [0, float('nan')])
+except TypeError:
+    print("TypeError")